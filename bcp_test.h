@@ -47,9 +47,16 @@
 
 /* Standard C includes */
 #include <stdio.h>
+#include <stddef.h>
 #include <string.h>
 #include <math.h>
 
+/* C6x control registers, TSCL/TSCH time stamp counter */
+#include <c6x.h>
+
+/* Binary test vector format */
+#include "bcp_test_vec.h"
+
 /** Number of host descriptors used by the BCP test */
 #define     BCP_TEST_NUM_HOST_DESC              256
 
@@ -62,7 +69,273 @@
  */
 #define     BCP_TEST_SIZE_HOST_DESC             64 
 
+/** Number of packets sent by each test. The test vectors are parsed once,
+ *  so this can be raised from the build for throughput runs.
+ */
+#ifndef BCP_TEST_NUM_PACKETS
 #define     BCP_TEST_NUM_PACKETS                10
+#endif
+
+/** L1D cache line size */
+#define     BCP_TEST_L1D_LINE_SIZE              64
+
+/** Header template limits */
+#define     BCP_TEST_HDR_TMPL_MAX_WORDS         128
+#define     BCP_TEST_HDR_TMPL_MAX_FIELDS        4
+#define     BCP_TEST_HDR_TMPL_MAX_KEY           8
+#define     BCP_TEST_HDR_TMPL_MAX_AUX           8
+#define     BCP_TEST_HDR_TMPL_CACHE_SIZE        4
+
+/** Header template states */
+#define     BCP_TEST_HDR_TMPL_EMPTY             0
+#define     BCP_TEST_HDR_TMPL_READY             1
+#define     BCP_TEST_HDR_TMPL_NO_PATCH          2
+
+/** Builds a complete BCP header chain into pHdr, using pFieldVal for the
+ *  volatile fields. Returns the number of bytes built, or -1 on error.
+ */
+typedef Int32 (*BcpTest_HdrBuildFxn) (Void* pArg, const UInt32* pFieldVal, UInt8* pHdr);
+
+/** Location of a volatile field in a header template */
+typedef struct _BcpTest_HdrField
+{
+    UInt16      wordIdx;
+    UInt8       shift;
+    UInt8       width;
+} BcpTest_HdrField;
+
+/** Packed header chain of one configuration */
+typedef struct _BcpTest_HdrTmpl
+{
+    UInt32              key [BCP_TEST_HDR_TMPL_MAX_KEY];
+    UInt32              keyLen;
+    UInt32              state;
+    UInt32              hdrLen;         /* Bytes */
+    UInt32              numFields;
+    BcpTest_HdrField    field [BCP_TEST_HDR_TMPL_MAX_FIELDS];
+    UInt32              auxData [BCP_TEST_HDR_TMPL_MAX_AUX]; /* Caller data derived from the configuration */
+    UInt32              lastUsed;
+    UInt32              hdr [BCP_TEST_HDR_TMPL_MAX_WORDS];
+} BcpTest_HdrTmpl;
+
+/** Pre-packed header template, as written by hdr_tmpl_export_cache () */
+typedef struct _BcpTest_HdrBlob
+{
+    UInt32              key [BCP_TEST_HDR_TMPL_MAX_KEY];
+    UInt32              keyLen;
+    UInt32              hdrLen;         /* Bytes */
+    UInt32              numFields;
+    BcpTest_HdrField    field [BCP_TEST_HDR_TMPL_MAX_FIELDS];
+    UInt32              auxData [BCP_TEST_HDR_TMPL_MAX_AUX];
+    const UInt32*       pHdr;
+} BcpTest_HdrBlob;
+
+/** Binary test vector loaded by vec_load () */
+typedef struct _BcpTest_Vec
+{
+    const BcpTest_VecHdr*   pHdr;
+    const UInt32*       pWords;         /* 64 byte aligned */
+    UInt32              numWords;
+    Void*               pMem;           /* Buffer or mapping holding the file */
+    UInt32              memLen;
+} BcpTest_Vec;
+
+/** Golden output words expanded at a time by golden_validate () */
+#define     BCP_TEST_GOLDEN_CHUNK_WORDS         64
+
+/** Dictionary coded golden output, as written by tools/golden_pack.c */
+typedef struct _BcpTest_Golden
+{
+    UInt32              numWords;
+    UInt8               idxBits;        /* Bits per word index: 1, 2, 4, 8, or 32 for words stored as is */
+    UInt16              numDict;
+    const UInt32*       pDict;          /* Distinct words of the output */
+    const UInt32*       pIdx;           /* Word indices, packed from the LSB of each word */
+} BcpTest_Golden;
+
+/** Golden output digest, as written by tools/golden_pack.c -d: a 64 bit hash
+ *  per BCP_TEST_DIGEST_CHUNK_BYTES of output, see bcp_test_vec.h. The full
+ *  output is only read from its vector file to locate a mismatch.
+ */
+typedef struct _BcpTest_Digest
+{
+    UInt32              numBytes;
+    UInt32              numChunks;
+    const UInt32*       pHashes;        /* Low, then high lane of each chunk */
+    const char*         pVecFile;       /* Test vector file of the output, NULL if none */
+} BcpTest_Digest;
+
+/** Max number of differing words logged for a chunk that does not match */
+#define     BCP_TEST_DIGEST_MAX_DIFFS           8
+
+/** Bins of the mismatch histogram of rxdata_diff () */
+#define     BCP_TEST_DIFF_HIST_BINS             16
+
+/** Mismatch report of a data buffer received from BCP, see rxdata_diff ().
+ *  Words are counted in 32 bit words of the reference output.
+ */
+typedef struct _BcpTest_RxDiff
+{
+    UInt32              firstWord;      /* First word compared */
+    UInt32              numWords;       /* Words compared, in full or in part */
+    UInt32              numWordErrs;    /* Words that differ */
+    UInt32              firstErrWord;   /* First word that differs */
+    UInt32              numBitErrs;     /* Bits that differ */
+    UInt32              binWords;       /* Words per histogram bin */
+    UInt32              hist [BCP_TEST_DIFF_HIST_BINS];     /* Words that differ, per bin */
+} BcpTest_RxDiff;
+
+/** Running check of received data against a digest, see digest_check_start () */
+typedef struct _BcpTest_DigestCheck
+{
+    const BcpTest_Digest*   pDigest;
+    UInt32              dataOffset;     /* Bytes received */
+    UInt32              chunkLen;       /* Bytes of the current chunk received */
+    UInt32              numMismatch;    /* Chunks that do not match */
+    UInt32              chunk [BCP_TEST_DIGEST_CHUNK_BYTES / 4];
+} BcpTest_DigestCheck;
+
+/** Cores that keep test statistics, each in its own table */
+#define     BCP_TEST_STATS_MAX_CORES            4
+
+/** Configurations statistics are kept for */
+#define     BCP_TEST_STATS_MAX_CFGS             4
+#define     BCP_TEST_STATS_CFG_NAME_LEN         16
+
+/** SNR bins, BCP_TEST_STATS_BIN_DB wide from BCP_TEST_STATS_MIN_SNR_DB. The
+ *  first and last bins also take the SNRs below and above them.
+ */
+#define     BCP_TEST_STATS_NUM_BINS             48
+#define     BCP_TEST_STATS_MIN_SNR_DB           (-10.0f)
+#define     BCP_TEST_STATS_BIN_DB               (0.5f)
+
+/** Result of a transport block, see stats_add_block () */
+typedef struct _BcpTest_StatsBlock
+{
+    float               snrDb;
+    UInt32              numBits;        /* Hard decision bits checked */
+    UInt32              numBitErrs;     /* Hard decision bits in error */
+    UInt32              numTbBits;      /* Transport block bits */
+    UInt32              numCodeBlks;
+    UInt32              numCbCrcFails;  /* Code blocks failing their CRC, where known */
+    UInt32              numTrans;       /* Transmissions combined, HARQ retransmissions included */
+    Bool                bBlockErr;
+} BcpTest_StatsBlock;
+
+/** Counters of a configuration and SNR bin */
+typedef struct _BcpTest_StatsBin
+{
+    UInt32              numBlocks;
+    UInt32              numBlockErrs;
+    UInt32              numCodeBlks;
+    UInt32              numCbCrcFails;
+    UInt32              numTrans;
+    UInt32              numRetrans;
+    UInt64              numBits;
+    UInt64              numBitErrs;
+    UInt64              numGoodBits;    /* Transport block bits of the blocks without error */
+} BcpTest_StatsBin;
+
+/** Max number of record buffers of a vector stream */
+#define     BCP_TEST_VEC_STREAM_MAX_BUFS        8
+
+/** Vector stream opened by vec_stream_open () */
+typedef struct _BcpTest_VecStream BcpTest_VecStream;
+
+/** Vector stream statistics */
+typedef struct _BcpTest_VecStreamStats
+{
+    UInt32              numRecords;     /* Records consumed */
+    UInt32              numStalls;      /* Records not read yet when asked for */
+    UInt64              stallTime;      /* Time waited on them: TSCL cycles on the DSP, ns on the host */
+} BcpTest_VecStreamStats;
+
+/** Packet metadata limits. BCP_TEST_PKT_META_MAX_INFLIGHT must be a power
+ *  of 2.
+ */
+#define     BCP_TEST_PKT_META_PS_WORDS          4
+#define     BCP_TEST_PKT_META_MAX_INFLIGHT      32
+
+/** Metadata of a packet, carried through BCP in its PS words */
+typedef struct _BcpTest_PktMeta
+{
+    UInt16              ueId;
+    UInt8               harqProcId;
+    UInt8               reserved;
+    UInt32              tti;
+    UInt32              submitTime;     /* TSCL at submit */
+    Void*               pRequest;       /* Originating request */
+} BcpTest_PktMeta;
+
+/** Parameter file limits. BCP_TEST_PARAM_HASH_SIZE must be a power of 2,
+ *  and is best kept at twice BCP_TEST_PARAM_MAX_PARAMS or more.
+ */
+#define     BCP_TEST_PARAM_MAX_PARAMS           32
+#define     BCP_TEST_PARAM_HASH_SIZE            64
+#define     BCP_TEST_PARAM_MAX_FILE_SIZE        4096
+
+/** Parameter value types */
+typedef enum _BcpTest_ParamType
+{
+    BcpTest_ParamType_UInt8,
+    BcpTest_ParamType_UInt16,
+    BcpTest_ParamType_UInt32,
+    BcpTest_ParamType_Range             /* "first:last" or a single value */
+} BcpTest_ParamType;
+
+/** Value of a BcpTest_ParamType_Range parameter */
+typedef struct _BcpTest_ParamRange
+{
+    Int32               first;
+    Int32               last;
+} BcpTest_ParamRange;
+
+/** Parameter of a parameter file schema */
+typedef struct _BcpTest_ParamDesc
+{
+    const char*         pKey;
+    BcpTest_ParamType   type;
+    Void*               pDest;
+    Int32               minVal;         /* Valid values, both ends of a range */
+    Int32               maxVal;
+} BcpTest_ParamDesc;
+
+/** Parameter file schema, set up by param_schema_init () */
+typedef struct _BcpTest_ParamSchema
+{
+    const BcpTest_ParamDesc*    pParams;
+    UInt32              numParams;
+    UInt32              hashSeed;
+    UInt8               hashTbl [BCP_TEST_PARAM_HASH_SIZE];     /* Parameter index + 1, 0 if none */
+} BcpTest_ParamSchema;
+
+/** Max number of module headers decoded from a packet, including the
+ *  global header
+ */
+#define     BCP_TEST_HDR_DASM_MAX_MODULES       8
+
+/** Configuration of any BCP module header the tests build */
+typedef union _BcpTest_HdrCfg
+{
+    Bcp_GlobalHdrCfg    glbl;
+    Bcp_TmHdrCfg        tm;
+    Bcp_CrcHdrCfg       crc;
+    Bcp_EncHdrCfg       enc;
+    Bcp_RmHdr_LteCfg    lteRm;
+    Bcp_ModHdrCfg       mod;
+    Bcp_SslHdr_LteCfg   lteSsl;
+    Bcp_RdHdr_LteCfg    lteRd;
+} BcpTest_HdrCfg;
+
+/** Module header decoded by hdr_dasm_decode () */
+typedef struct _BcpTest_HdrDasmMod
+{
+    Int32               modIdx;         /* -1 for an unknown module */
+    const char*         pName;
+    UInt16              wordOffset;
+    UInt16              numWords;
+    BcpTest_HdrCfg      cfg;
+} BcpTest_HdrDasmMod;
 
 
 extern Void read_data_from_file 
@@ -91,6 +364,15 @@ extern Int32 validate_rxdata
     UInt32              rxDataBufferLen, 
     UInt32              dataOffset
 );
+extern Int32 rxdata_diff 
+(
+    const UInt8*        pRefData,
+    const UInt8*        pRxData,
+    UInt32              len,
+    UInt32              dataOffset,
+    BcpTest_RxDiff*     pDiff
+);
+extern Void rxdata_diff_log (const BcpTest_RxDiff* pDiff);
 extern Int32 allocate_fdq 
 (
     Qmss_QueueHnd       hGlblFDQ, 
@@ -108,6 +390,12 @@ extern Void deallocate_fdq
     UInt32              buffSize,
     Qmss_QueueHnd       hHistQ
 );
+extern Void unlink_fdq 
+(
+    Qmss_QueueHnd       hFDQ, 
+    Qmss_QueueHnd       hLinkFDQ, 
+    UInt32              numDesc
+);
 extern Void dump_memory_usage (Void);
 extern Void prepare_crchdr_cfg 
 (
@@ -125,6 +413,7 @@ extern Void prepare_crchdr_cfg
     UInt32*             trChLen
 );
 extern UInt32 convert_coreLocalToGlobalAddr (UInt32 addr);
+extern Void touch_data_buffer (const Void* pDataBuffer, UInt32 dataBufferLen);
 extern Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
 extern Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
 extern Void test_wcdma_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
@@ -134,6 +423,158 @@ extern Void test_wimax_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
 extern Void test_wcdma_rel99_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
 extern Void test_wcdma_rel99_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblQ);
 
+extern BcpTest_HdrTmpl* hdr_tmpl_lookup
+(
+    const UInt32*       pKey,
+    UInt32              keyLen
+);
+extern Int32 hdr_tmpl_create
+(
+    BcpTest_HdrTmpl*    pTmpl,
+    BcpTest_HdrBuildFxn buildFxn,
+    Void*               pArg,
+    UInt32              numFields,
+    const UInt32*       pBaseVal,
+    const UInt8*        pWidth
+);
+extern UInt32 hdr_tmpl_apply
+(
+    const BcpTest_HdrTmpl* pTmpl,
+    const UInt32*       pFieldVal,
+    UInt8*              pDataBuffer
+);
+extern Void hdr_tmpl_flush_cache (Void);
+extern Void hdr_tmpl_register_blobs
+(
+    const BcpTest_HdrBlob*  pBlobs,
+    UInt32              numBlobs
+);
+extern Int32 hdr_tmpl_export_cache
+(
+    FILE*               fpOut,
+    const char*         pName
+);
+
+extern Int32 hdr_dasm_init (Void);
+extern Int32 hdr_dasm_decode
+(
+    const UInt8*        pPkt,
+    UInt32              pktLen,
+    BcpTest_HdrDasmMod* pMod,
+    UInt32              maxMod
+);
+extern Void hdr_dasm_print
+(
+    const BcpTest_HdrDasmMod*   pMod,
+    UInt32              numMod
+);
+extern UInt32 hdr_dasm_diff
+(
+    const BcpTest_HdrDasmMod*   pMod,
+    UInt32              numMod,
+    const BcpTest_HdrDasmMod*   pRef,
+    UInt32              numRef,
+    UInt32              bLog
+);
+extern Int32 hdr_dasm_trace
+(
+    const UInt8*        pPkt,
+    UInt32              pktLen
+);
+
+extern Void pkt_meta_init (Void);
+extern Int32 pkt_meta_submit
+(
+    const BcpTest_PktMeta*  pMeta,
+    UInt32*             pPsWords
+);
+extern BcpTest_PktMeta* pkt_meta_lookup
+(
+    const UInt8*        pPsInfo,
+    UInt32              psInfoLen
+);
+extern Void pkt_meta_release (BcpTest_PktMeta* pMeta);
+extern UInt32 pkt_meta_num_inflight (Void);
+
+extern Int32 vec_load
+(
+    const char*         pFileName,
+    BcpTest_Vec*        pVec
+);
+extern Void vec_release (BcpTest_Vec* pVec);
+extern Int32 vec_read_words
+(
+    const char*         pFileName,
+    UInt32              firstWord,
+    UInt32              numWords,
+    UInt32*             pWords
+);
+extern BcpTest_VecStream* vec_stream_open
+(
+    const char*         pFileName,
+    UInt32              recordWords,
+    UInt32              numBufs
+);
+extern const UInt32* vec_stream_get
+(
+    BcpTest_VecStream*  pStream,
+    UInt32*             pNumWords
+);
+extern Void vec_stream_put (BcpTest_VecStream* pStream);
+extern Int32 vec_stream_close
+(
+    BcpTest_VecStream*  pStream,
+    BcpTest_VecStreamStats* pStats
+);
+
+extern Int32 param_schema_init
+(
+    BcpTest_ParamSchema*        pSchema,
+    const BcpTest_ParamDesc*    pParams,
+    UInt32                      numParams
+);
+extern Int32 param_parse
+(
+    const BcpTest_ParamSchema*  pSchema,
+    const Char*         pText,
+    UInt32              textLen
+);
+extern Int32 param_parse_file (const BcpTest_ParamSchema* pSchema, FILE* fp);
+
+extern Void golden_expand
+(
+    const BcpTest_Golden*   pGolden,
+    UInt32              firstWord,
+    UInt32              numWords,
+    UInt32*             pOut
+);
+extern Int32 golden_validate
+(
+    const BcpTest_Golden*   pGolden,
+    const UInt8*        pRxDataBuffer,
+    UInt32              rxDataBufferLen,
+    UInt32              dataOffset
+);
+extern Void digest_check_start
+(
+    BcpTest_DigestCheck*    pCheck,
+    const BcpTest_Digest*   pDigest
+);
+extern Int32 digest_check_data
+(
+    BcpTest_DigestCheck*    pCheck,
+    const UInt8*        pRxDataBuffer,
+    UInt32              rxDataBufferLen,
+    UInt32              dataOffset
+);
+extern Int32 digest_check_end (BcpTest_DigestCheck* pCheck);
+
+extern Void stats_init (Void);
+extern Int32 stats_cfg_id (const char* pName);
+extern Void stats_add_block (UInt32 cfgId, const BcpTest_StatsBlock* pBlock);
+extern Void stats_flush (Void);
+extern Int32 stats_report (FILE* fp);
+
 extern Void read_harq_data_from_file (FILE* fp, UInt8* pDataBuffer, UInt32* pDataBufferLen);
 extern Int32 validate_harqoutput 
 (
@@ -143,6 +584,15 @@ extern Int32 validate_harqoutput
     UInt32              rxDataBufferLen, 
     UInt32              dataOffset
 );
+extern Int32 validate_harqoutput_llr
+(
+    UInt32*             pRefDataBuffer,
+    UInt32              refDataBufferLen,
+    UInt32*             pRxDataBuffer, 
+    UInt32              rxDataBufferLen, 
+    UInt32              dataOffset,
+    UInt8               llrTol
+);
 
 #endif  /* _BCP_TEST_H_ */
 
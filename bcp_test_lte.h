@@ -56,4 +56,215 @@ typedef struct _BcpTest_RateMatchParams
 	UInt32      NcbKpRow;
 } BcpTest_RateMatchParams;
 
+/* PUSCH channel interleaver configuration */
+#define LTE_CHINTLV_NUM_COLSET          4
+#define LTE_CHINTLV_CACHE_SIZE          4
+
+typedef struct _BcpTest_LteChIntlvProg
+{
+    UInt16       numRows;        /* R'mux, number of sub-carriers */
+    UInt8        numCols;        /* C'mux, number of SC-FDMA symbols */
+    UInt8        bExtendedCp;
+    UInt16       numRi;          /* Q'RI */
+    UInt16       numAck;         /* Q'ACK */
+    UInt32       numData;        /* H' = H'' - Q'RI, data + CQI symbols */
+    UInt32       numSlots;       /* numData + numRi + numAck */
+    UInt16*      pFwdIdx;        /* Matrix position -> source slot */
+    UInt16*      pInvIdx;        /* Source slot -> matrix position */
+    UInt16*      pPuncIdx;       /* Data slots punctured by ACK */
+    UInt32       lastUsed;
+} BcpTest_LteChIntlvProg;
+
+extern BcpTest_LteChIntlvProg* lte_chintlv_get_prog
+(
+    UInt16                      numRows,
+    UInt8                       numCols,
+    UInt16                      numRi,
+    UInt16                      numAck
+);
+extern Void lte_chintlv_interleave
+(
+    BcpTest_LteChIntlvProg*     pProg,
+    UInt8*                      pSrc,
+    UInt8*                      pDst,
+    UInt32                      symSize
+);
+extern Void lte_chintlv_deinterleave
+(
+    BcpTest_LteChIntlvProg*     pProg,
+    UInt8*                      pSrc,
+    UInt8*                      pDst,
+    UInt32                      symSize
+);
+extern Void lte_chintlv_flush_cache (Void);
+
+/* Layer mapping */
+#define LTE_MAX_NUM_LAYERS              2
+
+extern Void lte_layer_map
+(
+    UInt32*                     pCw0,
+    UInt32*                     pCw1,
+    UInt32                      numLayerSymb,
+    UInt32*                     pLayer0,
+    UInt32*                     pLayer1
+);
+extern Void lte_layer_demap
+(
+    UInt32*                     pLayer0,
+    UInt32*                     pLayer1,
+    UInt32                      numLayerSymb,
+    UInt32*                     pCw0,
+    UInt32*                     pCw1
+);
+
+/* Hard modulator, compressed mode output expansion */
+extern UInt16 lte_mod_hard_uva
+(
+    UInt8                       mod,
+    UInt16                      rms
+);
+extern UInt32 lte_mod_packed_size
+(
+    UInt32                      numSymb,
+    UInt8                       mod
+);
+extern Void lte_mod_expand
+(
+    const UInt32*               pPacked,
+    UInt32                      numSymb,
+    UInt8                       mod,
+    UInt16                      uva,
+    UInt32*                     pOut
+);
+extern Void lte_mod_soft_symbols
+(
+    const Int8*                 pLlr,
+    UInt32                      numSymb,
+    UInt8                       mod,
+    UInt8                       qFmt,
+    UInt16                      uva,
+    UInt32*                     pOut
+);
+
+/* Transport channel bit processing reference */
+extern Void lte_ref_gold_seq
+(
+    UInt32                      cinit,
+    UInt32                      len,
+    UInt32*                     pSeq
+);
+extern Void lte_ref_rate_match
+(
+    const Int8*                 pD0,
+    const Int8*                 pD1,
+    const Int8*                 pD2,
+    UInt32                      D,
+    UInt32                      numFiller,
+    UInt32                      Ncb,
+    UInt8                       rvIdx,
+    UInt32                      E,
+    Int8*                       pOut
+);
+
+/* DL chain model, the module header configurations of a DL packet. The CRC
+ * header local_hdr_len is 0 for a packet without a CRC module header.
+ */
+typedef struct _BcpTest_LteRefChainCfg
+{
+    Bcp_CrcHdrCfg               crc;
+    Bcp_EncHdrCfg               enc;
+    Bcp_RmHdr_LteCfg            lteRm;
+    Bcp_ModHdrCfg               mod;
+} BcpTest_LteRefChainCfg;
+
+typedef struct _BcpTest_LteRefJob BcpTest_LteRefJob;
+
+extern UInt32 lte_ref_dl_out_len
+(
+    const BcpTest_LteRefChainCfg*   pCfg
+);
+extern Int32 lte_ref_dl_chain
+(
+    const BcpTest_LteRefChainCfg*   pCfg,
+    const UInt8*                pPayload,
+    UInt32*                     pOut
+);
+extern BcpTest_LteRefJob* lte_ref_dl_start
+(
+    const BcpTest_LteRefChainCfg*   pCfg,
+    const UInt8*                pPayload
+);
+extern const UInt32* lte_ref_dl_wait
+(
+    BcpTest_LteRefJob*          pJob,
+    UInt32*                     pOutLen
+);
+extern Void lte_ref_dl_release
+(
+    BcpTest_LteRefJob*          pJob
+);
+
+/* PDSCH grant, the inputs of one DL BCP packet */
+typedef struct _BcpTest_LteDlGrant
+{
+    UInt32       tbSize;
+    UInt32       numBitsG;       /* G, number of coded bits */
+    UInt32       Nir;            /* Soft buffer size */
+    UInt16       rnti;
+    UInt16       cellID;
+    UInt8        modulation;
+    UInt8        numLayers;
+    UInt8        rvIdx;
+    UInt8        codeWordIdx;
+    UInt8        ns;             /* Slot number */
+    UInt8        flowId;         /* Rx flow of the BCP output */
+    UInt8        harqProcId;
+    UInt32       tti;
+    const UInt8* pPayload;       /* Transport block, NULL if added by the caller */
+    UInt32       payloadLen;     /* Bytes */
+} BcpTest_LteDlGrant;
+
+/* UCI resources of one PUSCH allocation */
+typedef struct _BcpTest_LteUciRes
+{
+    /* Inputs */
+    UInt32       sumKr;          /* Sum of the code block sizes */
+    UInt16       numPrb;
+    UInt8        numSymb;        /* SC-FDMA symbols in the subframe */
+    UInt8        numAckBits;
+    UInt8        ackIdx;
+    UInt8        numRiBits;
+    UInt8        riIdx;
+    UInt8        numCqiBits;     /* O + L */
+    UInt8        cqiIdx;
+
+    /* Outputs */
+    UInt16       numAckSubcs;    /* Q'ACK */
+    UInt16       numRiSubcs;     /* Q'RI */
+    UInt16       numCqiSubcs;    /* Q'CQI */
+} BcpTest_LteUciRes;
+
+extern Void lte_uci_compute_res
+(
+    BcpTest_LteUciRes*          pRes,
+    UInt32                      numUe
+);
+
+/* Short CQI (32, O) block code */
+extern Void lte_uci_rm32_encode
+(
+    const UInt16*               pCqi,
+    UInt32                      numUe,
+    UInt32*                     pCode
+);
+extern Void lte_uci_rm32_decode
+(
+    const Int8*                 pLlr,
+    UInt32                      numLlr,
+    UInt32                      numUe,
+    UInt8                       numBits,
+    UInt16*                     pCqi
+);
+
 #endif /* _BCP_TEST_LTE_H_ */
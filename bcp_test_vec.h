@@ -0,0 +1,73 @@
+/**
+ *   @file  bcp_test_vec.h
+ *
+ *   @brief
+ *      Binary test vector container.
+ *
+ *      A test vector file is a 64 byte header followed by the vector words,
+ *      starting at a 64 byte aligned offset. The host maps a file and the
+ *      DSP reads it with one block read, and the words are used in place.
+ *      Files are written by tools/vec_conv.c from the text vectors in lte/.
+ *
+ *      Only standard C types are used here, as the header is shared with
+ *      the host converter.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#ifndef _BCP_TEST_VEC_H_
+#define _BCP_TEST_VEC_H_
+
+#include <stdint.h>
+
+/** 'BVEC' */
+#define     BCP_TEST_VEC_MAGIC                  0x42564543u
+#define     BCP_TEST_VEC_VERSION                1
+
+/** Written as a native word. Reads back byte swapped from a file written
+ *  on a target of the other endianness.
+ */
+#define     BCP_TEST_VEC_ENDIAN_TAG             0x01020304u
+
+/** Header size, and alignment of the vector words in the file */
+#define     BCP_TEST_VEC_ALIGN                  64
+#define     BCP_TEST_VEC_NAME_LEN               40
+
+/** Vector word formats */
+#define     BCP_TEST_VEC_FMT_WORDS              0   /* 32 bit words, byte swapped to the target endianness */
+#define     BCP_TEST_VEC_FMT_BYTES              1   /* Byte stream, stored as is */
+
+/** Test vector file header */
+typedef struct _BcpTest_VecHdr
+{
+    uint32_t            magic;
+    uint32_t            endianTag;
+    uint16_t            version;
+    uint16_t            format;
+    uint32_t            numWords;
+    uint32_t            dataOffset;     /* Bytes from the start of the file */
+    uint32_t            checksum;       /* Of the words, see BCP_TEST_VEC_CKSUM_STEP */
+    char                name [BCP_TEST_VEC_NAME_LEN];   /* Source file name, NUL terminated */
+} BcpTest_VecHdr;
+
+/** Checksum of the vector words, read in the byte order of the target that
+ *  wrote the file. Starts at 0 and takes in one word at a time.
+ */
+#define     BCP_TEST_VEC_CKSUM_STEP(cksum, word)    ((((cksum) << 5) | ((cksum) >> 27)) ^ (uint32_t) (word))
+
+/** Byte swap of a word */
+#define     BCP_TEST_VEC_SWAP32(a)              ((((a) >> 24) & 0xff) | (((a) >> 8) & 0xff00) | \
+                                                 (((a) << 8) & 0xff0000) | (((a) << 24) & 0xff000000))
+
+/** Golden output digest: a 64 bit hash of each chunk of the output, kept
+ *  as two 32 bit lanes. Each lane starts at its seed and takes in one word
+ *  at a time, as read in the byte order of the target. A last chunk that
+ *  ends within a word is padded with zero bytes.
+ */
+#define     BCP_TEST_DIGEST_CHUNK_BYTES         1024
+#define     BCP_TEST_DIGEST_SEED_LO             0x811c9dc5u
+#define     BCP_TEST_DIGEST_SEED_HI             0x6a09e667u
+#define     BCP_TEST_DIGEST_STEP_LO(hash, word) (((hash) ^ (uint32_t) (word)) * 0x01000193u)
+#define     BCP_TEST_DIGEST_STEP_HI(hash, word) (((((hash) << 7) | ((hash) >> 25)) + (uint32_t) (word)) * 0x9e3779b1u)
+
+#endif  /* _BCP_TEST_VEC_H_ */
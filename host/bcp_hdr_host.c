@@ -0,0 +1,194 @@
+/**
+ *   @file  bcp_hdr_host.c
+ *
+ *   @brief
+ *      Host stand-ins for the BCP LLD header packing functions,
+ *      Bcp_add*Header (), for the host checks of the header template, header
+ *      disassembler and packet build code, see host/bcp_host.h.
+ *
+ *      The word layout is not that of the device, which is in the LLD and
+ *      not in this tree, but has the properties the test code relies on:
+ *
+ *      -   Every module header but the global one carries a module id in
+ *          bits 8 - 11 of its first word, and local_hdr_len, if it has one,
+ *          in bits 0 - 7.
+ *
+ *      -   Each module header has a fixed size, which local_hdr_len + 1
+ *          words should match: CRC 4 (one block), encoder 4, rate
+ *          matching 7, modulator 5, soft slicer 16 and rate dematching 8
+ *          words, as set by the LTE tests. The global and TM headers are 2
+ *          words.
+ *
+ *      -   Each field packed has bits of its own, the low bits of its value,
+ *          in one word. Fields the LTE tests leave 0 may not be packed.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Module ids */
+#define     BCP_HDR_HOST_ID_CRC                 1
+#define     BCP_HDR_HOST_ID_ENC                 2
+#define     BCP_HDR_HOST_ID_LTE_RM              3
+#define     BCP_HDR_HOST_ID_MOD                 4
+#define     BCP_HDR_HOST_ID_LTE_SSL             5
+#define     BCP_HDR_HOST_ID_LTE_RD              6
+#define     BCP_HDR_HOST_ID_TM                  7
+
+/* Low width bits of a value, at bit shift of a word */
+#define BCP_HDR_HOST_FLD(val, width, shift)                                 \
+    (((UInt32) (val) & (UInt32) ((1ull << (width)) - 1)) << (shift))
+
+/* First word of a module header */
+#define BCP_HDR_HOST_W0(len, id)                                            \
+    (BCP_HDR_HOST_FLD (len, 8, 0) | BCP_HDR_HOST_FLD (id, 4, 8))
+
+/* Writes a module header of numWords words */
+static Int32 bcp_hdr_host_write (const UInt32* pWords, UInt32 numWords, UInt8* pData, UInt32* pLen)
+{
+    if (pData == NULL || pLen == NULL)
+        return -1;
+
+    memcpy (pData, pWords, numWords * 4);
+    *pLen   +=  numWords * 4;
+
+    return 0;
+}
+
+Int32 Bcp_addGlobalHeader (Bcp_GlobalHdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [2];
+
+    w [0]   =   BCP_HDR_HOST_FLD (pCfg->pkt_type, 2, 0) | BCP_HDR_HOST_FLD (pCfg->flush, 1, 2) |
+                BCP_HDR_HOST_FLD (pCfg->drop, 1, 3) | BCP_HDR_HOST_FLD (pCfg->halt, 1, 4) |
+                BCP_HDR_HOST_FLD (pCfg->radio_standard, 3, 5) | BCP_HDR_HOST_FLD (pCfg->hdr_end_ptr, 8, 8) |
+                BCP_HDR_HOST_FLD (pCfg->flow_id, 8, 16);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->destn_tag, 16, 0);
+
+    return bcp_hdr_host_write (w, 2, pData, pLen);
+}
+
+Int32 Bcp_addTMHeader (Bcp_TmHdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [2];
+
+    w [0]   =   BCP_HDR_HOST_FLD (pCfg->ps_data_size, 3, 0) | BCP_HDR_HOST_FLD (pCfg->info_data_size, 4, 4) |
+                BCP_HDR_HOST_FLD (BCP_HDR_HOST_ID_TM, 4, 8);
+    w [1]   =   0;
+
+    return bcp_hdr_host_write (w, 2, pData, pLen);
+}
+
+Int32 Bcp_addCRCHeader (Bcp_CrcHdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [4];
+
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_CRC) |
+                BCP_HDR_HOST_FLD (pCfg->filler_bits, 8, 12) | BCP_HDR_HOST_FLD (pCfg->bit_order, 1, 20) |
+                BCP_HDR_HOST_FLD (pCfg->dtx_format, 1, 21);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->num_scramble_sys, 24, 0);
+    w [2]   =   BCP_HDR_HOST_FLD (pCfg->method2_id, 6, 0);
+    w [3]   =   BCP_HDR_HOST_FLD (pCfg->va_blk_len, 16, 0) | BCP_HDR_HOST_FLD (pCfg->va_crc, 3, 16) |
+                BCP_HDR_HOST_FLD (pCfg->va_blks, 9, 20);
+
+    return bcp_hdr_host_write (w, 4, pData, pLen);
+}
+
+Int32 Bcp_addEncoderHeader (Bcp_EncHdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    const Bcp_EncBlockCfg*  pBlk = &pCfg->blockCfg [0];
+    UInt32              w [4];
+
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_ENC) |
+                BCP_HDR_HOST_FLD (pCfg->turbo_conv_sel, 1, 12) | BCP_HDR_HOST_FLD (pCfg->scr_crc_en, 1, 13) |
+                BCP_HDR_HOST_FLD (pCfg->code_rate_flag, 1, 14);
+    w [1]   =   BCP_HDR_HOST_FLD (pBlk->block_size, 13, 0) | BCP_HDR_HOST_FLD (pBlk->num_code_blks, 8, 16);
+    w [2]   =   BCP_HDR_HOST_FLD (pBlk->intvpar0, 13, 0) | BCP_HDR_HOST_FLD (pBlk->intvpar1, 9, 16);
+    w [3]   =   BCP_HDR_HOST_FLD (pBlk->intvpar2, 13, 0) | BCP_HDR_HOST_FLD (pBlk->intvpar3, 13, 16);
+
+    return bcp_hdr_host_write (w, 4, pData, pLen);
+}
+
+Int32 Bcp_addLte_RMHeader (Bcp_RmHdr_LteCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [7];
+
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_LTE_RM) |
+                BCP_HDR_HOST_FLD (pCfg->input_bit_format, 1, 12) | BCP_HDR_HOST_FLD (pCfg->output_bit_format, 1, 13) |
+                BCP_HDR_HOST_FLD (pCfg->num_filler_bits_f, 6, 14) | BCP_HDR_HOST_FLD (pCfg->channel_type, 1, 20);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->rv_start_column1, 6, 0) | BCP_HDR_HOST_FLD (pCfg->rv_start_column2, 6, 8) |
+                BCP_HDR_HOST_FLD (pCfg->param_ncb1_column, 5, 16) | BCP_HDR_HOST_FLD (pCfg->param_ncb1_row, 8, 24);
+    w [2]   =   BCP_HDR_HOST_FLD (pCfg->num_code_blocks_c1, 7, 0) | BCP_HDR_HOST_FLD (pCfg->block_size_k1, 13, 16);
+    w [3]   =   BCP_HDR_HOST_FLD (pCfg->num_code_blocks_c2, 7, 0) | BCP_HDR_HOST_FLD (pCfg->block_size_k2, 13, 16);
+    w [4]   =   BCP_HDR_HOST_FLD (pCfg->block_size_e1, 17, 0) | BCP_HDR_HOST_FLD (pCfg->num_code_blocks_ce1, 7, 24);
+    w [5]   =   BCP_HDR_HOST_FLD (pCfg->block_size_e2, 17, 0) | BCP_HDR_HOST_FLD (pCfg->num_code_blocks_ce2, 7, 24);
+    w [6]   =   BCP_HDR_HOST_FLD (pCfg->param_ncb2_column, 5, 0) | BCP_HDR_HOST_FLD (pCfg->param_ncb2_row, 8, 8);
+
+    return bcp_hdr_host_write (w, 7, pData, pLen);
+}
+
+Int32 Bcp_addModulatorHeader (Bcp_ModHdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [5];
+
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_MOD) | BCP_HDR_HOST_FLD (pCfg->uva_val, 16, 16);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->mod_type_sel, 3, 0) | BCP_HDR_HOST_FLD (pCfg->cmux_ln, 3, 4) |
+                BCP_HDR_HOST_FLD (pCfg->q_format, 2, 8) | BCP_HDR_HOST_FLD (pCfg->b_table_index, 2, 10) |
+                BCP_HDR_HOST_FLD (pCfg->jack_bit, 1, 12) | BCP_HDR_HOST_FLD (pCfg->split_mode_en, 1, 13) |
+                BCP_HDR_HOST_FLD (pCfg->scr_en, 1, 14) | BCP_HDR_HOST_FLD (pCfg->sh_mod_sel, 1, 15) |
+                BCP_HDR_HOST_FLD (pCfg->rmux_ln, 14, 16);
+    w [2]   =   BCP_HDR_HOST_FLD (pCfg->cqi_ln, 16, 0) | BCP_HDR_HOST_FLD (pCfg->ri_ln, 8, 16) |
+                BCP_HDR_HOST_FLD (pCfg->ack_ln, 8, 24);
+    w [3]   =   BCP_HDR_HOST_FLD (pCfg->cinit_p2, 31, 0);
+    w [4]   =   0;
+
+    return bcp_hdr_host_write (w, 5, pData, pLen);
+}
+
+Int32 Bcp_addLTE_SSLHeader (Bcp_SslHdr_LteCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    const Bcp_SslModeSelCfg*    pMode = &pCfg->modeSelCfg;
+    UInt32              w [16];
+    UInt32              i;
+
+    memset (w, 0, sizeof (w));
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_LTE_SSL) |
+                BCP_HDR_HOST_FLD (pMode->split_mode_en, 1, 12) | BCP_HDR_HOST_FLD (pMode->jack_bit, 1, 13) |
+                BCP_HDR_HOST_FLD (pMode->lte_descrambler_en, 1, 14) | BCP_HDR_HOST_FLD (pMode->mod_type_sel, 3, 15) |
+                BCP_HDR_HOST_FLD (pMode->cmux_ln, 4, 18) | BCP_HDR_HOST_FLD (pMode->q_format, 2, 22) |
+                BCP_HDR_HOST_FLD (pMode->b_matrix_sel, 1, 24) | BCP_HDR_HOST_FLD (pMode->rmux_ln_index, 6, 25);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->ri_ln, 10, 0) | BCP_HDR_HOST_FLD (pCfg->ack_ln, 8, 12) |
+                BCP_HDR_HOST_FLD (pCfg->uva, 5, 20);
+    w [2]   =   BCP_HDR_HOST_FLD (pCfg->cinit_p2, 31, 0);
+
+    /* Scale factors, 8 bits each, 4 per word */
+    for (i = 0; i < 14; i ++)
+    {
+        w [3 + i / 4]   |=  BCP_HDR_HOST_FLD (pCfg->scale_c0 [i], 8, (i & 3) * 8);
+        w [7 + i / 4]   |=  BCP_HDR_HOST_FLD (pCfg->scale_c1 [i], 8, (i & 3) * 8);
+    }
+
+    return bcp_hdr_host_write (w, 16, pData, pLen);
+}
+
+Int32 Bcp_addLTE_RDHeader (Bcp_RdHdr_LteCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    UInt32              w [8];
+
+    w [0]   =   BCP_HDR_HOST_W0 (pCfg->local_hdr_len, BCP_HDR_HOST_ID_LTE_RD) |
+                BCP_HDR_HOST_FLD (pCfg->cqi_pass_through, 1, 12) | BCP_HDR_HOST_FLD (pCfg->rv_start_column, 2, 13) |
+                BCP_HDR_HOST_FLD (pCfg->num_filler_bits_f, 6, 15) | BCP_HDR_HOST_FLD (pCfg->enable_harq_input, 1, 21) |
+                BCP_HDR_HOST_FLD (pCfg->enable_harq_output, 1, 22) | BCP_HDR_HOST_FLD (pCfg->tcp3d_dyn_range, 1, 23);
+    w [1]   =   BCP_HDR_HOST_FLD (pCfg->num_code_blocks_c1, 7, 0) | BCP_HDR_HOST_FLD (pCfg->block_size_k1, 13, 16);
+    w [2]   =   BCP_HDR_HOST_FLD (pCfg->num_code_blocks_c2, 7, 0) | BCP_HDR_HOST_FLD (pCfg->block_size_k2, 13, 16);
+    w [3]   =   BCP_HDR_HOST_FLD (pCfg->block_size_e1, 17, 0) | BCP_HDR_HOST_FLD (pCfg->num_code_blocks_ce1, 7, 24);
+    w [4]   =   BCP_HDR_HOST_FLD (pCfg->block_size_e2, 17, 0) | BCP_HDR_HOST_FLD (pCfg->num_code_blocks_ce2, 7, 24);
+    w [5]   =   pCfg->harq_input_address;
+    w [6]   =   pCfg->harq_output_address;
+    w [7]   =   BCP_HDR_HOST_FLD (pCfg->init_cb_flowId, 6, 0) | BCP_HDR_HOST_FLD (pCfg->flowId_hi, 4, 6) |
+                BCP_HDR_HOST_FLD (pCfg->flowId_cqi_offset, 6, 10) | BCP_HDR_HOST_FLD (pCfg->tcp3d_scale_factor, 4, 16) |
+                BCP_HDR_HOST_FLD (pCfg->block_size_outq_cqi, 8, 20);
+
+    return bcp_hdr_host_write (w, 8, pData, pLen);
+}
@@ -0,0 +1,127 @@
+/**
+ *   @file  bcp_host.c
+ *
+ *   @brief
+ *      Host implementation of the OSAL of the tests (see bcp_osal.h),
+ *      System_printf (), the chip register reads and the interrupt enable
+ *      calls, to run the test sources on a Linux host. See host/bcp_host.h.
+ *
+ *      Memory comes from @a qmss_emu_alloc (), in the low 4 GB, so that
+ *      buffers allocated by the tests can be attached to descriptors of the
+ *      QMSS/CPPI emulation. There is no cache, so the cache coherence calls
+ *      do nothing, and a single process holds all "cores", so the multicore
+ *      critical section is a process wide lock.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <pthread.h>
+#include "bcp_test.h"
+
+/* Time stamp counter, see c6x.h */
+volatile UInt32         TSCL, TSCH;
+
+/* Multicore and interrupt critical sections */
+static pthread_mutex_t  bcpHostCsLock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+Int System_printf (const Char* pFmt, ...)
+{
+    va_list             args;
+    Int                 retVal;
+
+    va_start (args, pFmt);
+    retVal  =   vprintf (pFmt, args);
+    va_end (args);
+
+    return retVal;
+}
+
+UInt32 CSL_chipReadReg (CSL_ChipReg reg)
+{
+    (Void) reg;
+
+    return 0;
+}
+
+/* Interrupts are never taken on the host, so there is nothing to mask */
+UInt32 Hwi_disable (Void)
+{
+    return 0;
+}
+
+Void Hwi_restore (UInt32 key)
+{
+    (Void) key;
+
+    return;
+}
+
+Void* Osal_biosMalloc (UInt32 num_bytes, Bool bGlobalAddress)
+{
+    (Void) bGlobalAddress;
+
+    return qmss_emu_alloc (num_bytes, 16);
+}
+
+Void Osal_biosFree (Void* dataPtr, UInt32 num_bytes, Bool bGlobalAddress)
+{
+    (Void) bGlobalAddress;
+
+    qmss_emu_free (dataPtr, num_bytes);
+
+    return;
+}
+
+Void Osal_biosMultiCoreCsEnter ()
+{
+    pthread_mutex_lock (&bcpHostCsLock);
+
+    return;
+}
+
+Void Osal_biosMultiCoreCsExit ()
+{
+    pthread_mutex_unlock (&bcpHostCsLock);
+
+    return;
+}
+
+Void Osal_biosInterruptCsEnter ()
+{
+    pthread_mutex_lock (&bcpHostCsLock);
+
+    return;
+}
+
+Void Osal_biosInterruptCsExit ()
+{
+    pthread_mutex_unlock (&bcpHostCsLock);
+
+    return;
+}
+
+Void Osal_bcpBeginMemAccess (Void* pBlockPtr, UInt32 byteCnt)
+{
+    (Void) pBlockPtr;
+    (Void) byteCnt;
+
+    return;
+}
+
+Void Osal_bcpEndMemAccess (Void* pBlockPtr, UInt32 byteCnt)
+{
+    (Void) pBlockPtr;
+    (Void) byteCnt;
+
+    return;
+}
+
+Void Osal_bcpBeginDescMemAccess (Void* hRx, Void* pBlockPtr)
+{
+    (Void) hRx;
+    (Void) pBlockPtr;
+
+    return;
+}
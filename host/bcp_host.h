@@ -0,0 +1,98 @@
+/**
+ *   @file  bcp_host.h
+ *
+ *   @brief
+ *      Host stand-ins for the XDC runtime, SYS/BIOS, IPC and chip CSL
+ *      headers included by the tests.
+ *
+ *      The headers under host/xdc and host/ti stand in for those of XDC,
+ *      BIOS, IPC, CSL and the PDK, so that the tests build with a host
+ *      compiler. All but the QMSS/CPPI ones (host/qmss_emu.h) and the BCP
+ *      LLD one (host/ti/drv/bcp/bcp.h) only include this header. Only what
+ *      the tests use is declared.
+ *
+ *      host/bcp_host.c implements the BCP OSAL of the tests, System_printf
+ *      () and the chip register reads on the host, and host/bcp_hdr_host.c
+ *      the BCP LLD header packing. BIOS tasks, semaphores and interrupts,
+ *      IPC and the rest of the BCP LLD are declared only: the host checks
+ *      under host/ link the test sources that do not call them.
+ *
+ *      Usage: gcc -no-pie -I host -I . ... host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *
+ *  \par
+ *  ============================================================================
+*/
+#ifndef _BCP_HOST_H_
+#define _BCP_HOST_H_
+
+#include <xdc/std.h>
+#include <stdio.h>
+
+/**************************************************************
+ *********************** XDC runtime **************************
+ **************************************************************/
+
+typedef struct _Error_Block
+{
+    Int         id;
+} Error_Block;
+
+extern Int System_printf (const Char* pFmt, ...);
+
+/**************************************************************
+ ************************* SYS/BIOS ***************************
+ **************************************************************/
+
+#define     BIOS_WAIT_FOREVER                   (~(UInt32) 0)
+#define     BIOS_NO_WAIT                        0
+
+typedef Void*   Task_Handle;
+typedef Void    (*Task_FuncPtr) (UArg arg0, UArg arg1);
+
+typedef struct _Task_Params
+{
+    Int         priority;
+    size_t      stackSize;
+    UArg        arg0;
+    UArg        arg1;
+} Task_Params;
+
+extern Void         Task_Params_init (Task_Params* pParams);
+extern Task_Handle  Task_create (Task_FuncPtr fxn, Task_Params* pParams, Error_Block* pEb);
+extern Void         Task_delete (Task_Handle* pHandle);
+extern Task_Handle  Task_self (Void);
+extern Int          Task_getPri (Task_Handle handle);
+extern Void         Task_sleep (UInt32 numTicks);
+extern Void         Task_yield (Void);
+extern Void         Task_exit (Void);
+
+typedef Void*   Semaphore_Handle;
+
+extern Semaphore_Handle Semaphore_create (Int count, Void* pParams, Error_Block* pEb);
+extern Void         Semaphore_delete (Semaphore_Handle* pHandle);
+extern Bool         Semaphore_pend (Semaphore_Handle handle, UInt32 timeout);
+extern Void         Semaphore_post (Semaphore_Handle handle);
+
+extern UInt32       Hwi_disable (Void);
+extern Void         Hwi_restore (UInt32 key);
+extern Void         Hwi_eventMap (Int vectorNum, Int eventId);
+extern Void         Hwi_enableInterrupt (Int vectorNum);
+
+typedef Void    (*EventCombiner_FuncPtr) (UArg arg);
+
+extern Void         EventCombiner_dispatchPlug (Int eventId, EventCombiner_FuncPtr fxn, UArg arg, Bool unmask);
+extern Void         EventCombiner_enableEvent (Int eventId);
+
+/**************************************************************
+ ************************* Chip CSL ***************************
+ **************************************************************/
+
+typedef enum
+{
+    CSL_CHIP_DNUM   =   0
+} CSL_ChipReg;
+
+/** Reads a chip register. DNUM, the core number, is 0 on the host. */
+extern UInt32 CSL_chipReadReg (CSL_ChipReg reg);
+
+#endif /* _BCP_HOST_H_ */
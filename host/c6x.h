@@ -0,0 +1,38 @@
+/**
+ *   @file  c6x.h
+ *
+ *   @brief
+ *      Host stand-in for the C6000 compiler header of the same name: the
+ *      time stamp counter, which does not count on the host, and the
+ *      intrinsics used by the tests outside their _TMS320C6X branches.
+ *      See host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _C6X_H_
+#define _C6X_H_
+
+#include <xdc/std.h>
+
+/** Time stamp counter, set and read as on the device, always 0 on the host */
+extern volatile UInt32  TSCL, TSCH;
+
+/** Bit reverse */
+static inline UInt32 _bitr (UInt32 src)
+{
+    UInt32  dst = 0;
+    Int     i;
+
+    for (i = 0; i < 32; i ++)
+        dst |=  ((src >> i) & 1) << (31 - i);
+
+    return dst;
+}
+
+/** Extracts bits: shifts left by csta, then right (logical) by cstb */
+static inline UInt32 _extu (UInt32 src, UInt32 csta, UInt32 cstb)
+{
+    return (src << csta) >> cstb;
+}
+
+#endif /* _C6X_H_ */
@@ -0,0 +1,414 @@
+/**
+ *   @file  hdr_dasm_check.c
+ *
+ *   @brief
+ *      Host check of the header chain disassembler (test_hdr_dasm.c), run
+ *      with the stand-in header packers of host/bcp_hdr_host.c:
+ *
+ *      -   Random DL (CRC, encoder, rate matching, modulator) and UL (soft
+ *          slicer, rate dematching) chains, between a global and a TM
+ *          header, decode to the modules built, in order, and the decoded
+ *          configurations pack back to the same header words.
+ *
+ *      -   hdr_dasm_diff () finds no difference between a chain and itself,
+ *          and, for a DL and an UL chain out of every
+ *          HDR_DASM_CHECK_DIFF_EVERY, exactly the two fields changed in a
+ *          copy, without logging them.
+ *
+ *      -   The DL chain of lte/pdsch_parameters_DV021.dat, built by
+ *          add_dl_grant () of test_lte_dl.c, decodes to the field values
+ *          worked out by hand from 3GPP TS 36.212 for that configuration,
+ *          written out below.
+ *
+ *      -   The time per decode of a DL chain, on the host.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -ffunction-sections -Wl,--gc-sections -I host -I . -o hdr_dasm_check
+ *          host/hdr_dasm_check.c test_hdr_dasm.c test_common.c test_hdr_tmpl.c test_pkt_meta.c
+ *          test_lte_mod.c test_param.c host/bcp_hdr_host.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./hdr_dasm_check
+ *
+ *      The DL test source is included so that its static functions can be
+ *      called; the test functions that need BIOS or the BCP LLD are left out
+ *      by the linker.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdlib.h>
+#include <time.h>
+#include "test_lte_dl.c"
+
+/* Chains built, and decodes timed */
+#define     HDR_DASM_CHECK_NUM_CHAINS           2000
+#define     HDR_DASM_CHECK_NUM_DECODES          200000
+
+/* Chains diffed against a changed copy, each diff logging its fields */
+#define     HDR_DASM_CHECK_DIFF_EVERY           100
+
+/* Max size of a header chain, in words */
+#define     HDR_DASM_CHECK_MAX_WORDS            64
+
+/* Module headers of a DL and of an UL chain, global and TM headers included */
+#define     HDR_DASM_CHECK_DL_MODULES           6
+#define     HDR_DASM_CHECK_UL_MODULES           4
+
+static const char* const hdrDasmCheckDlNames [HDR_DASM_CHECK_DL_MODULES] = {"GLBL", "CRC", "ENC", "RM", "MOD", "TM"};
+static const char* const hdrDasmCheckUlNames [HDR_DASM_CHECK_UL_MODULES] = {"GLBL", "SSL", "RD", "TM"};
+
+/* Disassembler module index of each DL module header, see
+ * hdr_dasm_check_add ()
+ */
+static const Int32 hdrDasmCheckDlModIdx [HDR_DASM_CHECK_DL_MODULES] = {0, 2, 3, 4, 5, 1};
+
+/* DL chain of lte/pdsch_parameters_DV021.dat: TBS 2792, G 25200, Nir 228384,
+ * RV 0, RNTI 1, cell 1, slot 0, codeword 0, QPSK on one layer.
+ */
+#define     HDR_DASM_CHECK_DV021_FILE           "lte/pdsch_parameters_DV021.dat"
+#define     HDR_DASM_CHECK_DV021_FLOW_ID        5
+
+/* From test_main.c, which is not linked. There is one core on the host and
+ * its addresses are global.
+ */
+UInt32 convert_coreLocalToGlobalAddr (UInt32 addr)
+{
+    return addr;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_rand
+ *
+ *   @b Description
+ *   @n Fills a configuration with random bytes.
+ * =============================================================================
+ */
+static Void hdr_dasm_check_rand (Void* pCfg, UInt32 size)
+{
+    UInt8*              pByte = (UInt8 *) pCfg;
+
+    while (size --)
+        *pByte ++   =   (UInt8) rand ();
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_add
+ *
+ *   @b Description
+ *   @n Packs a module header of the given disassembler module index at the
+ *      end of a chain.
+ * =============================================================================
+ */
+static Int32 hdr_dasm_check_add (Int32 modIdx, BcpTest_HdrCfg* pCfg, UInt8* pData, UInt32* pLen)
+{
+    switch (modIdx)
+    {
+        case 0:     return Bcp_addGlobalHeader (&pCfg->glbl, pData, pLen);
+        case 1:     return Bcp_addTMHeader (&pCfg->tm, pData, pLen);
+        case 2:     return Bcp_addCRCHeader (&pCfg->crc, pData, pLen);
+        case 3:     return Bcp_addEncoderHeader (&pCfg->enc, pData, pLen);
+        case 4:     return Bcp_addLte_RMHeader (&pCfg->lteRm, pData, pLen);
+        case 5:     return Bcp_addModulatorHeader (&pCfg->mod, pData, pLen);
+        case 6:     return Bcp_addLTE_SSLHeader (&pCfg->lteSsl, pData, pLen);
+        case 7:     return Bcp_addLTE_RDHeader (&pCfg->lteRd, pData, pLen);
+        default:    return -1;
+    }
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_build
+ *
+ *   @b Description
+ *   @n Builds a random DL or UL header chain. Returns its length in bytes.
+ * =============================================================================
+ */
+static UInt32 hdr_dasm_check_build (UInt32 bDl, UInt32* pWords)
+{
+    BcpTest_HdrCfg      cfg;
+    UInt8*              pData = (UInt8 *) pWords;
+    UInt32              len = 8, glblLen = 0;
+
+    memset (pWords, 0, HDR_DASM_CHECK_MAX_WORDS * 4);
+    if (bDl)
+    {
+        hdr_dasm_check_rand (&cfg.crc, sizeof (cfg.crc));
+        cfg.crc.local_hdr_len       =   3;
+        Bcp_addCRCHeader (&cfg.crc, pData + len, &len);
+
+        hdr_dasm_check_rand (&cfg.enc, sizeof (cfg.enc));
+        cfg.enc.local_hdr_len       =   3;
+        Bcp_addEncoderHeader (&cfg.enc, pData + len, &len);
+
+        hdr_dasm_check_rand (&cfg.lteRm, sizeof (cfg.lteRm));
+        cfg.lteRm.local_hdr_len     =   6;
+        Bcp_addLte_RMHeader (&cfg.lteRm, pData + len, &len);
+
+        hdr_dasm_check_rand (&cfg.mod, sizeof (cfg.mod));
+        cfg.mod.local_hdr_len       =   4;
+        Bcp_addModulatorHeader (&cfg.mod, pData + len, &len);
+    }
+    else
+    {
+        hdr_dasm_check_rand (&cfg.lteSsl, sizeof (cfg.lteSsl));
+        cfg.lteSsl.local_hdr_len    =   15;
+        Bcp_addLTE_SSLHeader (&cfg.lteSsl, pData + len, &len);
+
+        hdr_dasm_check_rand (&cfg.lteRd, sizeof (cfg.lteRd));
+        cfg.lteRd.local_hdr_len     =   7;
+        Bcp_addLTE_RDHeader (&cfg.lteRd, pData + len, &len);
+    }
+
+    hdr_dasm_check_rand (&cfg.tm, sizeof (cfg.tm));
+    Bcp_addTMHeader (&cfg.tm, pData + len, &len);
+
+    /* Global header last, once the chain length is known */
+    hdr_dasm_check_rand (&cfg.glbl, sizeof (cfg.glbl));
+    cfg.glbl.hdr_end_ptr    =   len >> 2;
+    Bcp_addGlobalHeader (&cfg.glbl, pData, &glblLen);
+
+    return len;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_chain
+ *
+ *   @b Description
+ *   @n Decodes a chain built by @a hdr_dasm_check_build () and checks the
+ *      modules decoded, their header words packed back, and its diff with
+ *      itself and, if bDiff is set, with a changed copy. Returns the number
+ *      of errors.
+ * =============================================================================
+ */
+static UInt32 hdr_dasm_check_chain (UInt32 bDl, UInt32 bDiff, const UInt32* pWords, UInt32 len)
+{
+    const char* const*  pNames = bDl ? hdrDasmCheckDlNames : hdrDasmCheckUlNames;
+    BcpTest_HdrDasmMod  mod [BCP_TEST_HDR_DASM_MAX_MODULES];
+    BcpTest_HdrDasmMod  ref [BCP_TEST_HDR_DASM_MAX_MODULES];
+    UInt32              words [HDR_DASM_CHECK_MAX_WORDS];
+    UInt32              numExp = bDl ? HDR_DASM_CHECK_DL_MODULES : HDR_DASM_CHECK_UL_MODULES;
+    UInt32              i, packLen, numErr = 0;
+    Int32               numMod;
+
+    numMod  =   hdr_dasm_decode ((const UInt8 *) pWords, len, mod, BCP_TEST_HDR_DASM_MAX_MODULES);
+    if (numMod != (Int32) numExp)
+    {
+        Bcp_osalLog ("%d module headers decoded, expected %d \n", numMod, numExp);
+        return 1;
+    }
+
+    for (i = 0; i < numExp; i ++)
+    {
+        if (mod [i].modIdx < 0 || strcmp (mod [i].pName, pNames [i]) != 0)
+        {
+            Bcp_osalLog ("Header %d: %s module, expected %s \n", i, mod [i].pName, pNames [i]);
+            numErr ++;
+            continue;
+        }
+
+        packLen =   0;
+        memset (words, 0, sizeof (words));
+        if (hdr_dasm_check_add (mod [i].modIdx, &mod [i].cfg, (UInt8 *) words, &packLen) < 0 ||
+            packLen != mod [i].numWords * 4u ||
+            memcmp (words, &pWords [mod [i].wordOffset], packLen) != 0)
+        {
+            Bcp_osalLog ("Header %d: %s module does not pack back to its words \n", i, mod [i].pName);
+            numErr ++;
+        }
+    }
+
+    memcpy (ref, mod, sizeof (ref));
+    if (hdr_dasm_diff (mod, numExp, ref, numExp, 1) != 0)
+        numErr ++;
+    if (!bDiff)
+        return numErr;
+
+    /* A field of each of the two processing modules changed */
+    if (bDl)
+    {
+        ref [3].cfg.lteRm.rv_start_column1  ^=  1;
+        ref [4].cfg.mod.cinit_p2            ^=  0x100;
+    }
+    else
+    {
+        ref [1].cfg.lteSsl.uva              ^=  1;
+        ref [2].cfg.lteRd.init_cb_flowId    ^=  0x20;
+    }
+    if (hdr_dasm_diff (mod, numExp, ref, numExp, 0) != 2)
+    {
+        Bcp_osalLog ("Diff missed the fields changed: \n");
+        hdr_dasm_diff (mod, numExp, ref, numExp, 1);
+        numErr ++;
+    }
+
+    return numErr;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_dv021_ref
+ *
+ *   @b Description
+ *   @n Sets up the module headers expected of the DV021 DL chain, as 36.212
+ *      gives them:
+ *
+ *      -   B = 2792 + 24 = 2816 bits, one code block of K+ = 2816, no filler
+ *          bits, f1 = 43 and f2 = 88 (Table 5.1.3-3).
+ *
+ *      -   R = 89 rows of 32 columns, Kw = 3 * 89 * 32 = 8544 < Nir, so
+ *          Ncb = 8544: 8544 - 89 * 32 - 1 = 5695 = 31 * 178 + 177 past the
+ *          systematic bits. RV 0 starts at column 2.
+ *
+ *      -   E = G = 25200, the only code block.
+ *
+ *      -   cinit = 1 * 2^14 + 0 * 2^13 + 0 * 2^9 + 1 = 16385, unit amplitude
+ *          1024 / sqrt (2) = 724.
+ *
+ *      -   2 + 4 + 4 + 7 + 5 + 2 header words and the PS words.
+ * =============================================================================
+ */
+static Void hdr_dasm_check_dv021_ref (BcpTest_HdrDasmMod* pRef)
+{
+    UInt32              i;
+
+    memset (pRef, 0, HDR_DASM_CHECK_DL_MODULES * sizeof (BcpTest_HdrDasmMod));
+    for (i = 0; i < HDR_DASM_CHECK_DL_MODULES; i ++)
+    {
+        pRef [i].modIdx =   hdrDasmCheckDlModIdx [i];
+        pRef [i].pName  =   hdrDasmCheckDlNames [i];
+    }
+
+    pRef [0].cfg.glbl.radio_standard            =   Bcp_RadioStd_LTE;
+    pRef [0].cfg.glbl.hdr_end_ptr               =   24 + BCP_TEST_PKT_META_PS_WORDS;
+    pRef [0].cfg.glbl.flow_id                   =   HDR_DASM_CHECK_DV021_FLOW_ID;
+    pRef [0].cfg.glbl.destn_tag                 =   0xDEAD;
+
+    pRef [1].cfg.crc.local_hdr_len              =   3;
+    pRef [1].cfg.crc.bit_order                  =   1;
+    pRef [1].cfg.crc.va_blk_len                 =   2792;
+    pRef [1].cfg.crc.va_crc                     =   Bcp_CrcFormat_Crc24a;
+    pRef [1].cfg.crc.va_blks                    =   1;
+
+    pRef [2].cfg.enc.local_hdr_len              =   3;
+    pRef [2].cfg.enc.turbo_conv_sel             =   1;
+    pRef [2].cfg.enc.blockCfg [0].block_size    =   2816;
+    pRef [2].cfg.enc.blockCfg [0].num_code_blks =   1;
+    pRef [2].cfg.enc.blockCfg [0].intvpar0      =   43;
+    pRef [2].cfg.enc.blockCfg [0].intvpar1      =   88;
+
+    pRef [3].cfg.lteRm.local_hdr_len            =   6;
+    pRef [3].cfg.lteRm.rv_start_column1         =   2;
+    pRef [3].cfg.lteRm.param_ncb1_column        =   31;
+    pRef [3].cfg.lteRm.param_ncb1_row           =   177;
+    pRef [3].cfg.lteRm.num_code_blocks_c1       =   1;
+    pRef [3].cfg.lteRm.block_size_k1            =   2816;
+    pRef [3].cfg.lteRm.num_code_blocks_ce1      =   1;
+    pRef [3].cfg.lteRm.block_size_e1            =   25200;
+
+    pRef [4].cfg.mod.local_hdr_len              =   4;
+    pRef [4].cfg.mod.uva_val                    =   724;
+    pRef [4].cfg.mod.mod_type_sel               =   Bcp_ModulationType_QPSK;
+    pRef [4].cfg.mod.split_mode_en              =   1;
+    pRef [4].cfg.mod.scr_en                     =   1;
+    pRef [4].cfg.mod.sh_mod_sel                 =   Bcp_ModulationMode_Hard;
+    pRef [4].cfg.mod.cinit_p2                   =   16385;
+
+    pRef [5].cfg.tm.ps_data_size                =   BCP_TEST_PKT_META_PS_WORDS;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_check_dv021
+ *
+ *   @b Description
+ *   @n Builds the DL chain of the DV021 test configuration, as the DL test
+ *      does, and compares the module headers decoded with those expected.
+ *      Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 hdr_dasm_check_dv021 (Void)
+{
+    BcpTest_LteDlGrant  grant;
+    BcpTest_HdrTmpl*    pHdrTmpl = NULL;
+    BcpTest_HdrDasmMod  mod [BCP_TEST_HDR_DASM_MAX_MODULES];
+    BcpTest_HdrDasmMod  ref [HDR_DASM_CHECK_DL_MODULES];
+    UInt32              words [HDR_DASM_CHECK_MAX_WORDS];
+    FILE*               pCfgFile;
+    Int32               hdrLen, numMod;
+
+    if ((pCfgFile = fopen (HDR_DASM_CHECK_DV021_FILE, "r")) == NULL)
+    {
+        Bcp_osalLog ("Cannot open %s \n", HDR_DASM_CHECK_DV021_FILE);
+        return 1;
+    }
+    numLayers   =   1;
+    if (read_test_config (pCfgFile) < 0)
+    {
+        Bcp_osalLog ("Invalid test configuration: %s \n", HDR_DASM_CHECK_DV021_FILE);
+        fclose (pCfgFile);
+        return 1;
+    }
+    fclose (pCfgFile);
+
+    memset (&grant, 0, sizeof (grant));
+    grant.tbSize        =   tbSize;
+    grant.numBitsG      =   numBitsG;
+    grant.Nir           =   Nir;
+    grant.rnti          =   rnti;
+    grant.cellID        =   cellID;
+    grant.modulation    =   modulation;
+    grant.numLayers     =   numLayers;
+    grant.rvIdx         =   rvIdx;
+    grant.codeWordIdx   =   codeWordIdx;
+    grant.ns            =   ns;
+    grant.flowId        =   HDR_DASM_CHECK_DV021_FLOW_ID;
+
+    memset (words, 0, sizeof (words));
+    hdr_tmpl_flush_cache ();
+    if ((hdrLen = add_dl_grant (&grant, &pHdrTmpl, NULL, (UInt8 *) words)) <= 0 ||
+        (numMod = hdr_dasm_decode ((const UInt8 *) words, hdrLen, mod, BCP_TEST_HDR_DASM_MAX_MODULES)) < 0)
+    {
+        Bcp_osalLog ("DV021 DL chain not built or not decoded \n");
+        return 1;
+    }
+
+    hdr_dasm_check_dv021_ref (ref);
+
+    return hdr_dasm_diff (mod, numMod, ref, HDR_DASM_CHECK_DL_MODULES, 1);
+}
+
+int main (Void)
+{
+    BcpTest_HdrDasmMod  mod [BCP_TEST_HDR_DASM_MAX_MODULES];
+    UInt32              words [HDR_DASM_CHECK_MAX_WORDS];
+    struct timespec     tStart, tEnd;
+    UInt32              i, len, numErr = 0;
+    double              decodeNs;
+
+    if (hdr_dasm_init () < 0)
+    {
+        Bcp_osalLog ("Header disassembler init failed \n");
+        return 1;
+    }
+
+    for (i = 0; i < HDR_DASM_CHECK_NUM_CHAINS; i ++)
+    {
+        len     =   hdr_dasm_check_build (i & 1, words);
+        numErr  +=  hdr_dasm_check_chain (i & 1, (i >> 1) % (HDR_DASM_CHECK_DIFF_EVERY / 2) == 0, words, len);
+    }
+    numErr  +=  hdr_dasm_check_dv021 ();
+
+    /* Decode time of a DL chain */
+    len =   hdr_dasm_check_build (1, words);
+    clock_gettime (CLOCK_MONOTONIC, &tStart);
+    for (i = 0; i < HDR_DASM_CHECK_NUM_DECODES; i ++)
+        hdr_dasm_decode ((const UInt8 *) words, len, mod, BCP_TEST_HDR_DASM_MAX_MODULES);
+    clock_gettime (CLOCK_MONOTONIC, &tEnd);
+    decodeNs    =   ((tEnd.tv_sec - tStart.tv_sec) * 1e9 + (tEnd.tv_nsec - tStart.tv_nsec)) / HDR_DASM_CHECK_NUM_DECODES;
+
+    Bcp_osalLog ("%d chains, %d errors, %.0f ns per DL chain decode \n", HDR_DASM_CHECK_NUM_CHAINS, numErr, decodeNs);
+    Bcp_osalLog ("Header disassembler check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
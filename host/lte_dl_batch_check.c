@@ -0,0 +1,243 @@
+/**
+ *   @file  lte_dl_batch_check.c
+ *
+ *   @brief
+ *      Host check of the LTE DL batch builder, build_dl_batch () of
+ *      test_lte_dl.c, run with the stand-in header packers of
+ *      host/bcp_hdr_host.c:
+ *
+ *      -   build_dl_batch () of LTE_DL_BATCH_CHECK_NUM_GRANTS grants, runs of
+ *          three configurations interleaved, builds each packet byte for
+ *          byte as add_dl_headers () followed by the payload, the PS words
+ *          carrying the metadata of its grant.
+ *
+ *      -   The time per packet of build_dl_batch (), on the host.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -ffunction-sections -Wl,--gc-sections -I host -I . -o lte_dl_batch_check
+ *          host/lte_dl_batch_check.c test_common.c test_hdr_tmpl.c test_pkt_meta.c test_lte_mod.c
+ *          host/bcp_hdr_host.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_dl_batch_check
+ *
+ *      The test sources are included so that their static functions can be
+ *      called; the test functions that need BIOS or the BCP LLD are left out
+ *      by the linker.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdlib.h>
+#include <time.h>
+#include "test_lte_dl.c"
+
+/* Grants, and batch builds timed */
+#define     LTE_DL_BATCH_CHECK_NUM_GRANTS       64
+#define     LTE_DL_BATCH_CHECK_NUM_BUILDS       2000
+
+/* Grants of the same configuration in a row */
+#define     LTE_DL_BATCH_CHECK_RUN_LEN          5
+
+/* Tx descriptor buffer size */
+#define     LTE_DL_BATCH_CHECK_BUF_SIZE         2048
+
+/* Configurations: transport block size, G and modulation */
+#define     LTE_DL_BATCH_CHECK_NUM_CFGS         3
+
+static const UInt32 lteDlBatchCheckTbSize [LTE_DL_BATCH_CHECK_NUM_CFGS] = {11448, 2088, 4008};
+static const UInt32 lteDlBatchCheckNumBitsG [LTE_DL_BATCH_CHECK_NUM_CFGS] = {25200, 24000, 22800};
+static const UInt8  lteDlBatchCheckMod [LTE_DL_BATCH_CHECK_NUM_CFGS] = {2, 2, 4};
+
+static BcpTest_LteDlGrant   lteDlBatchCheckGrant [LTE_DL_BATCH_CHECK_NUM_GRANTS];
+static Cppi_Desc*           lteDlBatchCheckDesc [LTE_DL_BATCH_CHECK_NUM_GRANTS];
+static UInt8*               lteDlBatchCheckBuf [LTE_DL_BATCH_CHECK_NUM_GRANTS];
+static UInt8                lteDlBatchCheckPayload [LTE_DL_BATCH_CHECK_NUM_CFGS][TX_DATA_BUFFER_SIZE];
+
+/* From test_main.c, which is not linked. There is one core on the host and
+ * its addresses are global.
+ */
+UInt32 convert_coreLocalToGlobalAddr (UInt32 addr)
+{
+    return addr;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_batch_check_setup
+ *
+ *   @b Description
+ *   @n Sets up the grants, runs of each configuration in turn with random
+ *      per packet fields, and their Tx descriptors.
+ * =============================================================================
+ */
+static Int32 lte_dl_batch_check_setup (Void)
+{
+    BcpTest_LteDlGrant* pGrant;
+    UInt32              i, c;
+
+    for (c = 0; c < LTE_DL_BATCH_CHECK_NUM_CFGS; c ++)
+        for (i = 0; i < TX_DATA_BUFFER_SIZE; i ++)
+            lteDlBatchCheckPayload [c][i]    =   (UInt8) rand ();
+
+    for (i = 0; i < LTE_DL_BATCH_CHECK_NUM_GRANTS; i ++)
+    {
+        c                   =   (i / LTE_DL_BATCH_CHECK_RUN_LEN) % LTE_DL_BATCH_CHECK_NUM_CFGS;
+        pGrant              =   &lteDlBatchCheckGrant [i];
+        pGrant->tbSize      =   lteDlBatchCheckTbSize [c];
+        pGrant->numBitsG    =   lteDlBatchCheckNumBitsG [c];
+        pGrant->Nir         =   0x7FFFFFF;
+        pGrant->modulation  =   lteDlBatchCheckMod [c];
+        pGrant->numLayers   =   1;
+        pGrant->rvIdx       =   rand () & 3;
+        pGrant->codeWordIdx =   rand () & 1;
+        pGrant->rnti        =   rand () & 0xFFFF;
+        pGrant->cellID      =   rand () % 504;
+        pGrant->ns          =   rand () % 20;
+        pGrant->flowId      =   rand () & 0xFF;
+        pGrant->harqProcId  =   rand () & 7;
+        pGrant->tti         =   i;
+        pGrant->pPayload    =   lteDlBatchCheckPayload [c];
+        pGrant->payloadLen  =   ((pGrant->tbSize >> 3) + 4) & ~3;
+
+        lteDlBatchCheckDesc [i]   =   (Cppi_Desc *) qmss_emu_alloc (sizeof (Cppi_HostDesc), 16);
+        lteDlBatchCheckBuf [i]    =   (UInt8 *) qmss_emu_alloc (LTE_DL_BATCH_CHECK_BUF_SIZE, 16);
+        if (lteDlBatchCheckDesc [i] == NULL || lteDlBatchCheckBuf [i] == NULL)
+            return -1;
+        memset (lteDlBatchCheckDesc [i], 0, sizeof (Cppi_HostDesc));
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_batch_check_ref
+ *
+ *   @b Description
+ *   @n Sets up the test globals and code block parameters of a
+ *      configuration, as @a add_dl_grant () does to build a template.
+ * =============================================================================
+ */
+static Void lte_dl_batch_check_ref (const BcpTest_LteDlGrant* pGrant, BcpTest_LteCBParams* pCodeBlkParams)
+{
+    tbSize      =   pGrant->tbSize;
+    numBitsG    =   pGrant->numBitsG;
+    Nir         =   pGrant->Nir;
+    modulation  =   pGrant->modulation;
+    numLayers   =   pGrant->numLayers;
+    rvIdx       =   pGrant->rvIdx;
+    compute_cbparams_ref (tbSize, pCodeBlkParams);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_batch_check_batch
+ *
+ *   @b Description
+ *   @n Builds the grants in batches of at most BCP_TEST_PKT_META_MAX_INFLIGHT
+ *      packets, the payloads copied, and compares each packet with the one
+ *      built directly. Returns the number of packets that differ.
+ * =============================================================================
+ */
+static UInt32 lte_dl_batch_check_batch (Void)
+{
+    const BcpTest_LteDlGrant*   pGrant;
+    BcpTest_LteCBParams         codeBlkParams;
+    BcpTest_RateMatchParams     rmParams;
+    BcpTest_PktMeta*            pMeta;
+    UInt8                       ref [LTE_DL_BATCH_CHECK_BUF_SIZE];
+    UInt32                      fieldVal [LTE_DL_HDR_NUM_FIELDS];
+    UInt32                      i, first, num, pktLen, numErr = 0;
+    Int32                       hdrLen;
+
+    for (first = 0; first < LTE_DL_BATCH_CHECK_NUM_GRANTS; first += num)
+    {
+        num =   LTE_DL_BATCH_CHECK_NUM_GRANTS - first;
+        if (num > BCP_TEST_PKT_META_MAX_INFLIGHT)
+            num =   BCP_TEST_PKT_META_MAX_INFLIGHT;
+
+        for (i = first; i < first + num; i ++)
+            Cppi_setData (Cppi_DescType_HOST, lteDlBatchCheckDesc [i], lteDlBatchCheckBuf [i], LTE_DL_BATCH_CHECK_BUF_SIZE);
+        if (build_dl_batch (&lteDlBatchCheckGrant [first], num, &lteDlBatchCheckDesc [first], 0) < 0)
+        {
+            Bcp_osalLog ("Batch of grants %d - %d not built \n", first, first + num - 1);
+            return num;
+        }
+
+        for (i = first; i < first + num; i ++)
+        {
+            pGrant  =   &lteDlBatchCheckGrant [i];
+
+            /* Headers built directly, with the field values of the grant */
+            lte_dl_batch_check_ref (pGrant, &codeBlkParams);
+            compute_rmGamma_ref (numBitsG, modulation, numLayers, &codeBlkParams, rvIdx, 0, 0, Nir, LTE_PDSCH, &rmParams);
+            fieldVal [LTE_DL_HDR_FIELD_CINIT]   =   pGrant->rnti * (1<<14) + pGrant->codeWordIdx * (1<<13) +
+                                                    pGrant->ns/2  * (1<<9) + pGrant->cellID;
+            fieldVal [LTE_DL_HDR_FIELD_RV_COL1] =   (codeBlkParams.numCodeBksKm == 0) ? rmParams.rvKp : rmParams.rvKm;
+            fieldVal [LTE_DL_HDR_FIELD_RV_COL2] =   (codeBlkParams.numCodeBksKm == 0) ? 0 : rmParams.rvKp;
+            fieldVal [LTE_DL_HDR_FIELD_FLOW_ID] =   pGrant->flowId;
+
+            memset (ref, 0, sizeof (ref));
+            if ((hdrLen = add_dl_headers (&codeBlkParams, fieldVal, ref)) < 0)
+                return LTE_DL_BATCH_CHECK_NUM_GRANTS;
+            memcpy (ref + hdrLen, pGrant->pPayload, pGrant->payloadLen);
+            pktLen  =   hdrLen + pGrant->payloadLen;
+
+            /* PS words of the packet, which must map back to its grant */
+            pMeta   =   pkt_meta_lookup (lteDlBatchCheckBuf [i] + lteDlHdrPsOffset, BCP_TEST_PKT_META_PS_WORDS * 4);
+            if (pMeta == NULL || pMeta->ueId != pGrant->rnti || pMeta->harqProcId != pGrant->harqProcId ||
+                pMeta->tti != pGrant->tti || pMeta->pRequest != (Void *) pGrant)
+            {
+                Bcp_osalLog ("Packet %d: PS words carry no metadata of its grant \n", i);
+                numErr ++;
+                continue;
+            }
+            memcpy (ref + lteDlHdrPsOffset, lteDlBatchCheckBuf [i] + lteDlHdrPsOffset, BCP_TEST_PKT_META_PS_WORDS * 4);
+            pkt_meta_release (pMeta);
+
+            if (Cppi_getDataLen (Cppi_DescType_HOST, lteDlBatchCheckDesc [i]) != pktLen ||
+                Cppi_getPacketLen (Cppi_DescType_HOST, lteDlBatchCheckDesc [i]) != pktLen ||
+                memcmp (ref, lteDlBatchCheckBuf [i], pktLen) != 0)
+            {
+                Bcp_osalLog ("Packet %d differs from the packet built directly \n", i);
+                numErr ++;
+            }
+        }
+    }
+
+    return numErr;
+}
+
+int main (Void)
+{
+    struct timespec     tStart, tEnd;
+    UInt32              i, k, numErr = 0;
+    double              buildNs;
+
+    if (lte_dl_batch_check_setup () < 0)
+    {
+        Bcp_osalLog ("Out of memory \n");
+        return 1;
+    }
+    hdr_tmpl_flush_cache ();
+    pkt_meta_init ();
+
+    numErr  +=  lte_dl_batch_check_batch ();
+
+    /* Batch build time, the metadata table cleared between batches */
+    clock_gettime (CLOCK_MONOTONIC, &tStart);
+    for (k = 0; k < LTE_DL_BATCH_CHECK_NUM_BUILDS; k ++)
+    {
+        pkt_meta_init ();
+        for (i = 0; i < BCP_TEST_PKT_META_MAX_INFLIGHT; i ++)
+            Cppi_setData (Cppi_DescType_HOST, lteDlBatchCheckDesc [i], lteDlBatchCheckBuf [i], LTE_DL_BATCH_CHECK_BUF_SIZE);
+        build_dl_batch (lteDlBatchCheckGrant, BCP_TEST_PKT_META_MAX_INFLIGHT, lteDlBatchCheckDesc, 0);
+    }
+    clock_gettime (CLOCK_MONOTONIC, &tEnd);
+    buildNs =   ((tEnd.tv_sec - tStart.tv_sec) * 1e9 + (tEnd.tv_nsec - tStart.tv_nsec)) /
+                ((double) LTE_DL_BATCH_CHECK_NUM_BUILDS * BCP_TEST_PKT_META_MAX_INFLIGHT);
+
+    Bcp_osalLog ("%d grants, %d errors, %.0f ns per packet built \n", LTE_DL_BATCH_CHECK_NUM_GRANTS, numErr, buildNs);
+    Bcp_osalLog ("LTE DL batch build check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
@@ -0,0 +1,240 @@
+/**
+ *   @file  lte_dl_tmpl_check.c
+ *
+ *   @brief
+ *      Host check of the LTE DL header chain templates (test_hdr_tmpl.c,
+ *      add_dl_grant () of test_lte_dl.c), run with the stand-in header
+ *      packers of host/bcp_hdr_host.c:
+ *
+ *      -   The first grant of each configuration creates its template, and
+ *          gets the headers add_dl_headers () builds, with the PS words at
+ *          the same offset.
+ *
+ *      -   The template of each configuration, applied to random values of
+ *          cinit, the RV start columns and the flow id over their whole
+ *          widths, gives the headers add_dl_headers () builds.
+ *
+ *      -   The templates are exported with hdr_tmpl_export_cache (). Built
+ *          again with LTE_DL_HDR_BLOBS defined and the exported file linked,
+ *          the check registers its blobs instead. The template of each
+ *          configuration must then be ready before its first grant, and
+ *          pass the same checks.
+ *
+ *      Build and run from the test directory, the second build on the
+ *      templates exported by the first:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -ffunction-sections -Wl,--gc-sections -I host -I . -o lte_dl_tmpl_check
+ *          host/lte_dl_tmpl_check.c test_common.c test_hdr_tmpl.c test_pkt_meta.c test_lte_mod.c
+ *          host/bcp_hdr_host.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_dl_tmpl_check lte_dl_hdr_blobs.c
+ *
+ *      gcc ... -DLTE_DL_HDR_BLOBS -o lte_dl_tmpl_check_blobs host/lte_dl_tmpl_check.c lte_dl_hdr_blobs.c ...
+ *      ./lte_dl_tmpl_check_blobs
+ *
+ *      The test sources are included so that their static functions can be
+ *      called; the test functions that need BIOS or the BCP LLD are left out
+ *      by the linker.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include "test_lte_dl.c"
+
+/* Random field values applied to each template */
+#define     LTE_DL_TMPL_CHECK_NUM_VALUES        2000
+
+/* Configurations: transport block size, G and modulation. 7000 bits
+ * segment into code blocks of two sizes, so both RV start columns are set.
+ */
+#define     LTE_DL_TMPL_CHECK_NUM_CFGS          4
+
+static const UInt32 lteDlTmplCheckTbSize [LTE_DL_TMPL_CHECK_NUM_CFGS] = {11448, 2088, 4008, 7000};
+static const UInt32 lteDlTmplCheckNumBitsG [LTE_DL_TMPL_CHECK_NUM_CFGS] = {25200, 24000, 22800, 15000};
+static const UInt8  lteDlTmplCheckMod [LTE_DL_TMPL_CHECK_NUM_CFGS] = {2, 2, 4, 6};
+
+/* From test_main.c, which is not linked. There is one core on the host and
+ * its addresses are global.
+ */
+UInt32 convert_coreLocalToGlobalAddr (UInt32 addr)
+{
+    return addr;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_tmpl_check_grant
+ *
+ *   @b Description
+ *   @n Sets up a grant of a configuration with random per packet fields.
+ * =============================================================================
+ */
+static Void lte_dl_tmpl_check_grant (UInt32 c, BcpTest_LteDlGrant* pGrant)
+{
+    memset (pGrant, 0, sizeof (BcpTest_LteDlGrant));
+    pGrant->tbSize      =   lteDlTmplCheckTbSize [c];
+    pGrant->numBitsG    =   lteDlTmplCheckNumBitsG [c];
+    pGrant->Nir         =   0x7FFFFFF;
+    pGrant->modulation  =   lteDlTmplCheckMod [c];
+    pGrant->numLayers   =   1;
+    pGrant->rvIdx       =   rand () & 3;
+    pGrant->codeWordIdx =   rand () & 1;
+    pGrant->rnti        =   rand () & 0xFFFF;
+    pGrant->cellID      =   rand () % 504;
+    pGrant->ns          =   rand () % 20;
+    pGrant->flowId      =   rand () & 0xFF;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_tmpl_check_ref
+ *
+ *   @b Description
+ *   @n Sets up the test globals and code block parameters of a grant, and
+ *      the field values @a add_dl_grant () patches into its headers.
+ * =============================================================================
+ */
+static Void lte_dl_tmpl_check_ref (const BcpTest_LteDlGrant* pGrant, BcpTest_LteCBParams* pCodeBlkParams,
+                                   UInt32* pFieldVal)
+{
+    BcpTest_RateMatchParams     rmParams;
+
+    tbSize      =   pGrant->tbSize;
+    numBitsG    =   pGrant->numBitsG;
+    Nir         =   pGrant->Nir;
+    modulation  =   pGrant->modulation;
+    numLayers   =   pGrant->numLayers;
+    rvIdx       =   pGrant->rvIdx;
+    compute_cbparams_ref (tbSize, pCodeBlkParams);
+
+    compute_rmGamma_ref (numBitsG, modulation, numLayers, pCodeBlkParams, rvIdx, 0, 0, Nir, LTE_PDSCH, &rmParams);
+    pFieldVal [LTE_DL_HDR_FIELD_CINIT]      =   pGrant->rnti * (1<<14) + pGrant->codeWordIdx * (1<<13) +
+                                                pGrant->ns/2  * (1<<9) + pGrant->cellID;
+    pFieldVal [LTE_DL_HDR_FIELD_RV_COL1]    =   (pCodeBlkParams->numCodeBksKm == 0) ? rmParams.rvKp : rmParams.rvKm;
+    pFieldVal [LTE_DL_HDR_FIELD_RV_COL2]    =   (pCodeBlkParams->numCodeBksKm == 0) ? 0 : rmParams.rvKp;
+    pFieldVal [LTE_DL_HDR_FIELD_FLOW_ID]    =   pGrant->flowId;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_dl_tmpl_check_cfg
+ *
+ *   @b Description
+ *   @n Creates the template of a configuration from its first grant, then
+ *      applies it to random field values, each time comparing the headers
+ *      with those built directly. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_dl_tmpl_check_cfg (UInt32 c)
+{
+    BcpTest_LteDlGrant          grant;
+    BcpTest_HdrTmpl*            pHdrTmpl = NULL;
+    BcpTest_LteCBParams         codeBlkParams;
+    UInt32                      fieldVal [LTE_DL_HDR_NUM_FIELDS];
+    UInt32                      psWords [BCP_TEST_PKT_META_PS_WORDS];
+    UInt8                       hdr [TX_HDR_BUFFER_SIZE], ref [TX_HDR_BUFFER_SIZE];
+    UInt32                      f, k, numErr = 0;
+    Int32                       hdrLen, refLen;
+#ifdef LTE_DL_HDR_BLOBS
+    UInt32                      tmplKey [4];
+#endif
+
+    lte_dl_tmpl_check_grant (c, &grant);
+    for (k = 0; k < BCP_TEST_PKT_META_PS_WORDS; k ++)
+        psWords [k] =   0xC0DE0000 | k;
+
+#ifdef LTE_DL_HDR_BLOBS
+    /* Template registered from its blob, before any grant */
+    tmplKey [0] =   grant.tbSize;
+    tmplKey [1] =   grant.numBitsG;
+    tmplKey [2] =   grant.Nir;
+    tmplKey [3] =   grant.modulation | (grant.numLayers << 8);
+    pHdrTmpl    =   hdr_tmpl_lookup (tmplKey, 4);
+    if (pHdrTmpl == NULL || pHdrTmpl->state != BCP_TEST_HDR_TMPL_READY)
+    {
+        Bcp_osalLog ("TB size %d: no template registered \n", grant.tbSize);
+        return 1;
+    }
+#endif
+
+    /* First grant, creating the template unless it is registered */
+    memset (hdr, 0, sizeof (hdr));
+    memset (ref, 0, sizeof (ref));
+    hdrLen  =   add_dl_grant (&grant, &pHdrTmpl, psWords, hdr);
+    lte_dl_tmpl_check_ref (&grant, &codeBlkParams, fieldVal);
+    refLen  =   add_dl_headers (&codeBlkParams, fieldVal, ref);
+    if (pHdrTmpl == NULL || pHdrTmpl->state != BCP_TEST_HDR_TMPL_READY)
+    {
+        Bcp_osalLog ("TB size %d: no ready template \n", grant.tbSize);
+        return 1;
+    }
+    memcpy (ref + lteDlHdrPsOffset, psWords, sizeof (psWords));
+    if (hdrLen <= 0 || hdrLen != refLen || pHdrTmpl->auxData [LTE_DL_HDR_AUX_PS_OFFSET] != lteDlHdrPsOffset ||
+        memcmp (hdr, ref, sizeof (hdr)) != 0)
+    {
+        Bcp_osalLog ("TB size %d: first packet headers differ from those built directly \n", grant.tbSize);
+        numErr ++;
+    }
+
+    /* Random values of every field, over its whole width */
+    for (k = 0; k < LTE_DL_TMPL_CHECK_NUM_VALUES; k ++)
+    {
+        for (f = 0; f < LTE_DL_HDR_NUM_FIELDS; f ++)
+            fieldVal [f]    =   ((UInt32) rand () ^ ((UInt32) rand () << 16)) & ((1u << lteDlHdrFieldWidth [f]) - 1);
+
+        memset (hdr, 0, sizeof (hdr));
+        memset (ref, 0, sizeof (ref));
+        hdrLen  =   (Int32) hdr_tmpl_apply (pHdrTmpl, fieldVal, hdr);
+        if (hdrLen != add_dl_headers (&codeBlkParams, fieldVal, ref) || memcmp (hdr, ref, sizeof (hdr)) != 0)
+        {
+            if (numErr ++ < 4)
+                Bcp_osalLog ("TB size %d: cinit 0x%x, RV columns %d %d, flow %d applied differ \n", grant.tbSize,
+                             fieldVal [0], fieldVal [1], fieldVal [2], fieldVal [3]);
+        }
+    }
+    Bcp_osalLog ("TB size %d: template of %d bytes, %d field values applied \n",
+                 grant.tbSize, pHdrTmpl->hdrLen, LTE_DL_TMPL_CHECK_NUM_VALUES);
+
+    return numErr;
+}
+
+int main (int argc, char* argv [])
+{
+    UInt32              c, numErr = 0;
+#ifndef LTE_DL_HDR_BLOBS
+    FILE*               pBlobFile;
+    Int32               numBlobs;
+#else
+    (Void) argc;
+    (Void) argv;
+#endif
+
+    hdr_tmpl_flush_cache ();
+#ifdef LTE_DL_HDR_BLOBS
+    hdr_tmpl_register_blobs (lteDlHdrBlobs, lteDlHdrBlobs_count);
+#endif
+    for (c = 0; c < LTE_DL_TMPL_CHECK_NUM_CFGS; c ++)
+        numErr  +=  lte_dl_tmpl_check_cfg (c);
+
+#ifndef LTE_DL_HDR_BLOBS
+    if ((pBlobFile = fopen ((argc > 1) ? argv [1] : "lte_dl_hdr_blobs.c", "w")) == NULL)
+    {
+        Bcp_osalLog ("Cannot open the template file \n");
+        return 1;
+    }
+    numBlobs    =   hdr_tmpl_export_cache (pBlobFile, "lteDlHdrBlobs");
+    fclose (pBlobFile);
+    if (numBlobs != LTE_DL_TMPL_CHECK_NUM_CFGS)
+    {
+        Bcp_osalLog ("%d templates exported, expected %d \n", numBlobs, LTE_DL_TMPL_CHECK_NUM_CFGS);
+        numErr ++;
+    }
+#endif
+
+    Bcp_osalLog ("%d configurations, %d errors \n", LTE_DL_TMPL_CHECK_NUM_CFGS, numErr);
+    Bcp_osalLog ("LTE DL header template check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
@@ -0,0 +1,254 @@
+/**
+ *   @file  lte_intlv_check.c
+ *
+ *   @brief
+ *      Host check of the PUSCH channel interleaver (test_lte_intlv.c)
+ *      against 3GPP TS 36.212 section 5.2.2.8, for normal and extended CP
+ *      and nonzero Q'RI and Q'ACK:
+ *
+ *      -   RI symbol i is in row R'mux - 1 - i / 4 and column
+ *          ColumnSet [3 i mod 4] of Table 5.2.2.8-1, ACK/NACK symbol i in
+ *          the same row and column of Table 5.2.2.8-2.
+ *
+ *      -   The data symbols fill the other positions row by row, in order,
+ *          those under the ACK/NACK positions being punctured.
+ *
+ *      -   The matrix is read out column by column.
+ *
+ *      -   The deinterleaver gives back every RI, ACK/NACK and data symbol,
+ *          and zero for each data symbol punctured.
+ *
+ *      The expected positions are worked out here from the tables, not from
+ *      the index program of the interleaver. All symbol sizes the gather
+ *      has a path for are run.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -I host -I . -o lte_intlv_check host/lte_intlv_check.c
+ *          test_lte_intlv.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_intlv_check
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Largest matrix checked, R'mux x C'mux, and largest symbol */
+#define     LTE_INTLV_CHECK_MAX_POS             (144 * 12)
+#define     LTE_INTLV_CHECK_MAX_SYM_SIZE        8
+
+/* Column sets of Tables 5.2.2.8-1 (RI) and 5.2.2.8-2 (ACK/NACK), normal
+ * then extended CP
+ */
+static const UInt8 lteIntlvCheckRiCols [2][4] = {{1, 4, 7, 10}, {0, 3, 5, 8}};
+static const UInt8 lteIntlvCheckAckCols [2][4] = {{2, 3, 8, 9}, {1, 2, 6, 7}};
+
+/* Allocation shapes: R'mux, C'mux, Q'RI, Q'ACK. C'mux is 12 or 11 (with SRS)
+ * for normal CP, 10 or 9 for extended CP.
+ */
+typedef struct _LteIntlvCheckShape
+{
+    UInt16              numRows;
+    UInt8               numCols;
+    UInt16              numRi;
+    UInt16              numAck;
+} LteIntlvCheckShape;
+
+static const LteIntlvCheckShape lteIntlvCheckShapes [] =
+{
+    {12,    12,     1,      1},
+    {12,    12,     6,      9},
+    {24,    12,     17,     5},
+    {24,    11,     3,      14},
+    {48,    9,      21,     7},
+    {12,    10,     4,      8},
+    {36,    10,     13,     22},
+    {144,   12,     96,     120},
+    {12,    12,     48,     48},
+    {144,   10,     576,    576}
+};
+
+static const UInt32 lteIntlvCheckSymSizes [] = {2, 4, 8, 3};
+
+static UInt8    lteIntlvCheckSrc [(LTE_INTLV_CHECK_MAX_POS + 576) * LTE_INTLV_CHECK_MAX_SYM_SIZE];
+static UInt8    lteIntlvCheckOut [LTE_INTLV_CHECK_MAX_POS * LTE_INTLV_CHECK_MAX_SYM_SIZE];
+static UInt8    lteIntlvCheckBack [(LTE_INTLV_CHECK_MAX_POS + 576) * LTE_INTLV_CHECK_MAX_SYM_SIZE];
+
+/* Source slot at each matrix position, row by row, and data symbols punctured */
+static UInt32   lteIntlvCheckMatrix [LTE_INTLV_CHECK_MAX_POS];
+static UInt8    lteIntlvCheckPunc [LTE_INTLV_CHECK_MAX_POS];
+
+/* Marks a matrix position not assigned yet */
+#define     LTE_INTLV_CHECK_FREE                0xFFFFFFFF
+
+/** ============================================================================
+ *   @n@b lte_intlv_check_sym
+ *
+ *   @b Description
+ *   @n Writes the symbol of a source slot: the low and high bytes of its
+ *      slot number + 1 in turn, each byte tagged with its index, so that all
+ *      symbols differ and none is zero.
+ * =============================================================================
+ */
+static Void lte_intlv_check_sym (UInt8* pSym, UInt32 slot, UInt32 symSize)
+{
+    UInt32              b;
+
+    for (b = 0; b < symSize; b ++)
+        pSym [b]    =   (UInt8) ((slot + 1) >> (8 * (b & 1))) ^ (UInt8) (b << 5);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_intlv_check_expect
+ *
+ *   @b Description
+ *   @n Places the RI, ACK/NACK and data symbols of a shape in the matrix,
+ *      as 36.212 section 5.2.2.8 gives them.
+ * =============================================================================
+ */
+static Void lte_intlv_check_expect (const LteIntlvCheckShape* pShape)
+{
+    UInt32              numPos = pShape->numRows * pShape->numCols;
+    UInt32              numData = numPos - pShape->numRi;
+    UInt32              cp = (pShape->numCols >= 11) ? 0 : 1;
+    UInt32              i, r, c, pos, k;
+
+    for (pos = 0; pos < numPos; pos ++)
+    {
+        lteIntlvCheckMatrix [pos]   =   LTE_INTLV_CHECK_FREE;
+        lteIntlvCheckPunc [pos]     =   0;
+    }
+
+    for (i = 0; i < pShape->numRi; i ++)
+    {
+        r   =   pShape->numRows - 1 - i / 4;
+        c   =   lteIntlvCheckRiCols [cp][(3 * i) % 4];
+        lteIntlvCheckMatrix [r * pShape->numCols + c]   =   numData + i;
+    }
+
+    for (pos = 0, k = 0; pos < numPos; pos ++)
+    {
+        if (lteIntlvCheckMatrix [pos] == LTE_INTLV_CHECK_FREE)
+            lteIntlvCheckMatrix [pos]   =   k ++;
+    }
+
+    for (i = 0; i < pShape->numAck; i ++)
+    {
+        r   =   pShape->numRows - 1 - i / 4;
+        c   =   lteIntlvCheckAckCols [cp][(3 * i) % 4];
+        lteIntlvCheckPunc [lteIntlvCheckMatrix [r * pShape->numCols + c]]   =   1;
+        lteIntlvCheckMatrix [r * pShape->numCols + c]   =   numData + pShape->numRi + i;
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_intlv_check_shape
+ *
+ *   @b Description
+ *   @n Interleaves and deinterleaves the symbols of a shape and compares
+ *      them with the positions expected. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_intlv_check_shape (const LteIntlvCheckShape* pShape, UInt32 symSize)
+{
+    BcpTest_LteChIntlvProg* pProg;
+    UInt8                   sym [LTE_INTLV_CHECK_MAX_SYM_SIZE];
+    UInt8                   zero [LTE_INTLV_CHECK_MAX_SYM_SIZE];
+    UInt32                  numPos = pShape->numRows * pShape->numCols;
+    UInt32                  numSlots = numPos + pShape->numAck;
+    UInt32                  numData = numPos - pShape->numRi;
+    UInt32                  slot, r, c, numPunc = 0, numErr = 0;
+
+    if ((pProg = lte_chintlv_get_prog (pShape->numRows, pShape->numCols, pShape->numRi, pShape->numAck)) == NULL)
+    {
+        Bcp_osalLog ("No interleaver for %d x %d, Q'RI %d, Q'ACK %d \n",
+                     pShape->numRows, pShape->numCols, pShape->numRi, pShape->numAck);
+        return 1;
+    }
+    if (pProg->numData != numData || pProg->numSlots != numSlots)
+    {
+        Bcp_osalLog ("%d x %d: H' %d and %d slots, expected %d and %d \n", pShape->numRows, pShape->numCols,
+                     pProg->numData, pProg->numSlots, numData, numSlots);
+        return 1;
+    }
+
+    for (slot = 0; slot < numSlots; slot ++)
+        lte_intlv_check_sym (&lteIntlvCheckSrc [slot * symSize], slot, symSize);
+    lte_intlv_check_expect (pShape);
+
+    /* Read out column by column */
+    lte_chintlv_interleave (pProg, lteIntlvCheckSrc, lteIntlvCheckOut, symSize);
+    for (c = 0; c < pShape->numCols; c ++)
+    {
+        for (r = 0; r < pShape->numRows; r ++)
+        {
+            slot    =   lteIntlvCheckMatrix [r * pShape->numCols + c];
+            lte_intlv_check_sym (sym, slot, symSize);
+            if (memcmp (&lteIntlvCheckOut [(c * pShape->numRows + r) * symSize], sym, symSize) != 0)
+            {
+                if (numErr ++ < 4)
+                    Bcp_osalLog ("%d x %d, Q'RI %d, Q'ACK %d: row %d column %d is not symbol %d \n",
+                                 pShape->numRows, pShape->numCols, pShape->numRi, pShape->numAck, r, c, slot);
+            }
+        }
+    }
+
+    /* Every symbol back, punctured data symbols erased */
+    memset (zero, 0, sizeof (zero));
+    lte_chintlv_deinterleave (pProg, lteIntlvCheckOut, lteIntlvCheckBack, symSize);
+    for (slot = 0; slot < numSlots; slot ++)
+    {
+        lte_intlv_check_sym (sym, slot, symSize);
+        if (slot < numData && lteIntlvCheckPunc [slot])
+        {
+            numPunc ++;
+            if (memcmp (&lteIntlvCheckBack [slot * symSize], zero, symSize) == 0)
+                continue;
+        }
+        else if (memcmp (&lteIntlvCheckBack [slot * symSize], sym, symSize) == 0)
+            continue;
+
+        if (numErr ++ < 4)
+            Bcp_osalLog ("%d x %d, Q'RI %d, Q'ACK %d: slot %d not deinterleaved \n",
+                         pShape->numRows, pShape->numCols, pShape->numRi, pShape->numAck, slot);
+    }
+    if (numPunc != pShape->numAck)
+    {
+        Bcp_osalLog ("%d data symbols punctured, expected %d \n", numPunc, pShape->numAck);
+        numErr ++;
+    }
+
+    return numErr;
+}
+
+int main (Void)
+{
+    UInt32              s, z, numErr = 0, numRun = 0;
+
+    for (s = 0; s < sizeof (lteIntlvCheckShapes) / sizeof (lteIntlvCheckShapes [0]); s ++)
+    {
+        for (z = 0; z < sizeof (lteIntlvCheckSymSizes) / sizeof (lteIntlvCheckSymSizes [0]); z ++)
+        {
+            numErr  +=  lte_intlv_check_shape (&lteIntlvCheckShapes [s], lteIntlvCheckSymSizes [z]);
+            numRun  ++;
+        }
+    }
+
+    /* Shapes the interleaver must refuse: too few columns, too many RI */
+    if (lte_chintlv_get_prog (12, 8, 1, 1) != NULL || lte_chintlv_get_prog (12, 12, 49, 0) != NULL)
+    {
+        Bcp_osalLog ("Invalid shape accepted \n");
+        numErr ++;
+    }
+    lte_chintlv_flush_cache ();
+
+    Bcp_osalLog ("%d interleaver runs, %d errors \n", numRun, numErr);
+    Bcp_osalLog ("Channel interleaver check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
@@ -0,0 +1,159 @@
+/**
+ *   @file  lte_layermap_check.c
+ *
+ *   @brief
+ *      Host check of the 2 layer mapper/demapper (test_lte_layermap.c)
+ *      against 3GPP TS 36.211 Table 5.3.2A.2-1:
+ *
+ *      -   One codeword on 2 layers: x0(i) = d0(2i) and x1(i) = d0(2i + 1).
+ *          A known sequence of 10 symbols is compared with the per-layer
+ *          order written out from the table, then longer sequences of even
+ *          and odd numbers of symbol pairs with the table formula.
+ *
+ *      -   Two codewords on 2 layers: x0(i) = d0(i) and x1(i) = d1(i), with
+ *          separate buffers and with the layers aliasing the codewords.
+ *
+ *      -   Demapping the expected layers gives back the codeword symbols.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -I host -I . -o lte_layermap_check host/lte_layermap_check.c
+ *          test_lte_layermap.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_layermap_check
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Largest number of symbols per layer checked */
+#define     LTE_LM_CHECK_MAX_LAYER_SYMB         1201
+
+/* Codeword d0(0) ... d0(9), and its layers as Table 5.3.2A.2-1 gives them */
+static const UInt32 lteLmCheckCw [10] =
+{
+    0xA0000000, 0xA0010001, 0xA0020002, 0xA0030003, 0xA0040004,
+    0xA0050005, 0xA0060006, 0xA0070007, 0xA0080008, 0xA0090009
+};
+static const UInt32 lteLmCheckLayer0 [5] = {0xA0000000, 0xA0020002, 0xA0040004, 0xA0060006, 0xA0080008};
+static const UInt32 lteLmCheckLayer1 [5] = {0xA0010001, 0xA0030003, 0xA0050005, 0xA0070007, 0xA0090009};
+
+/* Symbols per layer of the longer sequences */
+static const UInt32 lteLmCheckNumLayerSymb [] = {1, 2, 3, 4, 7, 12, 144, 600, 1201};
+
+static UInt32   lteLmCheckCw0 [2 * LTE_LM_CHECK_MAX_LAYER_SYMB];
+static UInt32   lteLmCheckCw1 [LTE_LM_CHECK_MAX_LAYER_SYMB];
+static UInt32   lteLmCheckX0 [LTE_LM_CHECK_MAX_LAYER_SYMB + 1];
+static UInt32   lteLmCheckX1 [LTE_LM_CHECK_MAX_LAYER_SYMB + 1];
+static UInt32   lteLmCheckBack [2 * LTE_LM_CHECK_MAX_LAYER_SYMB + 1];
+
+/* Written past the end of the outputs, must be left alone */
+#define     LTE_LM_CHECK_GUARD                  0xDEADBEEF
+
+/** ============================================================================
+ *   @n@b lte_lm_check_cmp
+ *
+ *   @b Description
+ *   @n Compares numSymb symbols with those expected, and the guard word
+ *      after them. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_lm_check_cmp (const char* pWhat, UInt32 numLayerSymb, const UInt32* pOut,
+                                const UInt32* pExp, UInt32 numSymb)
+{
+    UInt32              i, numErr = 0;
+
+    for (i = 0; i < numSymb; i ++)
+    {
+        if (pOut [i] != pExp [i] && numErr ++ < 4)
+            Bcp_osalLog ("%d symbols per layer: %s (%d) = 0x%08x, expected 0x%08x \n",
+                         numLayerSymb, pWhat, i, pOut [i], pExp [i]);
+    }
+    if (pOut [numSymb] != LTE_LM_CHECK_GUARD)
+    {
+        Bcp_osalLog ("%d symbols per layer: %s written past its end \n", numLayerSymb, pWhat);
+        numErr ++;
+    }
+
+    return numErr;
+}
+
+/** ============================================================================
+ *   @n@b lte_lm_check_one_cw
+ *
+ *   @b Description
+ *   @n Maps a codeword onto 2 layers and demaps it back, against the layers
+ *      expected. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_lm_check_one_cw (UInt32* pCw, const UInt32* pExp0, const UInt32* pExp1, UInt32 numLayerSymb)
+{
+    UInt32              numErr = 0;
+
+    lteLmCheckX0 [numLayerSymb]         =   LTE_LM_CHECK_GUARD;
+    lteLmCheckX1 [numLayerSymb]         =   LTE_LM_CHECK_GUARD;
+    lte_layer_map (pCw, NULL, numLayerSymb, lteLmCheckX0, lteLmCheckX1);
+    numErr  +=  lte_lm_check_cmp ("x0", numLayerSymb, lteLmCheckX0, pExp0, numLayerSymb);
+    numErr  +=  lte_lm_check_cmp ("x1", numLayerSymb, lteLmCheckX1, pExp1, numLayerSymb);
+
+    /* Demapped from the expected layers, not from those just mapped */
+    lteLmCheckBack [2 * numLayerSymb]   =   LTE_LM_CHECK_GUARD;
+    lte_layer_demap ((UInt32 *) pExp0, (UInt32 *) pExp1, numLayerSymb, lteLmCheckBack, NULL);
+    numErr  +=  lte_lm_check_cmp ("d0", numLayerSymb, lteLmCheckBack, pCw, 2 * numLayerSymb);
+
+    return numErr;
+}
+
+int main (Void)
+{
+    static UInt32       exp0 [LTE_LM_CHECK_MAX_LAYER_SYMB], exp1 [LTE_LM_CHECK_MAX_LAYER_SYMB];
+    UInt32              i, k, n, numErr = 0, numRun = 0;
+
+    /* Known sequence, layers written out from the table */
+    numErr  +=  lte_lm_check_one_cw ((UInt32 *) lteLmCheckCw, lteLmCheckLayer0, lteLmCheckLayer1, 5);
+    numRun  ++;
+
+    for (k = 0; k < sizeof (lteLmCheckNumLayerSymb) / sizeof (lteLmCheckNumLayerSymb [0]); k ++)
+    {
+        n   =   lteLmCheckNumLayerSymb [k];
+        for (i = 0; i < 2 * n; i ++)
+            lteLmCheckCw0 [i]   =   0x50000000 | (k << 20) | i;
+        for (i = 0; i < n; i ++)
+        {
+            lteLmCheckCw1 [i]   =   0x60000000 | (k << 20) | i;
+            exp0 [i]            =   lteLmCheckCw0 [2 * i];
+            exp1 [i]            =   lteLmCheckCw0 [2 * i + 1];
+        }
+        numErr  +=  lte_lm_check_one_cw (lteLmCheckCw0, exp0, exp1, n);
+        numRun  ++;
+
+        /* Two codewords, one per layer */
+        lteLmCheckX0 [n]    =   LTE_LM_CHECK_GUARD;
+        lteLmCheckX1 [n]    =   LTE_LM_CHECK_GUARD;
+        lte_layer_map (lteLmCheckCw0, lteLmCheckCw1, n, lteLmCheckX0, lteLmCheckX1);
+        numErr  +=  lte_lm_check_cmp ("x0", n, lteLmCheckX0, lteLmCheckCw0, n);
+        numErr  +=  lte_lm_check_cmp ("x1", n, lteLmCheckX1, lteLmCheckCw1, n);
+
+        lteLmCheckBack [n]  =   LTE_LM_CHECK_GUARD;
+        lte_layer_demap (lteLmCheckX0, lteLmCheckX1, n, lteLmCheckBack, lteLmCheckCw1);
+        numErr  +=  lte_lm_check_cmp ("d0", n, lteLmCheckBack, lteLmCheckCw0, n);
+
+        /* Layers aliasing the codewords are left as they are */
+        memcpy (exp0, lteLmCheckCw0, n * 4);
+        memcpy (exp1, lteLmCheckCw1, n * 4);
+        lte_layer_map (exp0, exp1, n, exp0, exp1);
+        lte_layer_demap (exp0, exp1, n, exp0, exp1);
+        if (memcmp (exp0, lteLmCheckCw0, n * 4) != 0 || memcmp (exp1, lteLmCheckCw1, n * 4) != 0)
+        {
+            Bcp_osalLog ("%d symbols per layer: aliased codewords changed \n", n);
+            numErr ++;
+        }
+        numRun  ++;
+    }
+
+    Bcp_osalLog ("%d layer mappings, %d errors \n", numRun, numErr);
+    Bcp_osalLog ("Layer mapper check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
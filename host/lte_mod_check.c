@@ -0,0 +1,193 @@
+/**
+ *   @file  lte_mod_check.c
+ *
+ *   @brief
+ *      Host check of the compressed mode modulator output expander,
+ *      lte_mod_expand () of test_lte_mod.c, against the constellations of
+ *      3GPP TS 36.211 section 7.1:
+ *
+ *      -   BPSK, QPSK and 16 QAM against Tables 7.1.1-1, 7.1.2-1 and 7.1.3-1,
+ *          written out in full below.
+ *
+ *      -   64 QAM and 256 QAM against Tables 7.1.4-1 and 7.1.5-1. In these
+ *          the I amplitude depends only on b(i), b(i + 2), ... and the Q
+ *          amplitude only on b(i + 1), b(i + 3), ..., so the tables are
+ *          written out as their I (Q) amplitude per even (odd) bits.
+ *
+ *      Every constellation index is expanded, at several positions in the
+ *      packed words (straddling two words for 64 QAM), for numbers of symbols
+ *      ending on and off a word boundary and several unit amplitudes. Nothing
+ *      must be written past the last symbol.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -I host -I . -o lte_mod_check host/lte_mod_check.c
+ *          test_lte_mod.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_mod_check
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Largest number of symbols expanded */
+#define     LTE_MOD_CHECK_MAX_SYMB              (3 * 256 + 31)
+
+/* Written past the last symbol, must be left alone */
+#define     LTE_MOD_CHECK_GUARD                 0xDEADBEEF
+
+/* Table 7.1.1-1, b(i) = 0 and 1, I and Q in units of 1/sqrt(2) */
+static const Int8 lteModCheckBpsk [2][2] = {{1, 1}, {-1, -1}};
+
+/* Table 7.1.2-1, b(i)b(i + 1) = 00 ... 11, in units of 1/sqrt(2) */
+static const Int8 lteModCheckQpsk [4][2] = {{1, 1}, {1, -1}, {-1, 1}, {-1, -1}};
+
+/* Table 7.1.3-1, b(i)b(i + 1)b(i + 2)b(i + 3) = 0000 ... 1111, in units of
+ * 1/sqrt(10)
+ */
+static const Int8 lteModCheck16Qam [16][2] =
+{
+    { 1,  1}, { 1,  3}, { 3,  1}, { 3,  3}, { 1, -1}, { 1, -3}, { 3, -1}, { 3, -3},
+    {-1,  1}, {-1,  3}, {-3,  1}, {-3,  3}, {-1, -1}, {-1, -3}, {-3, -1}, {-3, -3}
+};
+
+/* Table 7.1.4-1, I amplitude of b(i)b(i + 2)b(i + 4) = 000 ... 111 (Q
+ * amplitude of b(i + 1)b(i + 3)b(i + 5)), in units of 1/sqrt(42)
+ */
+static const Int8 lteModCheck64QamAmp [8] = {3, 1, 5, 7, -3, -1, -5, -7};
+
+/* Table 7.1.5-1, I amplitude of b(i)b(i + 2)b(i + 4)b(i + 6) = 0000 ... 1111
+ * (Q amplitude of b(i + 1)b(i + 3)b(i + 5)b(i + 7)), in units of 1/sqrt(170)
+ */
+static const Int8 lteModCheck256QamAmp [16] =
+{
+    5, 7, 3, 1, 11, 9, 13, 15, -5, -7, -3, -1, -11, -9, -13, -15
+};
+
+static const UInt8  lteModCheckQm [] = {1, 2, 4, 6, 8};
+static const UInt16 lteModCheckRms [] = {1, 4096, 8192, 16384};
+
+static UInt32   lteModCheckPacked [(LTE_MOD_CHECK_MAX_SYMB * 8 + 31) / 32];
+static UInt32   lteModCheckOut [LTE_MOD_CHECK_MAX_SYMB + 1];
+
+/** ============================================================================
+ *   @n@b lte_mod_check_amp
+ *
+ *   @b Description
+ *   @n Returns the I (comp = 0) or Q (comp = 1) amplitude of bits
+ *      b(i) ... b(i + mod - 1) from the 36.211 tables. b(i) is the first,
+ *      most significant, bit of the table entries.
+ * =============================================================================
+ */
+static Int32 lte_mod_check_amp (UInt8 mod, const UInt8* pBits, UInt32 comp)
+{
+    UInt32              j, v = 0;
+
+    switch (mod)
+    {
+        case 1:
+            return lteModCheckBpsk [pBits [0]][comp];
+        case 2:
+            return lteModCheckQpsk [(pBits [0] << 1) | pBits [1]][comp];
+        case 4:
+            return lteModCheck16Qam [(pBits [0] << 3) | (pBits [1] << 2) | (pBits [2] << 1) | pBits [3]][comp];
+        default:
+            for (j = comp; j < mod; j += 2)
+                v   =   (v << 1) | pBits [j];
+            return (mod == 6) ? lteModCheck64QamAmp [v] : lteModCheck256QamAmp [v];
+    }
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_check_run
+ *
+ *   @b Description
+ *   @n Packs numSymb constellation indices, symbol n being (start + 7 n)
+ *      modulo 2^mod, expands them and compares every I/Q word with the
+ *      tables. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_mod_check_run (UInt8 mod, UInt16 uva, UInt32 start, UInt32 numSymb)
+{
+    UInt8               bits [8];
+    UInt32              n, j, pos, idx, expWord, numErr = 0;
+    Int32               ampI, ampQ;
+
+    memset (lteModCheckPacked, 0, sizeof (lteModCheckPacked));
+    for (n = 0, pos = 0; n < numSymb; n ++)
+    {
+        idx =   (start + 7 * n) & ((1u << mod) - 1);
+        for (j = 0; j < mod; j ++, pos ++)
+            lteModCheckPacked [pos >> 5]    |=  ((idx >> j) & 1) << (pos & 31);
+    }
+    if (lte_mod_packed_size (numSymb, mod) != (pos + 7) / 8)
+    {
+        Bcp_osalLog ("Qm %d, %d symbols: packed size %d, expected %d \n", mod, numSymb,
+                     lte_mod_packed_size (numSymb, mod), (pos + 7) / 8);
+        numErr ++;
+    }
+
+    lteModCheckOut [numSymb]    =   LTE_MOD_CHECK_GUARD;
+    lte_mod_expand (lteModCheckPacked, numSymb, mod, uva, lteModCheckOut);
+
+    for (n = 0; n < numSymb; n ++)
+    {
+        /* Bit j of the index is b(i + j), packed LSB first */
+        idx =   (start + 7 * n) & ((1u << mod) - 1);
+        for (j = 0; j < mod; j ++)
+            bits [j]    =   (idx >> j) & 1;
+
+        ampI    =   lte_mod_check_amp (mod, bits, 0) * uva;
+        ampQ    =   lte_mod_check_amp (mod, bits, 1) * uva;
+        expWord =   ((UInt32) (UInt16) ampI << 16) | (UInt16) ampQ;
+        if (lteModCheckOut [n] != expWord && numErr ++ < 4)
+            Bcp_osalLog ("Qm %d, uva %d: symbol %d, index 0x%02x = 0x%08x, expected 0x%08x \n",
+                         mod, uva, n, idx, lteModCheckOut [n], expWord);
+    }
+    if (lteModCheckOut [numSymb] != LTE_MOD_CHECK_GUARD)
+    {
+        Bcp_osalLog ("Qm %d, %d symbols: written past the last symbol \n", mod, numSymb);
+        numErr ++;
+    }
+
+    return numErr;
+}
+
+int main (Void)
+{
+    UInt32              q, r, k, numIdx, numErr = 0, numRun = 0;
+    UInt32              numSymb [4];
+    UInt16              uva;
+    UInt8               mod;
+
+    for (q = 0; q < sizeof (lteModCheckQm); q ++)
+    {
+        mod     =   lteModCheckQm [q];
+        numIdx  =   1u << mod;
+
+        /* One symbol, a single word, every index three times (7 is coprime
+         * to 2^mod) at different offsets in the words, and that plus a
+         * partial word
+         */
+        numSymb [0] =   1;
+        numSymb [1] =   32 / mod;
+        numSymb [2] =   3 * numIdx + (numIdx < 32 ? 32 : 0);
+        numSymb [3] =   numSymb [2] + 32 / mod - 1;
+
+        for (r = 0; r < sizeof (lteModCheckRms) / sizeof (lteModCheckRms [0]); r ++)
+        {
+            uva =   lte_mod_hard_uva (mod, lteModCheckRms [r]);
+            for (k = 0; k < 4; k ++)
+            {
+                numErr  +=  lte_mod_check_run (mod, uva, k * 5, numSymb [k]);
+                numRun  ++;
+            }
+        }
+    }
+
+    Bcp_osalLog ("%d expansions, %d errors \n", numRun, numErr);
+    Bcp_osalLog ("Modulator expansion check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
@@ -0,0 +1,204 @@
+/**
+ *   @file  lte_ref_dl_check.c
+ *
+ *   @brief
+ *      Host check of the DL chain model (test_lte_ref.c) that checks the DL
+ *      test output with LTE_DL_REF_MODEL defined, against the golden output
+ *      of the test grant:
+ *
+ *      -   The grant of lte/pdsch_parameters_DV021.dat and the transport
+ *          block of lte/pdsch_inforBits_0002.dat are set up as the DL test
+ *          does, and the model run on its worker thread with the chain
+ *          configuration of prepare_dl_ref_chain ().
+ *
+ *      -   Its output must be the I/Q words of lte/pdsch_modOut_0002.dat, the
+ *          reference output the golden table of the DL test is packed from.
+ *          Built with LTE_DL_MOD_COMPRESSED defined, the model outputs the
+ *          packed constellation indices, which must be the size BCP returns
+ *          and expand to the same I/Q words.
+ *
+ *      Build and run from the test directory, in both modulator modes:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -ffunction-sections -Wl,--gc-sections -DLTE_DL_REF_MODEL -I host -I .
+ *          -o lte_ref_dl_check host/lte_ref_dl_check.c test_common.c test_hdr_tmpl.c test_pkt_meta.c
+ *          test_lte_mod.c test_lte_ref.c test_param.c host/bcp_hdr_host.c host/bcp_host.c
+ *          host/qmss_emu.c -lpthread -lm
+ *      ./lte_ref_dl_check
+ *
+ *      gcc ... -DLTE_DL_MOD_COMPRESSED -o lte_ref_dl_check_packed ...
+ *      ./lte_ref_dl_check_packed
+ *
+ *      The test sources are included so that their static functions can be
+ *      called; the test functions that need BIOS or the BCP LLD are left out
+ *      by the linker.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdlib.h>
+#include "test_lte_dl.c"
+
+#ifndef LTE_DL_REF_MODEL
+#error "Build with LTE_DL_REF_MODEL defined"
+#endif
+
+/* Test vectors, from the test directory */
+#define     LTE_REF_DL_CHECK_CFG_FILE           "lte/pdsch_parameters_DV021.dat"
+#define     LTE_REF_DL_CHECK_TB_FILE            "lte/pdsch_inforBits_0002.dat"
+#define     LTE_REF_DL_CHECK_OUT_FILE           "lte/pdsch_modOut_0002.dat"
+
+static UInt32   lteRefDlCheckGolden [LTE_DL_OUTPUT_PKT_1_WRD_SIZE];
+#ifdef LTE_DL_MOD_COMPRESSED
+static UInt32   lteRefDlCheckExpand [LTE_DL_OUTPUT_PKT_1_WRD_SIZE];
+#endif
+
+/* From test_main.c, which is not linked. There is one core on the host and
+ * its addresses are global.
+ */
+UInt32 convert_coreLocalToGlobalAddr (UInt32 addr)
+{
+    return addr;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_check_read
+ *
+ *   @b Description
+ *   @n Reads the words of a test vector file, at most maxWords. Returns the
+ *      number of bytes read, or -1 if the file cannot be opened or has more
+ *      words.
+ * =============================================================================
+ */
+static Int32 lte_ref_dl_check_read (const char* pFile, UInt32* pWords, UInt32 maxWords)
+{
+    FILE*               pVecFile;
+    UInt32              word, len = 0;
+
+    if ((pVecFile = fopen (pFile, "r")) == NULL)
+    {
+        Bcp_osalLog ("Cannot open %s \n", pFile);
+        return -1;
+    }
+    while (fscanf (pVecFile, "0x%x\n", &word) == 1)
+    {
+        if (len == maxWords * 4)
+        {
+            Bcp_osalLog ("%s has more than %d words \n", pFile, maxWords);
+            len =   (UInt32) -1;
+            break;
+        }
+        pWords [len >> 2]   =   word;
+        len                 +=  4;
+    }
+    fclose (pVecFile);
+
+    return (Int32) len;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_check_grant
+ *
+ *   @b Description
+ *   @n Sets up the grant of the DL test configuration, as
+ *      @a read_test_grant () does from its test vectors, the transport
+ *      block read into lteDlPayload.
+ * =============================================================================
+ */
+static Int32 lte_ref_dl_check_grant (BcpTest_LteDlGrant* pGrant)
+{
+    FILE*               pCfgFile;
+    Int32               tbLen;
+
+    if ((pCfgFile = fopen (LTE_REF_DL_CHECK_CFG_FILE, "r")) == NULL)
+    {
+        Bcp_osalLog ("Cannot open %s \n", LTE_REF_DL_CHECK_CFG_FILE);
+        return -1;
+    }
+    numLayers   =   1;
+    if (read_test_config (pCfgFile) < 0)
+    {
+        Bcp_osalLog ("Invalid test configuration: %s \n", LTE_REF_DL_CHECK_CFG_FILE);
+        fclose (pCfgFile);
+        return -1;
+    }
+    fclose (pCfgFile);
+
+    if ((tbLen = lte_ref_dl_check_read (LTE_REF_DL_CHECK_TB_FILE, (UInt32 *) lteDlPayload, sizeof (lteDlPayload) / 4)) < 0)
+        return -1;
+
+    memset (pGrant, 0, sizeof (BcpTest_LteDlGrant));
+    pGrant->tbSize      =   tbSize;
+    pGrant->numBitsG    =   numBitsG;
+    pGrant->Nir         =   Nir;
+    pGrant->rnti        =   rnti;
+    pGrant->cellID      =   cellID;
+    pGrant->modulation  =   modulation;
+    pGrant->numLayers   =   numLayers;
+    pGrant->rvIdx       =   rvIdx;
+    pGrant->codeWordIdx =   codeWordIdx;
+    pGrant->ns          =   ns;
+    pGrant->pPayload    =   lteDlPayload;
+    pGrant->payloadLen  =   tbLen;
+
+    return 0;
+}
+
+int main (Void)
+{
+    BcpTest_LteDlGrant      grant;
+    BcpTest_LteRefChainCfg  chainCfg;
+    BcpTest_LteRefJob*      pJob;
+    const UInt32*           pOut;
+    const UInt32*           pWords;
+    UInt32                  outLen, expLen, i, numErr = 0;
+    Int32                   goldenLen;
+
+    if (lte_ref_dl_check_grant (&grant) < 0 ||
+        (goldenLen = lte_ref_dl_check_read (LTE_REF_DL_CHECK_OUT_FILE, lteRefDlCheckGolden,
+                                            LTE_DL_OUTPUT_PKT_1_WRD_SIZE)) != LTE_DL_OUTPUT_PKT_1_WRD_SIZE * 4)
+    {
+        Bcp_osalLog ("LTE DL reference model check FAILED \n");
+        return 1;
+    }
+
+    prepare_dl_ref_chain (&grant, &chainCfg);
+    if ((pJob = lte_ref_dl_start (&chainCfg, grant.pPayload)) == NULL ||
+        (pOut = lte_ref_dl_wait (pJob, &outLen)) == NULL)
+    {
+        Bcp_osalLog ("DL reference model failed \n");
+        Bcp_osalLog ("LTE DL reference model check FAILED \n");
+        lte_ref_dl_release (pJob);
+        return 1;
+    }
+
+#ifdef LTE_DL_MOD_COMPRESSED
+    /* Packed indices, the size of the BCP output, expanded to I/Q words */
+    expLen  =   lte_mod_packed_size (LTE_DL_OUTPUT_PKT_1_WRD_SIZE, modulation);
+    lte_mod_expand (pOut, LTE_DL_OUTPUT_PKT_1_WRD_SIZE, modulation,
+                    lte_mod_hard_uva (modulation, LTE_DL_MOD_RMS), lteRefDlCheckExpand);
+    pWords  =   lteRefDlCheckExpand;
+#else
+    expLen  =   LTE_DL_OUTPUT_PKT_1_WRD_SIZE * 4;
+    pWords  =   pOut;
+#endif
+    if (outLen != expLen)
+    {
+        Bcp_osalLog ("Model output of %d bytes, expected %d \n", outLen, expLen);
+        numErr ++;
+    }
+    else
+    {
+        for (i = 0; i < LTE_DL_OUTPUT_PKT_1_WRD_SIZE; i ++)
+        {
+            if (pWords [i] != lteRefDlCheckGolden [i] && numErr ++ < 4)
+                Bcp_osalLog ("Word %d = 0x%08x, expected 0x%08x \n", i, pWords [i], lteRefDlCheckGolden [i]);
+        }
+    }
+    lte_ref_dl_release (pJob);
+
+    Bcp_osalLog ("%d words, %s modulator, %d errors \n", LTE_DL_OUTPUT_PKT_1_WRD_SIZE,
+                 (LTE_DL_MOD_OPERATION_MODE == 1) ? "compressed" : "uncompressed", numErr);
+    Bcp_osalLog ("LTE DL reference model check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
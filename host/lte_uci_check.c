@@ -0,0 +1,358 @@
+/**
+ *   @file  lte_uci_check.c
+ *
+ *   @brief
+ *      Host check of the UCI references of test_lte_uci.c:
+ *
+ *      -   Every CQI value of 1 to 11 bits runs through the (32, O) block
+ *          encoder and the Walsh-Hadamard decoder, as for CQI passed through
+ *          by BCP (cqi_pass_through = 1). The LLRs of each codeword have
+ *          LTE_UCI_CHECK_NUM_ERRS bits flipped, which the decoder must
+ *          correct.
+ *
+ *      -   lte_uci_compute_res () against the exact ceiling of 36.212 section
+ *          5.2.2.6, worked out here in 64 bit integers from the beta offsets
+ *          of 36.213 Tables 8.6.3-1 to 8.6.3-3, over a bounded sweep: 1 to
+ *          110 PRBs, 8 to 14 symbols, every beta offset index, UCI payloads
+ *          of 1 to 255 bits and every single code block size of 36.212 Table
+ *          5.1.3-3 plus a few multi block sums, 16 allocations per batch.
+ *
+ *      -   The single precision float computation it replaced, over the same
+ *          sweep. It must match the exact ceiling wherever its product
+ *          O * M_sc * N_symb * beta is below 2^23 (LTE_UCI_CHECK_FLT_EXACT).
+ *          Above that the quotient, and from 2^24 the product too, is
+ *          rounded and it may legitimately be one off either way, which is
+ *          only counted. Two allocations known to be off, one short and one
+ *          over, are checked to be exact in lte_uci_compute_res () and off
+ *          in the float computation.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -I host -I . -o lte_uci_check host/lte_uci_check.c
+ *          test_lte_uci.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./lte_uci_check
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <math.h>
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Short CQI (32, O) block code round trip */
+#define     LTE_UCI_CHECK_BATCH                 64      // CQI values encoded/decoded per call
+#define     LTE_UCI_CHECK_LLR                   16      // LLR magnitude of a coded bit
+#define     LTE_UCI_CHECK_NUM_ERRS              2       // Coded bits flipped per codeword
+
+static UInt16   lteUciCheckCqi [LTE_UCI_CHECK_BATCH];
+static UInt16   lteUciCheckDecoded [LTE_UCI_CHECK_BATCH];
+static UInt32   lteUciCheckCode [LTE_UCI_CHECK_BATCH];
+static Int8     lteUciCheckLlr [LTE_UCI_CHECK_BATCH * 32];
+
+/* Beta offsets of 36.213 Tables 8.6.3-1 (ACK), 8.6.3-2 (RI) and 8.6.3-3
+ * (CQI), by I_offset, 0 for the reserved ones
+ */
+static const float lteUciCheckBetaAck [16] =
+{
+    2.0f, 2.5f, 3.125f, 4.0f, 5.0f, 6.25f, 8.0f, 10.0f, 12.625f, 15.875f, 20.0f, 31.0f, 50.0f, 80.0f, 126.0f, 0.f
+};
+static const float lteUciCheckBetaRi [16] =
+{
+    1.25f, 1.625f, 2.0f, 2.5f, 3.125f, 4.0f, 5.0f, 6.25f, 8.0f, 10.0f, 12.625f, 15.875f, 20.0f, 0.f, 0.f, 0.f
+};
+static const float lteUciCheckBetaCqi [16] =
+{
+    0.f, 0.f, 1.125f, 1.25f, 1.375f, 1.625f, 1.75f, 2.0f, 2.25f, 2.5f, 2.875f, 3.125f, 3.5f, 4.0f, 5.0f, 6.25f
+};
+
+/* UCI payloads swept, in bits */
+static const UInt8  lteUciCheckNumBits [] = {1, 2, 4, 7, 11, 20, 63, 255};
+
+/* Multi block sums of code block sizes swept, after the single blocks */
+static const UInt32 lteUciCheckSumKr [] = {12288, 24576, 36864, 75376};
+
+/* Below this float product, the float computation must be exact. A
+ * quotient within a float rounding of an integer needs 8 times the product
+ * to reach 2^24, so it is exact below 2^21; an exhaustive search of 1 to 255 bits, 1 to 110 PRBs, 8 to 14 symbols, every beta offset
+ * and every sumKr multiple of 8 up to 75376 finds no difference below 2^23.
+ */
+#define     LTE_UCI_CHECK_FLT_EXACT             8388608.0f
+
+/* ACK allocations the float computation is one off at, above 2^23 */
+typedef struct _LteUciCheckFltOff
+{
+    UInt8               numBits;
+    UInt8               numPrb;
+    UInt8               numSymb;
+    UInt8               ackIdx;
+    UInt32              sumKr;
+    UInt32              fltQ;
+    UInt32              exactQ;
+} LteUciCheckFltOff;
+
+static const LteUciCheckFltOff lteUciCheckFltOff [] =
+{
+    {63,    101,    14,     9,      4568,   3715,   3716},
+    {63,    109,    13,     14,     31752,  4252,   4251}
+};
+
+/* Allocations per lte_uci_compute_res () call, one per beta offset index */
+#define     LTE_UCI_CHECK_RES_BATCH             16
+
+/** ============================================================================
+ *   @n@b lte_uci_check_rm32
+ *
+ *   @b Description
+ *   @n Encodes and decodes every CQI value of 1 to 11 bits, with
+ *      LTE_UCI_CHECK_NUM_ERRS coded bits flipped. Returns the number of CQI
+ *      values not decoded back.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_rm32 (UInt32* pNumVals)
+{
+    UInt32              numBits, numVals, base, numUe, n, i, pos, numErr = 0;
+
+    *pNumVals   =   0;
+    for (numBits = 1; numBits <= 11; numBits ++)
+    {
+        numVals =   1u << numBits;
+        for (base = 0; base < numVals; base += numUe)
+        {
+            numUe   =   (numVals - base < LTE_UCI_CHECK_BATCH) ? (numVals - base) : LTE_UCI_CHECK_BATCH;
+            for (n = 0; n < numUe; n ++)
+                lteUciCheckCqi [n]  =   (UInt16) (base + n);
+
+            lte_uci_rm32_encode (lteUciCheckCqi, numUe, lteUciCheckCode);
+
+            /* Positive LLR for a 0 bit, a few bits flipped */
+            for (n = 0; n < numUe; n ++)
+            {
+                for (i = 0; i < 32; i ++)
+                    lteUciCheckLlr [n * 32 + i] =   ((lteUciCheckCode [n] >> i) & 1) ? -LTE_UCI_CHECK_LLR : LTE_UCI_CHECK_LLR;
+                for (i = 0; i < LTE_UCI_CHECK_NUM_ERRS; i ++)
+                {
+                    pos                             =   (base + n + 13 * i) & 31;
+                    lteUciCheckLlr [n * 32 + pos]   =   -lteUciCheckLlr [n * 32 + pos];
+                }
+            }
+
+            lte_uci_rm32_decode (lteUciCheckLlr, 32, numUe, (UInt8) numBits, lteUciCheckDecoded);
+            for (n = 0; n < numUe; n ++)
+            {
+                if (lteUciCheckDecoded [n] != lteUciCheckCqi [n] && numErr ++ < 4)
+                    Bcp_osalLog ("CQI %d of %d bits decoded as %d \n", lteUciCheckCqi [n], numBits, lteUciCheckDecoded [n]);
+            }
+            *pNumVals   +=  numUe;
+        }
+    }
+
+    return numErr;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_check_exact
+ *
+ *   @b Description
+ *   @n Returns min (ceil (numBits * numRe * beta / sumKr), cap) in 64 bit
+ *      integers, beta being a multiple of 1/8.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_exact (UInt32 numBits, UInt32 numRe, float beta, UInt32 sumKr, UInt32 cap)
+{
+    unsigned long long  num = (unsigned long long) numBits * numRe * (UInt32) (beta * 8.0f);
+    unsigned long long  den = (unsigned long long) sumKr * 8;
+    unsigned long long  q = (num + den - 1) / den;
+
+    return (q < cap) ? (UInt32) q : cap;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_check_float
+ *
+ *   @b Description
+ *   @n Returns Q' as the float computation lte_uci_compute_res () replaced
+ *      did it, and the float product it divided.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_float (UInt32 numBits, UInt32 numPrb, UInt32 numSymb, float beta, UInt32 sumKr,
+                                   UInt32 cap, float* pProd)
+{
+    float               temp;
+    UInt32              q;
+
+    temp    =   numBits * numPrb * 12 * numSymb * beta;
+    *pProd  =   temp;
+    temp    =   (float) ceil (temp / (float) sumKr);
+    q       =   (UInt32) temp;
+
+    return (q < cap) ? q : cap;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_check_sum_kr
+ *
+ *   @b Description
+ *   @n Returns the k-th sum of code block sizes swept: the 188 block sizes of
+ *      36.212 Table 5.1.3-3, then the multi block sums. 0 past the last one.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_sum_kr (UInt32 k)
+{
+    if (k < 60)
+        return 40 + 8 * k;
+    else if (k < 92)
+        return 512 + 16 * (k - 59);
+    else if (k < 124)
+        return 1024 + 32 * (k - 91);
+    else if (k < 188)
+        return 2048 + 64 * (k - 123);
+    else if (k - 188 < sizeof (lteUciCheckSumKr) / sizeof (lteUciCheckSumKr [0]))
+        return lteUciCheckSumKr [k - 188];
+    else
+        return 0;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_check_res
+ *
+ *   @b Description
+ *   @n Sweeps lte_uci_compute_res () against the exact ceiling and the float
+ *      computation. Returns the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_res (UInt32* pNumAlloc, UInt32* pNumFltOff)
+{
+    BcpTest_LteUciRes   res [LTE_UCI_CHECK_RES_BATCH];
+    UInt32              numPrb, numSymb, numRe, numSc, b, k, n, sumKr, expAck, expRi, expCqi, numErr = 0;
+    UInt32              fltAck, fltRi, fltCqi;
+    float               prodAck, prodRi, prodCqi;
+    UInt8               numBits;
+
+    *pNumAlloc      =   0;
+    *pNumFltOff     =   0;
+    for (k = 0; (sumKr = lte_uci_check_sum_kr (k)) != 0; k ++)
+    {
+        for (numPrb = 1; numPrb <= 110; numPrb ++)
+        {
+            for (numSymb = 8; numSymb <= 14; numSymb ++)
+            {
+                for (b = 0; b < sizeof (lteUciCheckNumBits); b ++)
+                {
+                    numBits =   lteUciCheckNumBits [b];
+                    for (n = 0; n < LTE_UCI_CHECK_RES_BATCH; n ++)
+                    {
+                        res [n].sumKr       =   sumKr;
+                        res [n].numPrb      =   (UInt16) numPrb;
+                        res [n].numSymb     =   (UInt8) numSymb;
+                        res [n].numAckBits  =   numBits;
+                        res [n].ackIdx      =   (UInt8) n;
+                        res [n].numRiBits   =   numBits;
+                        res [n].riIdx       =   (UInt8) ((n + 5) & 0xF);
+                        res [n].numCqiBits  =   numBits;
+                        res [n].cqiIdx      =   (UInt8) ((n + 11) & 0xF);
+                    }
+                    lte_uci_compute_res (res, LTE_UCI_CHECK_RES_BATCH);
+
+                    numSc   =   numPrb * 12;
+                    numRe   =   numSc * numSymb;
+                    for (n = 0; n < LTE_UCI_CHECK_RES_BATCH; n ++)
+                    {
+                        expAck  =   lte_uci_check_exact (numBits, numRe, lteUciCheckBetaAck [res [n].ackIdx], sumKr, 4 * numSc);
+                        expRi   =   lte_uci_check_exact (numBits, numRe, lteUciCheckBetaRi [res [n].riIdx], sumKr, 4 * numSc);
+                        expCqi  =   lte_uci_check_exact (numBits, numRe, lteUciCheckBetaCqi [res [n].cqiIdx], sumKr, numRe - expRi);
+                        if ((res [n].numAckSubcs != expAck || res [n].numRiSubcs != expRi || res [n].numCqiSubcs != expCqi) &&
+                            numErr ++ < 4)
+                        {
+                            Bcp_osalLog ("%d PRBs, %d symbols, %d bits, sumKr %d: Q' %d %d %d, expected %d %d %d \n",
+                                         numPrb, numSymb, numBits, sumKr, res [n].numAckSubcs, res [n].numRiSubcs,
+                                         res [n].numCqiSubcs, expAck, expRi, expCqi);
+                        }
+
+                        fltAck  =   lte_uci_check_float (numBits, numPrb, numSymb, lteUciCheckBetaAck [res [n].ackIdx],
+                                                         sumKr, 4 * numSc, &prodAck);
+                        fltRi   =   lte_uci_check_float (numBits, numPrb, numSymb, lteUciCheckBetaRi [res [n].riIdx],
+                                                         sumKr, 4 * numSc, &prodRi);
+                        fltCqi  =   lte_uci_check_float (numBits, numPrb, numSymb, lteUciCheckBetaCqi [res [n].cqiIdx],
+                                                         sumKr, numRe - fltRi, &prodCqi);
+                        if (fltAck != expAck || fltRi != expRi || fltCqi != expCqi)
+                        {
+                            /* Exact below 2^24, CQI as long as its cap (from RI) is */
+                            if ((fltAck != expAck && prodAck < LTE_UCI_CHECK_FLT_EXACT) ||
+                                (fltRi != expRi && prodRi < LTE_UCI_CHECK_FLT_EXACT) ||
+                                (fltCqi != expCqi && prodCqi < LTE_UCI_CHECK_FLT_EXACT && fltRi == expRi))
+                            {
+                                if (numErr ++ < 4)
+                                    Bcp_osalLog ("%d PRBs, %d symbols, %d bits, sumKr %d: float Q' %d %d %d, expected %d %d %d \n",
+                                                 numPrb, numSymb, numBits, sumKr, fltAck, fltRi, fltCqi, expAck, expRi, expCqi);
+                            }
+                            else
+                                (*pNumFltOff) ++;
+                        }
+                    }
+                    *pNumAlloc  +=  LTE_UCI_CHECK_RES_BATCH;
+                }
+            }
+        }
+
+    }
+
+    return numErr;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_check_flt_off
+ *
+ *   @b Description
+ *   @n Checks the allocations of lteUciCheckFltOff: Q'ACK exact from
+ *      lte_uci_compute_res (), one off from the float computation. Returns
+ *      the number of errors.
+ * =============================================================================
+ */
+static UInt32 lte_uci_check_flt_off (Void)
+{
+    const LteUciCheckFltOff*    pOff;
+    BcpTest_LteUciRes           res;
+    UInt32                      i, fltQ, numErr = 0;
+    float                       prod;
+
+    for (i = 0; i < sizeof (lteUciCheckFltOff) / sizeof (lteUciCheckFltOff [0]); i ++)
+    {
+        pOff    =   &lteUciCheckFltOff [i];
+        memset (&res, 0, sizeof (res));
+        res.sumKr       =   pOff->sumKr;
+        res.numPrb      =   pOff->numPrb;
+        res.numSymb     =   pOff->numSymb;
+        res.numAckBits  =   pOff->numBits;
+        res.ackIdx      =   pOff->ackIdx;
+        lte_uci_compute_res (&res, 1);
+
+        fltQ    =   lte_uci_check_float (pOff->numBits, pOff->numPrb, pOff->numSymb, lteUciCheckBetaAck [pOff->ackIdx],
+                                         pOff->sumKr, 4 * 12 * pOff->numPrb, &prod);
+        if (res.numAckSubcs != pOff->exactQ || fltQ != pOff->fltQ || prod < LTE_UCI_CHECK_FLT_EXACT)
+        {
+            Bcp_osalLog ("%d PRBs, %d symbols, %d bits, sumKr %d: Q'ACK %d, float %d, expected %d and %d \n",
+                         pOff->numPrb, pOff->numSymb, pOff->numBits, pOff->sumKr, res.numAckSubcs, fltQ,
+                         pOff->exactQ, pOff->fltQ);
+            numErr ++;
+        }
+    }
+
+    return numErr;
+}
+
+int main (Void)
+{
+    UInt32              numVals, numAlloc, numFltOff, numErr;
+
+    numErr  =   lte_uci_check_rm32 (&numVals);
+    Bcp_osalLog ("%d CQI values through the (32, O) block code, %d errors \n", numVals, numErr);
+
+    numErr  +=  lte_uci_check_res (&numAlloc, &numFltOff);
+    numErr  +=  lte_uci_check_flt_off ();
+    Bcp_osalLog ("%d UCI allocations, %d errors in total, float computation off at %d, all above 2^23 \n",
+                 numAlloc, numErr, numFltOff);
+
+    Bcp_osalLog ("UCI check %s \n", numErr ? "FAILED" : "PASSED");
+
+    return numErr ? 1 : 0;
+}
@@ -0,0 +1,603 @@
+/**
+ *   @file  qmss_emu.c
+ *
+ *   @brief
+ *      Host emulation of the QMSS and CPPI low level drivers, see
+ *      qmss_emu.h.
+ *
+ *      Each queue is a bounded MPMC ring of 32 bit entries, each entry a
+ *      descriptor address with its size hint in the low 4 bits. A cell of
+ *      the ring carries a sequence number telling whether it is free for
+ *      the push at its position or holds the entry for the pop at it, so a
+ *      push or pop claims its position with one compare and swap and then
+ *      owns the cell. No lock is taken: a push only ever retries on a cell
+ *      whose pop, a lap behind, has not yet released it. Rings are sized
+ *      for all the descriptors of Qmss_init (), and are allocated the first
+ *      time their queue is opened and kept until Qmss_exit (), so that a
+ *      queue closed while in use by another thread stays safe to access.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sys/mman.h>
+
+#include "qmss_emu.h"
+
+/* Low memory arena for descriptor buffers */
+#define QMSS_EMU_ARENA_SIZE                 (256u << 20)
+#define QMSS_EMU_MIN_ALLOC_SHIFT            6
+#define QMSS_EMU_NUM_SIZE_CLASSES           23
+
+#define QMSS_EMU_CACHE_LINE                 64
+
+/* Ring states */
+#define QMSS_EMU_RING_NONE                  0
+#define QMSS_EMU_RING_INIT                  1
+#define QMSS_EMU_RING_READY                 2
+
+typedef struct _QmssEmuCell
+{
+    atomic_uint         seq;
+    uint32_t            entry;
+} QmssEmuCell;
+
+typedef struct _QmssEmuQueue
+{
+    atomic_uint         refCnt;         /* Opens not yet closed */
+    atomic_uint         ringState;
+    QmssEmuCell*        pCells;
+    _Alignas (QMSS_EMU_CACHE_LINE) atomic_uint  pushPos;
+    _Alignas (QMSS_EMU_CACHE_LINE) atomic_uint  popPos;
+} QmssEmuQueue;
+
+typedef struct _QmssEmuRegion
+{
+    atomic_uint         bInUse;
+    uint8_t*            pBase;
+    uint32_t            descSize;
+    uint32_t            descNum;
+    atomic_uint         nextDesc;       /* Descriptors given out by Cppi_initDescriptor () */
+} QmssEmuRegion;
+
+typedef struct _QmssEmuTypeRange
+{
+    uint32_t            base;
+    uint32_t            num;
+} QmssEmuTypeRange;
+
+/* Queues of each Qmss_QueueType */
+static const QmssEmuTypeRange   qmssEmuTypes [] =
+{
+    {QMSS_LOW_PRIORITY_QUEUE_BASE,          512},
+    {QMSS_AIF_QUEUE_BASE,                   128},
+    {QMSS_PASS_QUEUE_BASE,                  9},
+    {QMSS_INTC_QUEUE_BASE,                  10},
+    {QMSS_SRIO_QUEUE_BASE,                  16},
+    {QMSS_FFTC_A_QUEUE_BASE,                4},
+    {QMSS_FFTC_B_QUEUE_BASE,                4},
+    {QMSS_HIGH_PRIORITY_QUEUE_BASE,         32},
+    {QMSS_STARVATION_COUNTER_QUEUE_BASE,    64},
+    {QMSS_INFRASTRUCTURE_QUEUE_BASE,        32},
+    {QMSS_TRAFFIC_SHAPING_QUEUE_BASE,       32},
+    {QMSS_BCP_QUEUE_BASE,                   8},
+    {QMSS_FFTC_C_QUEUE_BASE,                4},
+    {QMSS_GENERAL_PURPOSE_QUEUE_BASE,       QMSS_MAX_QUEUES - QMSS_GENERAL_PURPOSE_QUEUE_BASE}
+};
+
+static QmssEmuQueue     qmssEmuQueues [QMSS_MAX_QUEUES];
+static QmssEmuRegion    qmssEmuRegions [QMSS_MAX_MEM_REGIONS];
+static uint32_t         qmssEmuRingSize;        /* Power of 2, 0 before Qmss_init () */
+
+static pthread_mutex_t  qmssEmuArenaLock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t*         qmssEmuArena;
+static uint32_t         qmssEmuArenaUsed;
+static void*            qmssEmuFreeList [QMSS_EMU_NUM_SIZE_CLASSES];
+
+const uint32_t          acc48_le [1] = {0};
+const uint32_t          acc48_be [1] = {0};
+
+Qmss_GlobalConfigParams qmssGblCfgParams = {1, QMSS_MAX_QUEUES};
+Cppi_GlobalConfigParams cppiGblCfgParams = {Cppi_CpDma_BCP_CPDMA + 1};
+
+static void qmss_emu_fatal (const char* pMsg, uint32_t val)
+{
+    fprintf (stderr, "QMSS emulation: %s (%u)\n", pMsg, val);
+    abort ();
+}
+
+uint32_t qmss_emu_addr32 (const void* pAddr)
+{
+    if ((uintptr_t) pAddr > 0xFFFFFFFFu)
+        qmss_emu_fatal ("address above 4 GB, link non-PIE and use qmss_emu_alloc ()", 0);
+
+    return (uint32_t) (uintptr_t) pAddr;
+}
+
+static QmssEmuQueue* qmss_emu_queue (Qmss_QueueHnd hnd)
+{
+    QmssEmuQueue*       pQueue;
+
+    if (hnd < 0 || hnd >= QMSS_MAX_QUEUES)
+        qmss_emu_fatal ("invalid queue handle", (uint32_t) hnd);
+    pQueue  =   &qmssEmuQueues [hnd];
+    if (atomic_load_explicit (&pQueue->ringState, memory_order_acquire) != QMSS_EMU_RING_READY)
+        qmss_emu_fatal ("queue not open", (uint32_t) hnd);
+
+    return pQueue;
+}
+
+/* Sets up the ring of a queue on its first open, waiting on any other
+ * thread doing so.
+ */
+static int qmss_emu_ring_init (QmssEmuQueue* pQueue)
+{
+    unsigned            state = QMSS_EMU_RING_NONE;
+    QmssEmuCell*        pCells;
+    uint32_t            i;
+
+    if (atomic_compare_exchange_strong (&pQueue->ringState, &state, QMSS_EMU_RING_INIT))
+    {
+        if ((pCells = (QmssEmuCell *) calloc (qmssEmuRingSize, sizeof (QmssEmuCell))) == NULL)
+        {
+            atomic_store (&pQueue->ringState, QMSS_EMU_RING_NONE);
+            return -1;
+        }
+        for (i = 0; i < qmssEmuRingSize; i ++)
+            atomic_init (&pCells [i].seq, i);
+        pQueue->pCells  =   pCells;
+        atomic_store_explicit (&pQueue->pushPos, 0, memory_order_relaxed);
+        atomic_store_explicit (&pQueue->popPos, 0, memory_order_relaxed);
+        atomic_store_explicit (&pQueue->ringState, QMSS_EMU_RING_READY, memory_order_release);
+        return 0;
+    }
+
+    while ((state = atomic_load_explicit (&pQueue->ringState, memory_order_acquire)) == QMSS_EMU_RING_INIT)
+        ;
+
+    return (state == QMSS_EMU_RING_READY) ? 0 : -1;
+}
+
+static void qmss_emu_push (Qmss_QueueHnd hnd, uint32_t entry)
+{
+    QmssEmuQueue*       pQueue = qmss_emu_queue (hnd);
+    QmssEmuCell*        pCell;
+    uint32_t            mask = qmssEmuRingSize - 1;
+    unsigned            pos, seq;
+
+    pos =   atomic_load_explicit (&pQueue->pushPos, memory_order_relaxed);
+    for (;;)
+    {
+        pCell   =   &pQueue->pCells [pos & mask];
+        seq     =   atomic_load_explicit (&pCell->seq, memory_order_acquire);
+        if (seq == pos)
+        {
+            /* Cell free for this position: claim it */
+            if (atomic_compare_exchange_weak_explicit (&pQueue->pushPos, &pos, pos + 1,
+                                                       memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if ((int32_t) (seq - pos) < 0 &&
+                 (int32_t) (pos - atomic_load_explicit (&pQueue->popPos, memory_order_relaxed)) >= (int32_t) qmssEmuRingSize)
+        {
+            /* Every cell holds an entry. The difference is signed, as pos
+             * may be stale and behind popPos by now.
+             */
+            qmss_emu_fatal ("queue full, more descriptors pushed than given to Qmss_init ()", (uint32_t) hnd);
+        }
+        else
+        {
+            /* Cell claimed by another push, still being popped a lap behind,
+             * or pos stale
+             */
+            pos =   atomic_load_explicit (&pQueue->pushPos, memory_order_relaxed);
+        }
+    }
+
+    pCell->entry    =   entry;
+    atomic_store_explicit (&pCell->seq, pos + 1, memory_order_release);
+}
+
+static void* qmss_emu_pop (Qmss_QueueHnd hnd)
+{
+    QmssEmuQueue*       pQueue = qmss_emu_queue (hnd);
+    QmssEmuCell*        pCell;
+    uint32_t            mask = qmssEmuRingSize - 1, entry;
+    unsigned            pos, seq;
+
+    pos =   atomic_load_explicit (&pQueue->popPos, memory_order_relaxed);
+    for (;;)
+    {
+        pCell   =   &pQueue->pCells [pos & mask];
+        seq     =   atomic_load_explicit (&pCell->seq, memory_order_acquire);
+        if (seq == pos + 1)
+        {
+            /* Cell holds the entry for this position: claim it */
+            if (atomic_compare_exchange_weak_explicit (&pQueue->popPos, &pos, pos + 1,
+                                                       memory_order_relaxed, memory_order_relaxed))
+                break;
+        }
+        else if ((int32_t) (seq - (pos + 1)) < 0)
+        {
+            /* Not pushed yet */
+            return NULL;
+        }
+        else
+            pos =   atomic_load_explicit (&pQueue->popPos, memory_order_relaxed);
+    }
+
+    entry   =   pCell->entry;
+    atomic_store_explicit (&pCell->seq, pos + mask + 1, memory_order_release);
+
+    return (void *) (uintptr_t) entry;
+}
+
+/* Queue entry of a descriptor, with the size hint of the device: the size
+ * in 16 byte units less 1, in the low 4 bits.
+ */
+static uint32_t qmss_emu_entry (void* descAddr, uint32_t descSize)
+{
+    uint32_t            addr = qmss_emu_addr32 (descAddr);
+    uint32_t            hint = 0;
+
+    if (addr & 0xF)
+        qmss_emu_fatal ("descriptor not 16 byte aligned", addr);
+    if (descSize >= 16)
+        hint    =   ((descSize >> 4) - 1) & 0xF;
+
+    return addr | hint;
+}
+
+Qmss_Result Qmss_init (Qmss_InitCfg* initCfg, Qmss_GlobalConfigParams* qmssGblCfgParams)
+{
+    uint32_t            ringSize = 16;
+
+    (void) qmssGblCfgParams;
+    if (initCfg == NULL || initCfg->maxDescNum == 0)
+        return QMSS_INVALID_PARAM;
+
+    while (ringSize < initCfg->maxDescNum)
+        ringSize    <<= 1;
+    qmssEmuRingSize =   ringSize;
+
+    return QMSS_SOK;
+}
+
+Qmss_Result Qmss_start (void)
+{
+    return (qmssEmuRingSize != 0) ? QMSS_SOK : QMSS_NOT_INITIALIZED;
+}
+
+Qmss_Result Qmss_exit (void)
+{
+    uint32_t            q;
+
+    for (q = 0; q < QMSS_MAX_QUEUES; q ++)
+    {
+        free (qmssEmuQueues [q].pCells);
+        memset (&qmssEmuQueues [q], 0, sizeof (QmssEmuQueue));
+    }
+    memset (qmssEmuRegions, 0, sizeof (qmssEmuRegions));
+    qmssEmuRingSize =   0;
+
+    return QMSS_SOK;
+}
+
+Qmss_Result Qmss_insertMemoryRegion (Qmss_MemRegInfo* memRegCfg)
+{
+    QmssEmuRegion*      pRegion;
+    unsigned            bInUse;
+    int32_t             r;
+
+    if (qmssEmuRingSize == 0)
+        return QMSS_NOT_INITIALIZED;
+    if (memRegCfg == NULL || memRegCfg->descBase == NULL || memRegCfg->descNum == 0 ||
+        memRegCfg->descSize < 16 || (memRegCfg->descSize & 0xF) || ((uintptr_t) memRegCfg->descBase & 0xF) ||
+        memRegCfg->memRegion >= QMSS_MAX_MEM_REGIONS)
+        return QMSS_MEMREGION_INVALID_PARAM;
+    qmss_emu_addr32 ((uint8_t *) memRegCfg->descBase + memRegCfg->descSize * memRegCfg->descNum - 1);
+
+    if (memRegCfg->memRegion == Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED)
+    {
+        for (r = 0; r < QMSS_MAX_MEM_REGIONS; r ++)
+        {
+            bInUse  =   0;
+            if (atomic_compare_exchange_strong (&qmssEmuRegions [r].bInUse, &bInUse, 1))
+                break;
+        }
+        if (r == QMSS_MAX_MEM_REGIONS)
+            return QMSS_RESOURCE_MEM_REGION_USE_ERROR;
+        memRegCfg->memRegion    =   (Qmss_MemRegion) r;
+    }
+    else
+    {
+        r       =   memRegCfg->memRegion;
+        bInUse  =   0;
+        if (!atomic_compare_exchange_strong (&qmssEmuRegions [r].bInUse, &bInUse, 1))
+            return QMSS_MEMREGION_ALREADY_INITIALIZED;
+    }
+
+    pRegion             =   &qmssEmuRegions [r];
+    pRegion->pBase      =   (uint8_t *) memRegCfg->descBase;
+    pRegion->descSize   =   memRegCfg->descSize;
+    pRegion->descNum    =   memRegCfg->descNum;
+    atomic_store (&pRegion->nextDesc, 0);
+
+    return r;
+}
+
+Qmss_QueueHnd Qmss_queueOpen (Qmss_QueueType queType, int queNum, uint8_t* isAllocated)
+{
+    QmssEmuQueue*       pQueue;
+    unsigned            refCnt;
+    uint32_t            q, end;
+
+    if (qmssEmuRingSize == 0)
+        return QMSS_NOT_INITIALIZED;
+    if ((uint32_t) queType >= sizeof (qmssEmuTypes) / sizeof (qmssEmuTypes [0]) ||
+        queNum >= QMSS_MAX_QUEUES || (queNum < 0 && queNum != QMSS_PARAM_NOT_SPECIFIED))
+        return QMSS_INVALID_PARAM;
+
+    if (queNum == QMSS_PARAM_NOT_SPECIFIED)
+    {
+        /* First queue of the type not open */
+        end     =   qmssEmuTypes [queType].base + qmssEmuTypes [queType].num;
+        for (q = qmssEmuTypes [queType].base; q < end; q ++)
+        {
+            refCnt  =   0;
+            if (atomic_compare_exchange_strong (&qmssEmuQueues [q].refCnt, &refCnt, 1))
+                break;
+        }
+        if (q == end)
+            return QMSS_RESOURCE_ALLOCATE_USE_ERROR;
+        refCnt  =   1;
+    }
+    else
+    {
+        /* Any queue given by number, opened once more if open already */
+        q       =   (uint32_t) queNum;
+        refCnt  =   atomic_fetch_add (&qmssEmuQueues [q].refCnt, 1) + 1;
+    }
+
+    pQueue  =   &qmssEmuQueues [q];
+    if (qmss_emu_ring_init (pQueue) < 0)
+    {
+        atomic_fetch_sub (&pQueue->refCnt, 1);
+        return QMSS_RESOURCE_ALLOCATE_USE_ERROR;
+    }
+
+    if (isAllocated)
+        *isAllocated    =   (uint8_t) refCnt;
+
+    return (Qmss_QueueHnd) q;
+}
+
+Qmss_Result Qmss_queueClose (Qmss_QueueHnd hnd)
+{
+    QmssEmuQueue*       pQueue = qmss_emu_queue (hnd);
+    unsigned            refCnt = atomic_load (&pQueue->refCnt);
+
+    /* The ring is kept, for any pop racing with the close */
+    do
+    {
+        if (refCnt == 0)
+            return QMSS_INVALID_PARAM;
+    } while (!atomic_compare_exchange_weak (&pQueue->refCnt, &refCnt, refCnt - 1));
+
+    return QMSS_SOK;
+}
+
+void* Qmss_queuePop (Qmss_QueueHnd hnd)
+{
+    return qmss_emu_pop (hnd);
+}
+
+void Qmss_queuePush (Qmss_QueueHnd hnd, void* descAddr, uint32_t packetSize, uint32_t descSize, Qmss_Location location)
+{
+    /* Head pushes are queued at the tail too */
+    (void) packetSize;
+    (void) location;
+    qmss_emu_push (hnd, qmss_emu_entry (descAddr, descSize));
+}
+
+void Qmss_queuePushDesc (Qmss_QueueHnd hnd, void* descAddr)
+{
+    qmss_emu_push (hnd, qmss_emu_entry (descAddr, 0));
+}
+
+void Qmss_queuePushDescSize (Qmss_QueueHnd hnd, void* descAddr, uint32_t descSize)
+{
+    qmss_emu_push (hnd, qmss_emu_entry (descAddr, descSize));
+}
+
+uint32_t Qmss_getQueueEntryCount (Qmss_QueueHnd hnd)
+{
+    QmssEmuQueue*       pQueue = qmss_emu_queue (hnd);
+    unsigned            popPos = atomic_load_explicit (&pQueue->popPos, memory_order_acquire);
+    unsigned            pushPos = atomic_load_explicit (&pQueue->pushPos, memory_order_acquire);
+
+    /* A snapshot, as on the device. Claimed pushes may not have landed yet. */
+    return ((int32_t) (pushPos - popPos) > 0) ? pushPos - popPos : 0;
+}
+
+void Qmss_queueEmpty (Qmss_QueueHnd hnd)
+{
+    while (qmss_emu_pop (hnd) != NULL)
+        ;
+}
+
+Qmss_Queue Qmss_getQueueNumber (Qmss_QueueHnd hnd)
+{
+    Qmss_Queue          queue;
+
+    queue.qMgr  =   (uint16_t) ((uint32_t) hnd >> 12);
+    queue.qNum  =   (uint16_t) (hnd & 0xFFF);
+    return queue;
+}
+
+Qmss_QueueHnd Qmss_getQueueHandle (Qmss_Queue queue)
+{
+    return (Qmss_QueueHnd) (((uint32_t) queue.qMgr << 12) | queue.qNum);
+}
+
+Qmss_Result Qmss_programAccumulator (Qmss_PdspId pdspId, Qmss_AccCmdCfg* cfg)
+{
+    (void) pdspId;
+    (void) cfg;
+    return QMSS_ACC_NOT_EMULATED;
+}
+
+Qmss_Result Qmss_disableAccumulator (Qmss_PdspId pdspId, uint8_t channel)
+{
+    (void) pdspId;
+    (void) channel;
+    return QMSS_ACC_NOT_EMULATED;
+}
+
+Qmss_Result Qmss_setEoiVector (Qmss_IntdInterruptType type, uint8_t accumCh)
+{
+    (void) type;
+    (void) accumCh;
+    return QMSS_SOK;
+}
+
+Qmss_Result Qmss_ackInterrupt (uint8_t interruptNum, uint8_t value)
+{
+    (void) interruptNum;
+    (void) value;
+    return QMSS_SOK;
+}
+
+Cppi_Result Cppi_init (Cppi_GlobalConfigParams* cppiGblCfgParams)
+{
+    (void) cppiGblCfgParams;
+    return CPPI_SOK;
+}
+
+Cppi_Result Cppi_exit (void)
+{
+    return CPPI_SOK;
+}
+
+Qmss_QueueHnd Cppi_initDescriptor (Cppi_DescCfg* descCfg, uint32_t* numAllocated)
+{
+    QmssEmuRegion*      pRegion;
+    Cppi_HostDesc*      pDesc;
+    Qmss_QueueHnd       hQueue;
+    Qmss_Queue          retQueue;
+    uint8_t             isAllocated;
+    unsigned            first, num;
+    uint32_t            i;
+
+    if (descCfg == NULL || numAllocated == NULL || descCfg->memRegion < 0 ||
+        descCfg->memRegion >= QMSS_MAX_MEM_REGIONS)
+        return CPPI_INVALID_PARAM;
+    if (descCfg->descType != Cppi_DescType_HOST)
+        return CPPI_DESC_NOT_EMULATED;
+    pRegion =   &qmssEmuRegions [descCfg->memRegion];
+    if (!atomic_load (&pRegion->bInUse))
+        return CPPI_INVALID_PARAM;
+
+    /* Take the next descriptors of the region, as many as left */
+    first   =   atomic_load (&pRegion->nextDesc);
+    do
+    {
+        num =   pRegion->descNum - first;
+        if (num > descCfg->descNum)
+            num =   descCfg->descNum;
+        if (num == 0)
+            return CPPI_INVALID_PARAM;
+    } while (!atomic_compare_exchange_weak (&pRegion->nextDesc, &first, first + num));
+
+    if ((hQueue = Qmss_queueOpen (descCfg->queueType, descCfg->destQueueNum, &isAllocated)) < 0)
+        return CPPI_QMSS_ERROR;
+
+    if (descCfg->returnQueue.qNum == (uint16_t) QMSS_PARAM_NOT_SPECIFIED)
+        retQueue    =   Qmss_getQueueNumber (hQueue);
+    else
+        retQueue    =   descCfg->returnQueue;
+
+    for (i = 0; i < num; i ++)
+    {
+        pDesc   =   (Cppi_HostDesc *) (pRegion->pBase + (first + i) * pRegion->descSize);
+        if (descCfg->initDesc == Cppi_InitDesc_INIT_DESCRIPTOR)
+        {
+            memset (pDesc, 0, pRegion->descSize);
+            pDesc->descInfo     =   ((uint32_t) Cppi_DescType_HOST << 30) |
+                                    ((uint32_t) descCfg->cfg.host.psLocation << 22);
+            pDesc->packetInfo   =   ((uint32_t) descCfg->epibPresent << 31) |
+                                    ((uint32_t) descCfg->cfg.host.returnPolicy << 15) |
+                                    ((uint32_t) descCfg->returnPushPolicy << 14);
+            Cppi_setReturnQueue (Cppi_DescType_HOST, (Cppi_Desc *) pDesc, retQueue);
+        }
+        Qmss_queuePushDescSize (hQueue, pDesc, pRegion->descSize);
+    }
+
+    *numAllocated   =   num;
+    return hQueue;
+}
+
+/* Size class of an allocation: a power of 2 from 64 bytes */
+static uint32_t qmss_emu_size_class (uint32_t size)
+{
+    uint32_t            c = 0;
+
+    while ((1u << (c + QMSS_EMU_MIN_ALLOC_SHIFT)) < size)
+        c ++;
+    return c;
+}
+
+void* qmss_emu_alloc (uint32_t size, uint32_t align)
+{
+    uint32_t            c = qmss_emu_size_class (size), blockSize;
+    void*               pBlock = NULL;
+
+    /* Blocks are aligned to their size */
+    blockSize   =   1u << (c + QMSS_EMU_MIN_ALLOC_SHIFT);
+    if (c >= QMSS_EMU_NUM_SIZE_CLASSES || align > blockSize)
+        return NULL;
+
+    pthread_mutex_lock (&qmssEmuArenaLock);
+    if (qmssEmuArena == NULL)
+    {
+        qmssEmuArena    =   (uint8_t *) mmap (NULL, QMSS_EMU_ARENA_SIZE, PROT_READ | PROT_WRITE,
+                                              MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT | MAP_NORESERVE, -1, 0);
+        if (qmssEmuArena == (uint8_t *) MAP_FAILED)
+            qmssEmuArena    =   NULL;
+    }
+    if (qmssEmuArena != NULL)
+    {
+        if ((pBlock = qmssEmuFreeList [c]) != NULL)
+            qmssEmuFreeList [c] =   *(void **) pBlock;
+        else
+        {
+            qmssEmuArenaUsed    =   (qmssEmuArenaUsed + blockSize - 1) & ~(blockSize - 1);
+            if (blockSize <= QMSS_EMU_ARENA_SIZE - qmssEmuArenaUsed)
+            {
+                pBlock              =   qmssEmuArena + qmssEmuArenaUsed;
+                qmssEmuArenaUsed    +=  blockSize;
+            }
+        }
+    }
+    pthread_mutex_unlock (&qmssEmuArenaLock);
+
+    return pBlock;
+}
+
+void qmss_emu_free (void* pAddr, uint32_t size)
+{
+    uint32_t            c = qmss_emu_size_class (size);
+
+    if (pAddr == NULL)
+        return;
+
+    pthread_mutex_lock (&qmssEmuArenaLock);
+    *(void **) pAddr    =   qmssEmuFreeList [c];
+    qmssEmuFreeList [c] =   pAddr;
+    pthread_mutex_unlock (&qmssEmuArenaLock);
+}
@@ -0,0 +1,533 @@
+/**
+ *   @file  qmss_emu.h
+ *
+ *   @brief
+ *      Host emulation of the QMSS and CPPI low level drivers.
+ *
+ *      Implements the part of the QMSS/CPPI LLD API used by the tests, so
+ *      that the FDQ setup, descriptor handling and queue code of the tests
+ *      runs on a Linux host. The QMSS/CPPI headers under host/ti/drv stand
+ *      in for those of the PDK and only include this one; the other TI
+ *      headers have stand-ins too (host/bcp_host.h), and host/bcp_host.c
+ *      allocates the buffers of the tests with @a qmss_emu_alloc ().
+ *      host/qmss_emu_test.c runs test_common.c on the emulation.
+ *
+ *      -   Queues are bounded lock-free MPMC rings, any number of threads
+ *          pushing and popping at once. A queue holds all the descriptors
+ *          given to Qmss_init (), so a push never finds it full.
+ *
+ *      -   Descriptors are the application's own memory regions, as
+ *          inserted by Qmss_insertMemoryRegion (), laid out as on the
+ *          device. Host descriptors hold their buffer and link pointers in
+ *          32 bit words, so descriptors and buffers must lie in the low 4 GB
+ *          of the address space: link the application non-PIE for static
+ *          regions such as hostDesc [], and allocate buffers with
+ *          @a qmss_emu_alloc ().
+ *
+ *      -   Queue entries carry the descriptor size hint in their low 4 bits,
+ *          as pushed by Qmss_queuePushDescSize (), stripped by
+ *          QMSS_DESC_PTR () as on the device.
+ *
+ *      Only host descriptors are emulated, queues are only pushed at their
+ *      tail, and there is no PDSP: accumulator channels cannot be
+ *      programmed, so Rx queues are polled. The CPDMA channels, and BCP
+ *      itself, are not emulated.
+ *
+ *      Usage: gcc -no-pie -I host -I . ... host/bcp_host.c host/qmss_emu.c -lpthread
+ *
+ *      Only standard C types are used here, as this header stands in for
+ *      the PDK on the host.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#ifndef _QMSS_EMU_H_
+#define _QMSS_EMU_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**************************************************************
+ ************************** QMSS ******************************
+ **************************************************************/
+
+/** Queues of the emulated queue manager, modelled on the C6670 queue map */
+#define     QMSS_MAX_QUEUES                     8192
+#define     QMSS_LOW_PRIORITY_QUEUE_BASE        0
+#define     QMSS_AIF_QUEUE_BASE                 512
+#define     QMSS_PASS_QUEUE_BASE                640
+#define     QMSS_INTC_QUEUE_BASE                662
+#define     QMSS_SRIO_QUEUE_BASE                672
+#define     QMSS_FFTC_A_QUEUE_BASE              688
+#define     QMSS_FFTC_B_QUEUE_BASE              692
+#define     QMSS_HIGH_PRIORITY_QUEUE_BASE       704
+#define     QMSS_STARVATION_COUNTER_QUEUE_BASE  736
+#define     QMSS_INFRASTRUCTURE_QUEUE_BASE      800
+#define     QMSS_TRAFFIC_SHAPING_QUEUE_BASE     832
+#define     QMSS_BCP_QUEUE_BASE                 864
+#define     QMSS_FFTC_C_QUEUE_BASE              872
+#define     QMSS_GENERAL_PURPOSE_QUEUE_BASE     896
+
+#define     QMSS_MAX_MEM_REGIONS                20
+#define     QMSS_MAX_PDSP                       2
+
+#define     QMSS_PARAM_NOT_SPECIFIED            -1
+
+/** Return codes */
+#define     QMSS_SOK                            0
+#define     QMSS_INVALID_PARAM                  -1
+#define     QMSS_NOT_INITIALIZED                -2
+#define     QMSS_RESOURCE_ALLOCATE_USE_ERROR    -3
+#define     QMSS_RESOURCE_MEM_REGION_USE_ERROR  -4
+#define     QMSS_MEMREGION_ALREADY_INITIALIZED  -5
+#define     QMSS_MEMREGION_INVALID_PARAM        -6
+#define     QMSS_MEMREGION_ORDERING             -7
+#define     QMSS_ACC_NOT_EMULATED               -8
+
+/** Descriptor address of a queue entry, without its size hint */
+#define     QMSS_DESC_PTR(desc)                 ((uintptr_t) (desc) & ~(uintptr_t) 0xF)
+
+typedef int32_t         Qmss_Result;
+typedef int32_t         Qmss_QueueHnd;
+
+typedef struct _Qmss_Queue
+{
+    uint16_t            qMgr;
+    uint16_t            qNum;
+} Qmss_Queue;
+
+typedef enum
+{
+    Qmss_QueueType_LOW_PRIORITY_QUEUE = 0,
+    Qmss_QueueType_AIF_QUEUE,
+    Qmss_QueueType_PASS_QUEUE,
+    Qmss_QueueType_INTC_QUEUE,
+    Qmss_QueueType_SRIO_QUEUE,
+    Qmss_QueueType_FFTC_A_QUEUE,
+    Qmss_QueueType_FFTC_B_QUEUE,
+    Qmss_QueueType_HIGH_PRIORITY_QUEUE,
+    Qmss_QueueType_STARVATION_COUNTER_QUEUE,
+    Qmss_QueueType_INFRASTRUCTURE_QUEUE,
+    Qmss_QueueType_TRAFFIC_SHAPING_QUEUE,
+    Qmss_QueueType_BCP_QUEUE,
+    Qmss_QueueType_FFTC_C_QUEUE,
+    Qmss_QueueType_GENERAL_PURPOSE_QUEUE
+} Qmss_QueueType;
+
+typedef enum
+{
+    Qmss_Location_TAIL = 0,
+    Qmss_Location_HEAD
+} Qmss_Location;
+
+typedef enum
+{
+    Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED = -1,
+    Qmss_MemRegion_MEMORY_REGION0 = 0,
+    Qmss_MemRegion_MEMORY_REGION1,
+    Qmss_MemRegion_MEMORY_REGION2,
+    Qmss_MemRegion_MEMORY_REGION3,
+    Qmss_MemRegion_MEMORY_REGION4,
+    Qmss_MemRegion_MEMORY_REGION5,
+    Qmss_MemRegion_MEMORY_REGION6,
+    Qmss_MemRegion_MEMORY_REGION7,
+    Qmss_MemRegion_MEMORY_REGION8,
+    Qmss_MemRegion_MEMORY_REGION9,
+    Qmss_MemRegion_MEMORY_REGION10,
+    Qmss_MemRegion_MEMORY_REGION11,
+    Qmss_MemRegion_MEMORY_REGION12,
+    Qmss_MemRegion_MEMORY_REGION13,
+    Qmss_MemRegion_MEMORY_REGION14,
+    Qmss_MemRegion_MEMORY_REGION15,
+    Qmss_MemRegion_MEMORY_REGION16,
+    Qmss_MemRegion_MEMORY_REGION17,
+    Qmss_MemRegion_MEMORY_REGION18,
+    Qmss_MemRegion_MEMORY_REGION19
+} Qmss_MemRegion;
+
+typedef enum
+{
+    Qmss_ManageDesc_UNMANAGED_DESCRIPTOR = 0,
+    Qmss_ManageDesc_MANAGE_DESCRIPTOR
+} Qmss_ManageDesc;
+
+typedef enum
+{
+    Qmss_PdspId_PDSP1 = 0,
+    Qmss_PdspId_PDSP2
+} Qmss_PdspId;
+
+typedef enum
+{
+    Qmss_IntdInterruptType_HIGH = 0,
+    Qmss_IntdInterruptType_LOW,
+    Qmss_IntdInterruptType_CDMA
+} Qmss_IntdInterruptType;
+
+typedef struct _Qmss_MemRegInfo
+{
+    uint32_t*           descBase;
+    uint32_t            descSize;       /* Multiple of 16 bytes */
+    uint32_t            descNum;
+    Qmss_ManageDesc     manageDescFlag;
+    Qmss_MemRegion      memRegion;
+    uint32_t            startIndex;
+} Qmss_MemRegInfo;
+
+typedef struct _Qmss_PdspCfg
+{
+    Qmss_PdspId         pdspId;
+    void*               firmware;
+    uint32_t            size;
+} Qmss_PdspCfg;
+
+typedef struct _Qmss_InitCfg
+{
+    uint32_t            linkingRAM0Base;
+    uint32_t            linkingRAM0Size;
+    uint32_t            linkingRAM1Base;
+    uint32_t            maxDescNum;     /* Descriptors of all memory regions */
+    Qmss_PdspCfg        pdspFirmware [QMSS_MAX_PDSP];
+} Qmss_InitCfg;
+
+/** Device configuration, unused by the emulation */
+typedef struct _Qmss_GlobalConfigParams
+{
+    uint32_t            maxQueMgrGroups;
+    uint32_t            maxQueNum;
+} Qmss_GlobalConfigParams;
+
+/** Accumulator channel configuration. Accepted for the drivers built on
+ *  the LLD, but accumulators are not emulated.
+ */
+typedef enum
+{
+    Qmss_AccCmd_DISABLE_CHANNEL = 0x80,
+    Qmss_AccCmd_ENABLE_CHANNEL = 0x81
+} Qmss_AccCmd;
+
+typedef enum
+{
+    Qmss_AccPacingMode_NONE = 0,
+    Qmss_AccPacingMode_LAST_INTERRUPT,
+    Qmss_AccPacingMode_FIRST_NEW_PACKET,
+    Qmss_AccPacingMode_LAST_NEW_PACKET
+} Qmss_AccPacingMode;
+
+typedef enum
+{
+    Qmss_AccEntrySize_REG_D = 0,
+    Qmss_AccEntrySize_REG_CD,
+    Qmss_AccEntrySize_REG_ABCD
+} Qmss_AccEntrySize;
+
+typedef enum
+{
+    Qmss_AccCountMode_NULL_TERMINATE = 0,
+    Qmss_AccCountMode_ENTRY_COUNT
+} Qmss_AccCountMode;
+
+typedef enum
+{
+    Qmss_AccQueueMode_SINGLE_QUEUE = 0,
+    Qmss_AccQueueMode_MULTI_QUEUE
+} Qmss_AccQueueMode;
+
+typedef struct _Qmss_AccCmdCfg
+{
+    uint8_t             channel;
+    Qmss_AccCmd         command;
+    uint32_t            queueEnMask;
+    uint32_t            listAddress;
+    uint16_t            queMgrIndex;
+    uint16_t            maxPageEntries;
+    uint16_t            timerLoadCount;
+    Qmss_AccPacingMode  interruptPacingMode;
+    Qmss_AccEntrySize   listEntrySize;
+    Qmss_AccCountMode   listCountMode;
+    Qmss_AccQueueMode   multiQueueMode;
+} Qmss_AccCmdCfg;
+
+extern Qmss_Result Qmss_init (Qmss_InitCfg* initCfg, Qmss_GlobalConfigParams* qmssGblCfgParams);
+extern Qmss_Result Qmss_start (void);
+extern Qmss_Result Qmss_exit (void);
+extern Qmss_Result Qmss_insertMemoryRegion (Qmss_MemRegInfo* memRegCfg);
+extern Qmss_QueueHnd Qmss_queueOpen (Qmss_QueueType queType, int queNum, uint8_t* isAllocated);
+extern Qmss_Result Qmss_queueClose (Qmss_QueueHnd hnd);
+extern void* Qmss_queuePop (Qmss_QueueHnd hnd);
+extern void Qmss_queuePush (Qmss_QueueHnd hnd, void* descAddr, uint32_t packetSize, uint32_t descSize, Qmss_Location location);
+extern void Qmss_queuePushDesc (Qmss_QueueHnd hnd, void* descAddr);
+extern void Qmss_queuePushDescSize (Qmss_QueueHnd hnd, void* descAddr, uint32_t descSize);
+extern uint32_t Qmss_getQueueEntryCount (Qmss_QueueHnd hnd);
+extern void Qmss_queueEmpty (Qmss_QueueHnd hnd);
+extern Qmss_Queue Qmss_getQueueNumber (Qmss_QueueHnd hnd);
+extern Qmss_QueueHnd Qmss_getQueueHandle (Qmss_Queue queue);
+extern Qmss_Result Qmss_programAccumulator (Qmss_PdspId pdspId, Qmss_AccCmdCfg* cfg);
+extern Qmss_Result Qmss_disableAccumulator (Qmss_PdspId pdspId, uint8_t channel);
+extern Qmss_Result Qmss_setEoiVector (Qmss_IntdInterruptType type, uint8_t accumCh);
+extern Qmss_Result Qmss_ackInterrupt (uint8_t interruptNum, uint8_t value);
+
+/** Accumulator firmware images, empty on the host */
+extern const uint32_t   acc48_le [1];
+extern const uint32_t   acc48_be [1];
+
+/**************************************************************
+ ************************** CPPI ******************************
+ **************************************************************/
+
+/** Return codes */
+#define     CPPI_SOK                            0
+#define     CPPI_INVALID_PARAM                  -1
+#define     CPPI_QMSS_ERROR                     -2
+#define     CPPI_DESC_NOT_EMULATED              -3
+
+typedef int32_t         Cppi_Result;
+
+/** Any descriptor, of the type in the top 2 bits of its first word */
+typedef struct _Cppi_Desc Cppi_Desc;
+
+typedef enum
+{
+    Cppi_DescType_HOST = 0,
+    Cppi_DescType_MONOLITHIC = 2
+} Cppi_DescType;
+
+typedef enum
+{
+    Cppi_InitDesc_INIT_DESCRIPTOR = 0,
+    Cppi_InitDesc_BYPASS_INIT
+} Cppi_InitDesc;
+
+typedef enum
+{
+    Cppi_ReturnPolicy_RETURN_ENTIRE_PACKET = 0,
+    Cppi_ReturnPolicy_RETURN_BUFFER
+} Cppi_ReturnPolicy;
+
+typedef enum
+{
+    Cppi_PSLoc_PS_IN_DESC = 0,
+    Cppi_PSLoc_PS_IN_SOP
+} Cppi_PSLoc;
+
+typedef enum
+{
+    Cppi_EPIB_NO_EPIB_PRESENT = 0,
+    Cppi_EPIB_EPIB_PRESENT
+} Cppi_EPIB;
+
+typedef enum
+{
+    Cppi_CpDma_SRIO_CPDMA = 0,
+    Cppi_CpDma_AIF_CPDMA,
+    Cppi_CpDma_FFTC_A_CPDMA,
+    Cppi_CpDma_FFTC_B_CPDMA,
+    Cppi_CpDma_PASS_CPDMA,
+    Cppi_CpDma_QMSS_CPDMA,
+    Cppi_CpDma_FFTC_C_CPDMA,
+    Cppi_CpDma_BCP_CPDMA
+} Cppi_CpDma;
+
+/** Host descriptor, as laid out on the device */
+typedef struct _Cppi_HostDesc
+{
+    uint32_t            descInfo;       /* Type [31:30], PS location [22], packet length [21:0] */
+    uint32_t            tagInfo;
+    uint32_t            packetInfo;     /* EPIB [31], PS words [29:24], return policy [15],
+                                           push policy [14], return queue [13:0] */
+    uint32_t            buffLen;
+    uint32_t            buffPtr;
+    uint32_t            nextBDPtr;
+    uint32_t            origBufferLen;
+    uint32_t            origBuffPtr;
+    uint32_t            timeStamp;
+    uint32_t            softwareInfo0;
+    uint32_t            softwareInfo1;
+    uint32_t            softwareInfo2;
+    uint32_t            psData;
+} Cppi_HostDesc;
+
+typedef struct _Cppi_HostDescCfg
+{
+    Cppi_ReturnPolicy   returnPolicy;
+    Cppi_PSLoc          psLocation;
+} Cppi_HostDescCfg;
+
+typedef struct _Cppi_MonolithicDescCfg
+{
+    uint32_t            dataOffset;
+} Cppi_MonolithicDescCfg;
+
+typedef struct _Cppi_DescCfg
+{
+    Qmss_MemRegion      memRegion;
+    uint32_t            descNum;
+    int32_t             destQueueNum;
+    Qmss_QueueType      queueType;
+    Cppi_InitDesc       initDesc;
+    Cppi_DescType       descType;
+    Qmss_Queue          returnQueue;
+    Qmss_Location       returnPushPolicy;
+    Cppi_EPIB           epibPresent;
+    union
+    {
+        Cppi_HostDescCfg        host;
+        Cppi_MonolithicDescCfg  mono;
+    } cfg;
+} Cppi_DescCfg;
+
+/** Rx flow configuration. Accepted for the drivers built on the LLD, but
+ *  the CPDMA is not emulated.
+ */
+typedef struct _Cppi_RxFlowCfg
+{
+    int16_t             flowIdNum;
+    uint16_t            rx_dest_qnum;
+    uint16_t            rx_dest_qmgr;
+    uint16_t            rx_sop_offset;
+    Cppi_PSLoc          rx_ps_location;
+    uint8_t             rx_desc_type;
+    uint8_t             rx_error_handling;
+    uint8_t             rx_psinfo_present;
+    uint8_t             rx_einfo_present;
+    uint8_t             rx_dest_tag_lo;
+    uint8_t             rx_dest_tag_hi;
+    uint8_t             rx_src_tag_lo;
+    uint8_t             rx_src_tag_hi;
+    uint8_t             rx_size_thresh0_en;
+    uint8_t             rx_size_thresh1_en;
+    uint8_t             rx_size_thresh2_en;
+    uint8_t             rx_dest_tag_lo_sel;
+    uint8_t             rx_dest_tag_hi_sel;
+    uint8_t             rx_src_tag_lo_sel;
+    uint8_t             rx_src_tag_hi_sel;
+    uint16_t            rx_fdq1_qnum;
+    uint16_t            rx_fdq1_qmgr;
+    uint16_t            rx_fdq0_sz0_qnum;
+    uint16_t            rx_fdq0_sz0_qmgr;
+    uint16_t            rx_fdq3_qnum;
+    uint16_t            rx_fdq3_qmgr;
+    uint16_t            rx_fdq2_qnum;
+    uint16_t            rx_fdq2_qmgr;
+    uint16_t            rx_size_thresh1;
+    uint16_t            rx_size_thresh0;
+    uint16_t            rx_fdq0_sz1_qnum;
+    uint16_t            rx_fdq0_sz1_qmgr;
+    uint16_t            rx_size_thresh2;
+    uint16_t            rx_fdq0_sz3_qnum;
+    uint16_t            rx_fdq0_sz3_qmgr;
+    uint16_t            rx_fdq0_sz2_qnum;
+    uint16_t            rx_fdq0_sz2_qmgr;
+} Cppi_RxFlowCfg;
+
+/** Device configuration, unused by the emulation */
+typedef struct _Cppi_GlobalConfigParams
+{
+    uint32_t            maxCpDma;
+} Cppi_GlobalConfigParams;
+
+extern Cppi_Result Cppi_init (Cppi_GlobalConfigParams* cppiGblCfgParams);
+extern Cppi_Result Cppi_exit (void);
+extern Qmss_QueueHnd Cppi_initDescriptor (Cppi_DescCfg* descCfg, uint32_t* numAllocated);
+
+/** Checks that an address fits a 32 bit descriptor word, see
+ *  @a qmss_emu_alloc ()
+ */
+extern uint32_t qmss_emu_addr32 (const void* pAddr);
+
+/** Memory in the low 4 GB, for descriptor buffers */
+extern void* qmss_emu_alloc (uint32_t size, uint32_t align);
+extern void qmss_emu_free (void* pAddr, uint32_t size);
+
+#define     CPPI_EMU_HOST(desc)                 ((Cppi_HostDesc *) (desc))
+#define     CPPI_EMU_PTR(word)                  ((void *) (uintptr_t) (word))
+
+/* Descriptor field accessors, inline as in the LLD. Host descriptors only. */
+
+static inline Cppi_DescType Cppi_getDescType (Cppi_Desc* descAddr)
+{
+    return (Cppi_DescType) (CPPI_EMU_HOST (descAddr)->descInfo >> 30);
+}
+
+static inline void Cppi_setData (Cppi_DescType descType, Cppi_Desc* descAddr, uint8_t* buffAddr, uint32_t buffLen)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->buffPtr   =   qmss_emu_addr32 (buffAddr);
+    CPPI_EMU_HOST (descAddr)->buffLen   =   buffLen & 0x3FFFFF;
+}
+
+static inline void Cppi_getData (Cppi_DescType descType, Cppi_Desc* descAddr, uint8_t** buffAddr, uint32_t* buffLen)
+{
+    (void) descType;
+    *buffAddr   =   (uint8_t *) CPPI_EMU_PTR (CPPI_EMU_HOST (descAddr)->buffPtr);
+    *buffLen    =   CPPI_EMU_HOST (descAddr)->buffLen & 0x3FFFFF;
+}
+
+static inline void Cppi_setDataLen (Cppi_DescType descType, Cppi_Desc* descAddr, uint32_t buffLen)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->buffLen   =   buffLen & 0x3FFFFF;
+}
+
+static inline uint32_t Cppi_getDataLen (Cppi_DescType descType, Cppi_Desc* descAddr)
+{
+    (void) descType;
+    return CPPI_EMU_HOST (descAddr)->buffLen & 0x3FFFFF;
+}
+
+static inline void Cppi_setPacketLen (Cppi_DescType descType, Cppi_Desc* descAddr, uint32_t packetLen)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->descInfo  =   (CPPI_EMU_HOST (descAddr)->descInfo & ~0x3FFFFFu) | (packetLen & 0x3FFFFF);
+}
+
+static inline uint32_t Cppi_getPacketLen (Cppi_DescType descType, Cppi_Desc* descAddr)
+{
+    (void) descType;
+    return CPPI_EMU_HOST (descAddr)->descInfo & 0x3FFFFF;
+}
+
+static inline void Cppi_setOriginalBufInfo (Cppi_DescType descType, Cppi_Desc* descAddr, uint8_t* buffAddr, uint32_t buffLen)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->origBuffPtr   =   qmss_emu_addr32 (buffAddr);
+    CPPI_EMU_HOST (descAddr)->origBufferLen =   buffLen & 0x3FFFFF;
+}
+
+static inline void Cppi_getOriginalBufInfo (Cppi_DescType descType, Cppi_Desc* descAddr, uint8_t** buffAddr, uint32_t* buffLen)
+{
+    (void) descType;
+    *buffAddr   =   (uint8_t *) CPPI_EMU_PTR (CPPI_EMU_HOST (descAddr)->origBuffPtr);
+    *buffLen    =   CPPI_EMU_HOST (descAddr)->origBufferLen & 0x3FFFFF;
+}
+
+static inline void Cppi_linkNextBD (Cppi_DescType descType, Cppi_Desc* descAddr, Cppi_Desc* nextBD)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->nextBDPtr =   qmss_emu_addr32 (nextBD);
+}
+
+static inline Cppi_Desc* Cppi_getNextBD (Cppi_DescType descType, Cppi_Desc* descAddr)
+{
+    (void) descType;
+    return (Cppi_Desc *) CPPI_EMU_PTR (CPPI_EMU_HOST (descAddr)->nextBDPtr);
+}
+
+static inline void Cppi_setReturnQueue (Cppi_DescType descType, Cppi_Desc* descAddr, Qmss_Queue queue)
+{
+    (void) descType;
+    CPPI_EMU_HOST (descAddr)->packetInfo    =   (CPPI_EMU_HOST (descAddr)->packetInfo & ~0x3FFFu) |
+                                                ((uint32_t) (queue.qMgr & 3) << 12) | (queue.qNum & 0xFFF);
+}
+
+static inline Qmss_Queue Cppi_getReturnQueue (Cppi_DescType descType, Cppi_Desc* descAddr)
+{
+    Qmss_Queue          queue;
+
+    (void) descType;
+    queue.qMgr  =   (CPPI_EMU_HOST (descAddr)->packetInfo >> 12) & 3;
+    queue.qNum  =   CPPI_EMU_HOST (descAddr)->packetInfo & 0xFFF;
+    return queue;
+}
+
+#endif  /* _QMSS_EMU_H_ */
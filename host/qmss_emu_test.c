@@ -0,0 +1,253 @@
+/**
+ *   @file  qmss_emu_test.c
+ *
+ *   @brief
+ *      Host smoke test of the QMSS/CPPI emulation, run with the FDQ setup
+ *      code of the tests (test_common.c):
+ *
+ *      -   Qmss_init (), Cppi_init () and Qmss_insertMemoryRegion (), as in
+ *          test_main.c, the same region inserted twice being refused.
+ *
+ *      -   A global FDQ from Cppi_initDescriptor (), then an allocate_fdq ()
+ *          / deallocate_fdq () round trip with buffers and a history queue,
+ *          every descriptor and buffer coming back.
+ *
+ *      -   Threads moving descriptors between two queues at once, with no
+ *          descriptor lost, duplicated or returned without its size hint.
+ *
+ *      Build and run from the test directory:
+ *
+ *      gcc -std=gnu99 -no-pie -O2 -I host -I . -o qmss_emu_test host/qmss_emu_test.c
+ *          test_common.c host/bcp_host.c host/qmss_emu.c -lpthread -lm
+ *      ./qmss_emu_test
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <pthread.h>
+#include "bcp_test.h"
+
+extern Qmss_GlobalConfigParams          qmssGblCfgParams;
+extern Cppi_GlobalConfigParams          cppiGblCfgParams;
+
+/* Descriptors, as in test_main.c */
+#define     QMSS_EMU_TEST_NUM_DESC              2048
+#define     QMSS_EMU_TEST_DESC_SIZE             128
+
+/* Tx/Rx FDQ of the allocate_fdq () round trip */
+#define     QMSS_EMU_TEST_FDQ_DESC              64
+#define     QMSS_EMU_TEST_FDQ_BUF_SIZE          2048
+
+/* Push/pop threads, and pops per thread */
+#define     QMSS_EMU_TEST_NUM_THREADS           8
+#define     QMSS_EMU_TEST_NUM_OPS               400000
+
+UInt8                                   hostDesc[QMSS_EMU_TEST_DESC_SIZE * QMSS_EMU_TEST_NUM_DESC] __attribute__ ((aligned (16)));
+
+static Qmss_QueueHnd                    hQmssEmuTestQ [2];
+static volatile UInt32                  qmssEmuTestGo;
+static volatile UInt32                  qmssEmuTestBadHint;
+static UInt8                            qmssEmuTestSeen [QMSS_EMU_TEST_NUM_DESC];
+
+/** ============================================================================
+ *   @n@b qmss_emu_test_worker
+ *
+ *   @b Description
+ *   @n Thread moving descriptors from one queue to the other, the direction
+ *      alternating on every pop. Returns the number of descriptors moved.
+ * =============================================================================
+ */
+static Void* qmss_emu_test_worker (Void* pArg)
+{
+    UInt32              id = (UInt32) (uintptr_t) pArg;
+    UInt32              i, numMoved = 0;
+    Void*               pDesc;
+
+    while (!qmssEmuTestGo);
+
+    for (i = 0; i < QMSS_EMU_TEST_NUM_OPS; i ++)
+    {
+        if ((pDesc = Qmss_queuePop (hQmssEmuTestQ [(i + id) & 1])) == NULL)
+            continue;
+
+        /* Descriptor size hint, in 16 byte units less one */
+        if (((uintptr_t) pDesc & 0xF) != QMSS_EMU_TEST_DESC_SIZE / 16 - 1)
+            qmssEmuTestBadHint ++;
+
+        Qmss_queuePushDescSize (hQmssEmuTestQ [(i + id + 1) & 1], (Void *) QMSS_DESC_PTR (pDesc), QMSS_EMU_TEST_DESC_SIZE);
+        numMoved ++;
+    }
+
+    return (Void *) (uintptr_t) numMoved;
+}
+
+/** ============================================================================
+ *   @n@b qmss_emu_test_drain
+ *
+ *   @b Description
+ *   @n Pops a queue empty, marking each descriptor seen. Returns the number
+ *      of descriptors popped, or -1 on a descriptor popped twice.
+ * =============================================================================
+ */
+static Int32 qmss_emu_test_drain (Qmss_QueueHnd hQueue)
+{
+    Void*               pDesc;
+    UInt32              idx;
+    Int32               numDesc = 0;
+
+    while ((pDesc = Qmss_queuePop (hQueue)) != NULL)
+    {
+        idx =   (QMSS_DESC_PTR (pDesc) - (uintptr_t) hostDesc) / QMSS_EMU_TEST_DESC_SIZE;
+        if (idx >= QMSS_EMU_TEST_NUM_DESC || qmssEmuTestSeen [idx] ++)
+        {
+            printf ("Descriptor %p popped twice \n", pDesc);
+            return -1;
+        }
+        numDesc ++;
+    }
+
+    return numDesc;
+}
+
+int main (Void)
+{
+    Qmss_InitCfg        qmssInitConfig;
+    Qmss_MemRegInfo     memCfg;
+    Cppi_DescCfg        cppiDescCfg;
+    Qmss_QueueHnd       hGlblFDQ, hFDQ, hHistQ, hMoveFDQ;
+    Cppi_Desc*          pCppiDesc;
+    UInt8*              pDataBuffer;
+    UInt32              dataBufferLen, numAllocated, i;
+    UInt8               isAllocated;
+    pthread_t           threads [QMSS_EMU_TEST_NUM_THREADS];
+    Void*               pNumMoved;
+    UInt32              totalMoved = 0;
+    Int32               numBack, numDrained;
+    Int32               testFail = 0;
+
+    /* Queue manager, CPPI and the descriptor region */
+    memset (&qmssInitConfig, 0, sizeof (Qmss_InitCfg));
+    qmssInitConfig.maxDescNum   =   QMSS_EMU_TEST_NUM_DESC;
+    if (Qmss_init (&qmssInitConfig, &qmssGblCfgParams) != QMSS_SOK ||
+        Qmss_start () != QMSS_SOK ||
+        Cppi_init (&cppiGblCfgParams) != CPPI_SOK)
+    {
+        printf ("QMSS/CPPI init failed \n");
+        return 1;
+    }
+
+    memset (&memCfg, 0, sizeof (Qmss_MemRegInfo));
+    memCfg.descBase         =   (UInt32 *) hostDesc;
+    memCfg.descSize         =   QMSS_EMU_TEST_DESC_SIZE;
+    memCfg.descNum          =   QMSS_EMU_TEST_NUM_DESC;
+    memCfg.manageDescFlag   =   Qmss_ManageDesc_MANAGE_DESCRIPTOR;
+    memCfg.memRegion        =   Qmss_MemRegion_MEMORY_REGION_NOT_SPECIFIED;
+    if (Qmss_insertMemoryRegion (&memCfg) < QMSS_SOK)
+    {
+        printf ("Qmss_insertMemoryRegion failed \n");
+        return 1;
+    }
+    memCfg.memRegion        =   Qmss_MemRegion_MEMORY_REGION0;
+    if (Qmss_insertMemoryRegion (&memCfg) != QMSS_MEMREGION_ALREADY_INITIALIZED)
+    {
+        printf ("Memory region inserted twice \n");
+        testFail ++;
+    }
+
+    /* Global FDQ with half the descriptors, as in test_main.c */
+    memset (&cppiDescCfg, 0, sizeof (Cppi_DescCfg));
+    cppiDescCfg.memRegion               =   Qmss_MemRegion_MEMORY_REGION0;
+    cppiDescCfg.descNum                 =   QMSS_EMU_TEST_NUM_DESC / 2;
+    cppiDescCfg.destQueueNum            =   QMSS_PARAM_NOT_SPECIFIED;
+    cppiDescCfg.queueType               =   Qmss_QueueType_GENERAL_PURPOSE_QUEUE;
+    cppiDescCfg.initDesc                =   Cppi_InitDesc_INIT_DESCRIPTOR;
+    cppiDescCfg.descType                =   Cppi_DescType_HOST;
+    cppiDescCfg.returnQueue.qNum        =   QMSS_PARAM_NOT_SPECIFIED;
+    cppiDescCfg.cfg.host.psLocation     =   Cppi_PSLoc_PS_IN_DESC;
+    if ((hGlblFDQ = Cppi_initDescriptor (&cppiDescCfg, &numAllocated)) < 0 ||
+        numAllocated != QMSS_EMU_TEST_NUM_DESC / 2)
+    {
+        printf ("Cppi_initDescriptor failed \n");
+        return 1;
+    }
+
+    /* allocate_fdq () / deallocate_fdq () round trip */
+    if (allocate_fdq (hGlblFDQ, QMSS_EMU_TEST_FDQ_DESC, QMSS_EMU_TEST_FDQ_BUF_SIZE, 1, &hFDQ, &hHistQ) < 0)
+    {
+        printf ("allocate_fdq failed \n");
+        return 1;
+    }
+    if (Qmss_getQueueEntryCount (hFDQ) != QMSS_EMU_TEST_FDQ_DESC ||
+        Qmss_getQueueEntryCount (hGlblFDQ) != QMSS_EMU_TEST_NUM_DESC / 2 - QMSS_EMU_TEST_FDQ_DESC)
+    {
+        printf ("allocate_fdq: %d descriptors on the FDQ, %d left on the global FDQ \n",
+                Qmss_getQueueEntryCount (hFDQ), Qmss_getQueueEntryCount (hGlblFDQ));
+        testFail ++;
+    }
+
+    pCppiDesc   =   (Cppi_Desc *) QMSS_DESC_PTR (Qmss_queuePop (hFDQ));
+    Cppi_getData (Cppi_DescType_HOST, pCppiDesc, &pDataBuffer, &dataBufferLen);
+    if (pDataBuffer == NULL || dataBufferLen != QMSS_EMU_TEST_FDQ_BUF_SIZE ||
+        Cppi_getReturnQueue (Cppi_DescType_HOST, pCppiDesc).qNum != Qmss_getQueueNumber (hHistQ).qNum)
+    {
+        printf ("allocate_fdq: buffer %p of %d bytes, return queue %d \n", pDataBuffer, dataBufferLen,
+                Cppi_getReturnQueue (Cppi_DescType_HOST, pCppiDesc).qNum);
+        testFail ++;
+    }
+    memset (pDataBuffer, 0xA5, dataBufferLen);
+    Qmss_queuePushDescSize (hFDQ, pCppiDesc, QMSS_EMU_TEST_DESC_SIZE);
+
+    deallocate_fdq (hFDQ, hGlblFDQ, QMSS_EMU_TEST_FDQ_DESC, QMSS_EMU_TEST_FDQ_BUF_SIZE, hHistQ);
+    if (Qmss_getQueueEntryCount (hGlblFDQ) != QMSS_EMU_TEST_NUM_DESC / 2)
+    {
+        printf ("deallocate_fdq: %d descriptors back on the global FDQ \n", Qmss_getQueueEntryCount (hGlblFDQ));
+        testFail ++;
+    }
+    printf ("allocate_fdq/deallocate_fdq: %d descriptors of %d bytes \n", QMSS_EMU_TEST_FDQ_DESC, QMSS_EMU_TEST_FDQ_BUF_SIZE);
+
+    /* Push/pop from several threads, the other half of the descriptors */
+    cppiDescCfg.descNum =   QMSS_EMU_TEST_NUM_DESC / 2;
+    if ((hQmssEmuTestQ [0] = Cppi_initDescriptor (&cppiDescCfg, &numAllocated)) < 0 ||
+        (hQmssEmuTestQ [1] = Qmss_queueOpen (Qmss_QueueType_GENERAL_PURPOSE_QUEUE, QMSS_PARAM_NOT_SPECIFIED, &isAllocated)) < 0)
+    {
+        printf ("Error opening the push/pop queues \n");
+        return 1;
+    }
+    hMoveFDQ    =   hQmssEmuTestQ [0];
+
+    for (i = 0; i < QMSS_EMU_TEST_NUM_THREADS; i ++)
+        pthread_create (&threads [i], NULL, qmss_emu_test_worker, (Void *) (uintptr_t) i);
+    qmssEmuTestGo   =   1;
+    for (i = 0; i < QMSS_EMU_TEST_NUM_THREADS; i ++)
+    {
+        pthread_join (threads [i], &pNumMoved);
+        totalMoved  +=  (UInt32) (uintptr_t) pNumMoved;
+    }
+
+    numBack =   0;
+    if ((numDrained = qmss_emu_test_drain (hMoveFDQ)) < 0)
+        return 1;
+    numBack +=  numDrained;
+    if ((numDrained = qmss_emu_test_drain (hQmssEmuTestQ [1])) < 0)
+        return 1;
+    numBack +=  numDrained;
+    if ((numDrained = qmss_emu_test_drain (hGlblFDQ)) < 0)
+        return 1;
+    numBack +=  numDrained;
+
+    printf ("Push/pop: %d threads moved %d descriptors, %d of %d back, %d without their size hint \n",
+            QMSS_EMU_TEST_NUM_THREADS, totalMoved, numBack, QMSS_EMU_TEST_NUM_DESC, qmssEmuTestBadHint);
+    if (numBack != QMSS_EMU_TEST_NUM_DESC || qmssEmuTestBadHint || totalMoved == 0)
+        testFail ++;
+
+    Qmss_queueClose (hQmssEmuTestQ [1]);
+    Qmss_queueClose (hMoveFDQ);
+    Qmss_queueClose (hGlblFDQ);
+
+    if (testFail)
+        printf ("QMSS emulation smoke test FAILED \n");
+    else
+        printf ("QMSS emulation smoke test PASSED \n");
+
+    return testFail ? 1 : 0;
+}
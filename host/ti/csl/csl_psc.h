@@ -0,0 +1,15 @@
+/**
+ *   @file  csl_psc.h
+ *
+ *   @brief   
+ *      Host stand-in for the CSL header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_TI_CSL_CSL_PSC_H_
+#define _HOST_TI_CSL_CSL_PSC_H_
+
+#include "../../bcp_host.h"
+
+#endif	/* _HOST_TI_CSL_CSL_PSC_H_ */
@@ -0,0 +1,308 @@
+/**
+ *   @file  bcp.h
+ *
+ *   @brief
+ *      Host stand-in for the BCP LLD header of the same name: the driver
+ *      types and functions used by the tests, see host/bcp_host.h.
+ *
+ *      The module header configurations have the fields of the LLD ones.
+ *      The header packing functions have stand-ins in host/bcp_hdr_host.c,
+ *      which do not pack the device layout; the driver functions are
+ *      declared only.
+ *
+ *  \par
+*/
+#ifndef _BCP_H_
+#define _BCP_H_
+
+#include <xdc/std.h>
+#include <ti/drv/qmss/qmss_drv.h>
+#include <ti/drv/cppi/cppi_drv.h>
+
+typedef Void*   Bcp_DrvHandle;
+typedef Void*   Bcp_TxHandle;
+typedef Void*   Bcp_RxHandle;
+typedef Void*   Bcp_DrvBufferHandle;
+
+typedef enum
+{
+    Bcp_RadioStd_LTE            =   0,
+    Bcp_RadioStd_WCDMA_R99      =   1,
+    Bcp_RadioStd_WCDMA_R7       =   2,
+    Bcp_RadioStd_WIMAX_802_16E  =   3
+} Bcp_RadioStd;
+
+typedef enum
+{
+    Bcp_PacketType_Normal       =   0
+} Bcp_PacketType;
+
+typedef enum
+{
+    Bcp_CrcFormat_Crc0          =   0,
+    Bcp_CrcFormat_Crc8,
+    Bcp_CrcFormat_Crc12,
+    Bcp_CrcFormat_Crc16,
+    Bcp_CrcFormat_Crc24a,
+    Bcp_CrcFormat_Crc24b
+} Bcp_CrcFormat;
+
+typedef enum
+{
+    Bcp_ModulationType_BPSK     =   0,
+    Bcp_ModulationType_QPSK     =   1,
+    Bcp_ModulationType_16QAM    =   2,
+    Bcp_ModulationType_64QAM    =   3,
+    Bcp_ModulationType_256QAM   =   4
+} Bcp_ModulationType;
+
+typedef enum
+{
+    Bcp_ModulationMode_Hard     =   0,
+    Bcp_ModulationMode_Soft     =   1
+} Bcp_ModulationMode;
+
+typedef enum
+{
+    Bcp_CmuxLength_9            =   0
+} Bcp_CmuxLength;
+
+typedef enum
+{
+    Bcp_QFormat_Q0              =   0
+} Bcp_QFormat;
+
+typedef enum
+{
+    Bcp_EndianFormat_128        =   0,
+    Bcp_EndianFormat_32         =   1
+} Bcp_EndianFormat;
+
+typedef enum
+{
+    Bcp_DataFormat_NoChange     =   0
+} Bcp_DataFormat;
+
+typedef enum
+{
+    Bcp_QueueId_0               =   0
+} Bcp_QueueId;
+
+/** Global header */
+typedef struct _Bcp_GlobalHdrCfg
+{
+    Bcp_PacketType      pkt_type;
+    UInt8               flush;
+    UInt8               drop;
+    UInt8               halt;
+    Bcp_RadioStd        radio_standard;
+    UInt8               hdr_end_ptr;
+    UInt8               flow_id;
+    UInt16              destn_tag;
+} Bcp_GlobalHdrCfg;
+
+/** Traffic Manager header */
+typedef struct _Bcp_TmHdrCfg
+{
+    UInt8               ps_data_size;
+    UInt8               info_data_size;
+} Bcp_TmHdrCfg;
+
+/** CRC header */
+typedef struct _Bcp_CrcHdrCfg
+{
+    UInt8               local_hdr_len;
+    UInt32              num_scramble_sys;
+    UInt8               filler_bits;
+    UInt8               bit_order;
+    UInt8               dtx_format;
+    UInt32              method2_id;
+    UInt32              va_blk_len;
+    Bcp_CrcFormat       va_crc;
+    UInt32              va_blks;
+    UInt32              vb_blk_len;
+    Bcp_CrcFormat       vb_crc;
+    UInt32              vb_blks;
+    UInt32              vc_blk_len;
+    Bcp_CrcFormat       vc_crc;
+    UInt32              vc_blks;
+    UInt32              d1_blk_len;
+    Bcp_CrcFormat       d1_crc;
+    UInt32              d1_blks;
+    UInt32              d2_blk_len;
+    Bcp_CrcFormat       d2_crc;
+    UInt32              d2_blks;
+    UInt32              dc_blk_len;
+    Bcp_CrcFormat       dc_crc;
+    UInt32              dc_blks;
+} Bcp_CrcHdrCfg;
+
+/** Encoder header */
+typedef struct _Bcp_EncBlockCfg
+{
+    UInt16              block_size;
+    UInt16              num_code_blks;
+    UInt16              intvpar0;
+    UInt16              intvpar1;
+    UInt16              intvpar2;
+    UInt16              intvpar3;
+} Bcp_EncBlockCfg;
+
+typedef struct _Bcp_EncHdrCfg
+{
+    UInt8               local_hdr_len;
+    UInt8               turbo_conv_sel;
+    UInt8               scr_crc_en;
+    UInt8               code_rate_flag;
+    Bcp_EncBlockCfg     blockCfg [3];
+} Bcp_EncHdrCfg;
+
+/** LTE Rate matching header */
+typedef struct _Bcp_RmHdr_LteCfg
+{
+    UInt8               local_hdr_len;
+    UInt8               input_bit_format;
+    UInt8               output_bit_format;
+    UInt8               num_filler_bits_f;
+    UInt8               rv_start_column1;
+    UInt8               rv_start_column2;
+    UInt8               param_ncb1_column;
+    UInt8               param_ncb1_row;
+    UInt8               param_ncb2_column;
+    UInt8               param_ncb2_row;
+    UInt8               channel_type;
+    UInt16              num_code_blocks_c1;
+    UInt16              block_size_k1;
+    UInt16              num_code_blocks_c2;
+    UInt16              block_size_k2;
+    UInt16              num_code_blocks_ce1;
+    UInt16              num_code_blocks_ce2;
+    UInt32              block_size_e1;
+    UInt32              block_size_e2;
+} Bcp_RmHdr_LteCfg;
+
+/** Modulator header */
+typedef struct _Bcp_ModHdrCfg
+{
+    UInt8               local_hdr_len;
+    UInt16              uva_val;
+    Bcp_ModulationType  mod_type_sel;
+    UInt8               cmux_ln;
+    UInt8               q_format;
+    UInt8               b_table_index;
+    UInt8               jack_bit;
+    UInt8               split_mode_en;
+    UInt8               scr_en;
+    UInt8               sh_mod_sel;
+    UInt16              rmux_ln;
+    UInt16              cqi_ln;
+    UInt16              ri_ln;
+    UInt16              ack_ln;
+    UInt32              cinit_p2;
+} Bcp_ModHdrCfg;
+
+/** LTE Soft slicer header */
+typedef struct _Bcp_SslModeSelCfg
+{
+    UInt8               split_mode_en;
+    UInt8               jack_bit;
+    UInt8               lte_descrambler_en;
+    Bcp_ModulationType  mod_type_sel;
+    Bcp_CmuxLength      cmux_ln;
+    Bcp_QFormat         q_format;
+    UInt8               b_matrix_sel;
+    UInt8               rmux_ln_index;
+} Bcp_SslModeSelCfg;
+
+typedef struct _Bcp_SslHdr_LteCfg
+{
+    UInt8               local_hdr_len;
+    Bcp_SslModeSelCfg   modeSelCfg;
+    UInt16              ri_ln;
+    UInt16              ack_ln;
+    UInt32              cinit_p2;
+    UInt16              uva;
+    Int32               scale_c0 [14];
+    Int32               scale_c1 [14];
+} Bcp_SslHdr_LteCfg;
+
+/** LTE Rate dematching header */
+typedef struct _Bcp_RdHdr_LteCfg
+{
+    UInt8               local_hdr_len;
+    UInt16              num_code_blocks_c1;
+    UInt16              block_size_k1;
+    UInt16              num_code_blocks_c2;
+    UInt16              block_size_k2;
+    UInt16              num_code_blocks_ce1;
+    UInt16              num_code_blocks_ce2;
+    UInt32              block_size_e1;
+    UInt32              block_size_e2;
+    UInt16              block_size_outq_cqi;
+    UInt16              block_size_inq_cqi;
+    UInt8               cqi_pass_through;
+    UInt8               rv_start_column;
+    UInt8               num_filler_bits_f;
+    UInt8               enable_harq_input;
+    UInt8               enable_harq_output;
+    UInt32              harq_input_address;
+    UInt32              harq_output_address;
+    UInt8               init_cb_flowId;
+    UInt8               flowId_hi;
+    UInt8               flowId_cqi_offset;
+    UInt8               tcp3d_scale_factor;
+    UInt8               tcp3d_dyn_range;
+} Bcp_RdHdr_LteCfg;
+
+/** Tx and Rx endpoint configurations */
+typedef struct _Bcp_TxCfg
+{
+    Bcp_QueueId         txQNum;
+} Bcp_TxCfg;
+
+typedef struct _Bcp_TmFlowEntry
+{
+    Bcp_EndianFormat    endian_in;
+    Bcp_EndianFormat    endian_out;
+    Bcp_DataFormat      format_in;
+    UInt8               pkt_type;
+    UInt8               dsp_int_sel;
+    Bcp_DataFormat      format_out;
+    UInt8               qfifo_out;
+    UInt8               ps_flags;
+} Bcp_TmFlowEntry;
+
+typedef struct _Bcp_RxCfg
+{
+    UInt32              rxQNum;
+    UInt8               bUseInterrupts;
+    Cppi_RxFlowCfg      flowCfg;
+    Bcp_TmFlowEntry     tmFlowCfg;
+    Qmss_AccCmdCfg      accumCfg;
+} Bcp_RxCfg;
+
+/** Header packing */
+extern Int32 Bcp_addGlobalHeader (Bcp_GlobalHdrCfg* pBcpGlblHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addTMHeader (Bcp_TmHdrCfg* pTmHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addCRCHeader (Bcp_CrcHdrCfg* pCrcHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addEncoderHeader (Bcp_EncHdrCfg* pEncHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addLte_RMHeader (Bcp_RmHdr_LteCfg* pRmHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addModulatorHeader (Bcp_ModHdrCfg* pModHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addLTE_SSLHeader (Bcp_SslHdr_LteCfg* pSslHdrCfg, UInt8* pData, UInt32* pLen);
+extern Int32 Bcp_addLTE_RDHeader (Bcp_RdHdr_LteCfg* pRdHdrCfg, UInt8* pData, UInt32* pLen);
+
+/** Driver */
+extern Bcp_TxHandle Bcp_txOpen (Bcp_DrvHandle hBcp, Bcp_TxCfg* pTxCfg, Void* pTxEndpointCfg);
+extern Int32 Bcp_txClose (Bcp_TxHandle hTx);
+extern Bcp_RxHandle Bcp_rxOpen (Bcp_DrvHandle hBcp, Bcp_RxCfg* pRxCfg, Void* pRxEndpointCfg);
+extern Int32 Bcp_rxClose (Bcp_RxHandle hRx);
+extern Int32 Bcp_send (Bcp_TxHandle hTx, Bcp_DrvBufferHandle hDrvBuffer, UInt32 drvBufferLen, Void* pDestnAddr);
+extern Int32 Bcp_recv (Bcp_RxHandle hRx, Bcp_DrvBufferHandle* phDrvBuffer, UInt8** ppDataBuffer, UInt32* pDataBufferLen,
+                       UInt8** ppPsInfo, UInt32* pPsInfoLen, UInt8* pFlowId, UInt8* pSrcId, UInt16* pDestnTagInfo);
+extern Int32 Bcp_rxProcessDesc (Bcp_RxHandle hRx, Cppi_Desc* pCppiDesc, Bcp_DrvBufferHandle* phDrvBuffer,
+                                UInt8** ppDataBuffer, UInt32* pDataBufferLen, UInt8** ppPsInfo, UInt32* pPsInfoLen,
+                                UInt8* pFlowId, UInt8* pSrcId, UInt16* pDestnTagInfo);
+extern Int32 Bcp_rxFreeRecvBuffer (Bcp_RxHandle hRx, Bcp_DrvBufferHandle hDrvBuffer, UInt32 drvBufferLen);
+extern Int32 Bcp_rxGetNumOutputEntries (Bcp_RxHandle hRx);
+
+#endif /* _BCP_H_ */
@@ -0,0 +1,15 @@
+/**
+ *   @file  cppi_desc.h
+ *
+ *   @brief   
+ *      Host stand-in for the PDK header of the same name, see
+ *      host/qmss_emu.h.
+ *
+ *  \par
+*/
+#ifndef __CPPI_DESC_H__
+#define __CPPI_DESC_H__
+
+#include "../../../qmss_emu.h"
+
+#endif	/* __CPPI_DESC_H__ */
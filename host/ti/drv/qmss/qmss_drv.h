@@ -0,0 +1,15 @@
+/**
+ *   @file  qmss_drv.h
+ *
+ *   @brief   
+ *      Host stand-in for the PDK header of the same name, see
+ *      host/qmss_emu.h.
+ *
+ *  \par
+*/
+#ifndef __QMSS_DRV_H__
+#define __QMSS_DRV_H__
+
+#include "../../../qmss_emu.h"
+
+#endif	/* __QMSS_DRV_H__ */
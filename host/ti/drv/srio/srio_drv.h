@@ -0,0 +1,15 @@
+/**
+ *   @file  srio_drv.h
+ *
+ *   @brief   
+ *      Host stand-in for the PDK header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_TI_DRV_SRIO_SRIO_DRV_H_
+#define _HOST_TI_DRV_SRIO_SRIO_DRV_H_
+
+#include "../../../bcp_host.h"
+
+#endif	/* _HOST_TI_DRV_SRIO_SRIO_DRV_H_ */
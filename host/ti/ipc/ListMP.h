@@ -0,0 +1,15 @@
+/**
+ *   @file  ListMP.h
+ *
+ *   @brief   
+ *      Host stand-in for the IPC header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_TI_IPC_LISTMP_H_
+#define _HOST_TI_IPC_LISTMP_H_
+
+#include "../../bcp_host.h"
+
+#endif	/* _HOST_TI_IPC_LISTMP_H_ */
@@ -0,0 +1,15 @@
+/**
+ *   @file  BIOS.h
+ *
+ *   @brief   
+ *      Host stand-in for the SYS/BIOS header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_TI_SYSBIOS_BIOS_H_
+#define _HOST_TI_SYSBIOS_BIOS_H_
+
+#include "../../bcp_host.h"
+
+#endif	/* _HOST_TI_SYSBIOS_BIOS_H_ */
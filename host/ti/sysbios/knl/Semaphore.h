@@ -0,0 +1,15 @@
+/**
+ *   @file  Semaphore.h
+ *
+ *   @brief   
+ *      Host stand-in for the SYS/BIOS header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_TI_SYSBIOS_KNL_SEMAPHORE_H_
+#define _HOST_TI_SYSBIOS_KNL_SEMAPHORE_H_
+
+#include "../../../bcp_host.h"
+
+#endif	/* _HOST_TI_SYSBIOS_KNL_SEMAPHORE_H_ */
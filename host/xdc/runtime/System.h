@@ -0,0 +1,15 @@
+/**
+ *   @file  System.h
+ *
+ *   @brief   
+ *      Host stand-in for the XDC header of the same name, see
+ *      host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef _HOST_XDC_RUNTIME_SYSTEM_H_
+#define _HOST_XDC_RUNTIME_SYSTEM_H_
+
+#include "../../bcp_host.h"
+
+#endif	/* _HOST_XDC_RUNTIME_SYSTEM_H_ */
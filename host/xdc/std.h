@@ -0,0 +1,44 @@
+/**
+ *   @file  std.h
+ *
+ *   @brief
+ *      Host stand-in for the XDC header of the same name: the XDC standard
+ *      types, on standard C types. See host/bcp_host.h.
+ *
+ *  \par
+*/
+#ifndef xdc_std__include
+#define xdc_std__include
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef void                Void;
+typedef char                Char;
+typedef unsigned char       UChar;
+typedef short               Short;
+typedef unsigned short      UShort;
+typedef int                 Int;
+typedef unsigned int        UInt;
+typedef long                Long;
+typedef unsigned long       ULong;
+typedef float               Float;
+typedef double              Double;
+typedef char*               String;
+typedef void*               Ptr;
+typedef uintptr_t           UArg;
+typedef unsigned short      Bool;
+
+typedef int8_t              Int8;
+typedef int16_t             Int16;
+typedef int32_t             Int32;
+typedef int64_t             Int64;
+typedef uint8_t             UInt8;
+typedef uint16_t            UInt16;
+typedef uint32_t            UInt32;
+typedef uint64_t            UInt64;
+
+#define TRUE                1
+#define FALSE               0
+
+#endif /* xdc_std__include */
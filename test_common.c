@@ -9,6 +9,17 @@
 */
 #include "bcp_test.h"
 
+/* The two words of a 64 bit load, in address order */
+#ifdef _TMS320C6X
+#ifdef  xdc_target__bigEndian
+#define     DIFF_WORD0(v)           _hill (v)
+#define     DIFF_WORD1(v)           _loll (v)
+#else
+#define     DIFF_WORD0(v)           _loll (v)
+#define     DIFF_WORD1(v)           _hill (v)
+#endif
+#endif
+
 /** ============================================================================
  *   @n@b read_data_from_file
  *
@@ -71,6 +82,33 @@ Void read_data_from_file_crc_workaround (FILE* fp, UInt8* pDataBuffer)
 	}
 }
 
+/** ============================================================================
+ *   @n@b touch_data_buffer
+ *
+ *   @b Description
+ *   @n Reads a word of every L1D line of a data buffer, to bring the buffer
+ *      into L1D ahead of writing it. L1D does not allocate on write misses,
+ *      so without this every store to a buffer not yet cached stalls on L2.
+ *
+ *   @param[in]
+ *   @n pDataBuffer         Data buffer, 32 bit aligned.
+ *
+ *   @param[in]
+ *   @n dataBufferLen       Number of bytes to touch.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void touch_data_buffer (const Void* pDataBuffer, UInt32 dataBufferLen)
+{
+    const volatile UInt32*  pWord = (const volatile UInt32 *) pDataBuffer;
+    UInt32                  i;
+
+    for (i = 0; i < dataBufferLen; i += BCP_TEST_L1D_LINE_SIZE)
+        (Void) pWord [i >> 2];
+}
+
 /** ============================================================================
  *   @n@b write_data_to_file
  *
@@ -159,7 +197,8 @@ UInt8 gind_row_index (UInt32 input)
  *
  *   @b Description
  *   @n Utility API used to validate data received from BCP against output 
- *      reference data.
+ *      reference data. Where a data buffer differs is logged, see
+ *      @a rxdata_diff ().
  *
  *   @param[in]  
  *   @n pRefDataBuffer      Reference data buffer handle.
@@ -192,16 +231,185 @@ Int32 validate_rxdata
     UInt32              dataOffset
 )
 {
+    BcpTest_RxDiff      diff;
+
     /* Do some basic validation */            
     if (!pRefDataBuffer || !pRxDataBuffer || (refDataBufferLen < rxDataBufferLen + dataOffset))
             return -1;
             
-    if (memcmp (pRefDataBuffer + dataOffset, pRxDataBuffer, rxDataBufferLen) != 0)
+    if (rxdata_diff (pRefDataBuffer + dataOffset, pRxDataBuffer, rxDataBufferLen, dataOffset, &diff) != 0)
+    {
+        rxdata_diff_log (&diff);
         return -1;            
+    }
     else
         return 0;   /* Data validation succeeded */
 }
 
+static UInt32 diff_popcount (UInt32 x)
+{
+#ifdef _TMS320C6X
+    return _dotpu4 (_bitc4 (x), 0x01010101);
+#else
+    x   =   x - ((x >> 1) & 0x55555555);
+    x   =   (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+}
+
+/* Counts a word of the reference output that differs in the bits set in x */
+static Void diff_add_word (BcpTest_RxDiff* pDiff, UInt32 word, UInt32 x)
+{
+    if (pDiff->numWordErrs ++ == 0)
+        pDiff->firstErrWord =   word;
+    pDiff->numBitErrs   +=  diff_popcount (x);
+    pDiff->hist [(word - pDiff->firstWord) / pDiff->binWords] ++;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b rxdata_diff
+ *
+ *   @b Description
+ *   @n Compares a data buffer received from BCP against reference data and
+ *      reports where they differ: the first word that differs, the number
+ *      of words and bits that differ, and a histogram of the words that
+ *      differ over the buffer.
+ *
+ *      Matching data only costs a memcmp (). Otherwise the buffer is walked
+ *      8 bytes at a time, and bit errors are counted word by word.
+ *
+ *   @param[in]  
+ *   @n pRefData        Reference data, at the offset of the buffer.
+ *
+ *   @param[in]  
+ *   @n pRxData         Data buffer received from BCP.
+ *
+ *   @param[in]  
+ *   @n len             Number of bytes to compare.
+ *
+ *   @param[in]  
+ *   @n dataOffset      Byte offset of the buffer in the reference output,
+ *                      that words are counted from.
+ *
+ *   @param[out]  
+ *   @n pDiff           Mismatch report.
+ *
+ *   @return        
+ *   @n 0           -       Data buffer matches the reference data.
+ *   @n -1          -       Data buffer differs.
+ * =============================================================================
+ */
+Int32 rxdata_diff 
+(
+    const UInt8*        pRefData,
+    const UInt8*        pRxData,
+    UInt32              len,
+    UInt32              dataOffset,
+    BcpTest_RxDiff*     pDiff
+)
+{
+    UInt32              pos, end, n, x, x0, x1, k;
+#ifdef _TMS320C6X
+    long long           vRef, vRx;
+#else
+    UInt32              ref [2], rx [2];
+#endif
+
+    memset (pDiff, 0, sizeof (BcpTest_RxDiff));
+    if (len == 0)
+        return 0;
+    pDiff->firstWord    =   dataOffset >> 2;
+    pDiff->numWords     =   ((dataOffset + len - 1) >> 2) - pDiff->firstWord + 1;
+    pDiff->binWords     =   (pDiff->numWords + BCP_TEST_DIFF_HIST_BINS - 1) / BCP_TEST_DIFF_HIST_BINS;
+
+    if (memcmp (pRefData, pRxData, len) == 0)
+        return 0;
+
+    for (pos = dataOffset, end = dataOffset + len; pos < end; pos += n)
+    {
+        if ((pos & 3) == 0 && end - pos >= 8)
+        {
+            /* Two whole words */
+#ifdef _TMS320C6X
+            vRef    =   _mem8_const (pRefData);
+            vRx     =   _mem8_const (pRxData);
+            x0      =   DIFF_WORD0 (vRef) ^ DIFF_WORD0 (vRx);
+            x1      =   DIFF_WORD1 (vRef) ^ DIFF_WORD1 (vRx);
+#else
+            memcpy (ref, pRefData, 8);
+            memcpy (rx, pRxData, 8);
+            x0      =   ref [0] ^ rx [0];
+            x1      =   ref [1] ^ rx [1];
+#endif
+            n       =   8;
+            if ((x0 | x1) == 0)
+            {
+                pRefData    +=  n;
+                pRxData     +=  n;
+                continue;
+            }
+            if (x0)
+                diff_add_word (pDiff, pos >> 2, x0);
+            if (x1)
+                diff_add_word (pDiff, (pos >> 2) + 1, x1);
+        }
+        else
+        {
+            /* Data starting or ending within a word */
+            n   =   4 - (pos & 3);
+            if (n > end - pos)
+                n   =   end - pos;
+            for (x = 0, k = 0; k < n; k ++)
+                x   |=  (UInt32) (pRefData [k] ^ pRxData [k]) << (8 * k);
+            if (x)
+                diff_add_word (pDiff, pos >> 2, x);
+        }
+
+        pRefData    +=  n;
+        pRxData     +=  n;
+    }
+
+    return (pDiff->numWordErrs == 0) ? 0 : -1;
+}
+
+/** ============================================================================
+ *   @n@b rxdata_diff_log
+ *
+ *   @b Description
+ *   @n Logs a mismatch report of @a rxdata_diff (), with the histogram bins
+ *      that hold words that differ.
+ *
+ *   @param[in]  
+ *   @n pDiff           Mismatch report.
+ *
+ *   @return        
+ *   @n None.
+ * =============================================================================
+ */
+Void rxdata_diff_log (const BcpTest_RxDiff* pDiff)
+{
+    UInt32              bin, binStart, binEnd;
+
+    Bcp_osalLog ("Rx data mismatch: %d of words %d - %d differ, %d bit errors, first at word %d \n", 
+                 pDiff->numWordErrs, pDiff->firstWord, pDiff->firstWord + pDiff->numWords - 1, 
+                 pDiff->numBitErrs, pDiff->firstErrWord);
+
+    for (bin = 0; bin < BCP_TEST_DIFF_HIST_BINS; bin ++)
+    {
+        if (pDiff->hist [bin] == 0)
+            continue;
+        binStart    =   pDiff->firstWord + bin * pDiff->binWords;
+        binEnd      =   binStart + pDiff->binWords - 1;
+        if (binEnd > pDiff->firstWord + pDiff->numWords - 1)
+            binEnd  =   pDiff->firstWord + pDiff->numWords - 1;
+        Bcp_osalLog ("    words %d - %d: %d differ \n", binStart, binEnd, pDiff->hist [bin]);
+    }
+
+    return;
+}
+
 /* Macro to convert a 32 bit number into a byte by byte stream */
 #ifdef  xdc_target__bigEndian                   
 #define read32(a)  ((((a)>>24)&0xff) + (((a)>>8)&0xff00) + (((a)<<8)&0xff0000) + (((a)<<24)&0xff000000))
@@ -245,6 +453,44 @@ Void read_harq_data_from_file (FILE* fp, UInt8* pDataBuffer, UInt32* pDataBuffer
 	}
 }
 
+/* Byte swap of a reference HARQ word into BCP output byte order */
+#if defined (xdc_target__bigEndian) && defined (_TMS320C6X)
+#define     HARQ_SWAP32(a)          _swap4 (_rotl ((a), 16))
+#else
+#define     HARQ_SWAP32(a)          read32(a)
+#endif
+
+/* Counts the LLR bytes of a word differing from the reference by more than
+ * the tolerance, replicated in each byte of tol4, and keeps the largest
+ * difference of each byte lane in *pMaxDiff4.
+ */
+static UInt32 harq_llr_errs (UInt32 ref, UInt32 rx, UInt32 tol4, UInt32* pMaxDiff4)
+{
+#ifdef _TMS320C6X
+    UInt32              d;
+
+    /* Signed LLRs made offset binary, so that unsigned |a - b| is exact */
+    d           =   _subabs4 (ref ^ 0x80808080, rx ^ 0x80808080);
+    *pMaxDiff4  =   _maxu4 (*pMaxDiff4, d);
+    return diff_popcount (_cmpgtu4 (d, tol4));
+#else
+    Int32               d;
+    UInt32              k, numErrs = 0;
+
+    for (k = 0; k < 32; k += 8)
+    {
+        d   =   (Int32) (Int8) (ref >> k) - (Int32) (Int8) (rx >> k);
+        if (d < 0)
+            d   =   -d;
+        if ((UInt32) d > ((*pMaxDiff4 >> k) & 0xff))
+            *pMaxDiff4  =   (*pMaxDiff4 & ~(0xffu << k)) | ((UInt32) d << k);
+        if ((UInt32) d > (tol4 & 0xff))
+            numErrs ++;
+    }
+    return numErrs;
+#endif
+}
+
 /** ============================================================================
  *   @n@b validate_harqoutput
  *
@@ -256,6 +502,8 @@ Void read_harq_data_from_file (FILE* fp, UInt8* pDataBuffer, UInt32* pDataBuffer
  *      stream of 8 bit byte data and then compares against BCP output
  *      data to eliminate any endian dependent data ordering issues.
  *
+ *      The data must match exactly, see @a validate_harqoutput_llr ().
+ *
  *   @param[in]  
  *   @n pRefDataBuffer      HARQ Output Reference data buffer handle.
  *
@@ -288,21 +536,124 @@ Int32 validate_harqoutput
     UInt32              dataOffset
 )
 {
-	UInt32		        i;
+    return validate_harqoutput_llr (pRefDataBuffer, refDataBufferLen, pRxDataBuffer, 
+                                    rxDataBufferLen, dataOffset, 0);
+}
+
+/** ============================================================================
+ *   @n@b validate_harqoutput_llr
+ *
+ *   @b Description
+ *   @n Validates HARQ output data received from BCP against HARQ output 
+ *      reference data as @a validate_harqoutput () does, accepting LLRs that
+ *      differ from the reference by up to a tolerance. This allows for
+ *      references from fixed point models that round differently.
+ *
+ *      The buffers are compared 8 bytes at a time, the reference byte
+ *      swapped into byte order on big endian targets, so that matching data
+ *      costs two loads and a compare. Only words that differ are checked
+ *      LLR by LLR against the tolerance, 4 LLRs at a time on the DSP. Full
+ *      HARQ buffers of hundreds of KB are compared in one call.
+ *
+ *   @param[in]  
+ *   @n pRefDataBuffer      HARQ Output Reference data buffer handle.
+ *
+ *   @param[in]  
+ *   @n refDataBufferLen    Total length of reference data.
+ *
+ *   @param[in]  
+ *   @n pRxDataBuffer       HARQ output data buffer received from BCP.
+ *
+ *   @param[in]  
+ *   @n rxDataBufferLen     Number of bytes to compare.
+ *
+ *   @param[in]  
+ *   @n dataOffset          Reference data offset, a multiple of 4 bytes.
+ *
+ *   @param[in]  
+ *   @n llrTol              Largest absolute difference accepted of an LLR,
+ *                          0 for an exact match.
+ *
+ *   @return        
+ *   @n 0           -       All LLRs within the tolerance of the reference.
+ *   @n -1          -       Validation failed.
+ * =============================================================================
+ */
+Int32 validate_harqoutput_llr
+(
+    UInt32*             pRefDataBuffer,
+    UInt32              refDataBufferLen,
+    UInt32*             pRxDataBuffer, 
+    UInt32              rxDataBufferLen, 
+    UInt32              dataOffset,
+    UInt8               llrTol
+)
+{
+    const UInt32*       pRef;
+    const UInt8*        pRx = (const UInt8 *) pRxDataBuffer;
+    UInt32              tol4 = llrTol * 0x01010101u, maxDiff4 = 0, maxDiff, numErrs = 0;
+    UInt32              numWords, i, ref0, ref1, rx0, rx1, k0, k1, firstErr = 0, k;
+#ifdef _TMS320C6X
+    long long           vRef, vRx;
+#else
+    UInt32              rx [2];
+#endif
 
     /* Do some basic validation */            
-    if (!pRefDataBuffer || !pRxDataBuffer || (refDataBufferLen < rxDataBufferLen + dataOffset))
+    if (!pRefDataBuffer || !pRxDataBuffer || (refDataBufferLen < rxDataBufferLen + dataOffset) ||
+        (dataOffset & 3))
             return -1;
 
-    for (i = 0; i < rxDataBufferLen/4; i ++, pRefDataBuffer++, pRxDataBuffer++)
+    pRef        =   pRefDataBuffer + (dataOffset >> 2);
+    numWords    =   rxDataBufferLen >> 2;
+    for (i = 0; i + 2 <= numWords; i += 2)
     {
-    	if (read32(*pRefDataBuffer)  != *pRxDataBuffer)
-    		break;
+#ifdef _TMS320C6X
+        vRef    =   _mem8_const (pRef + i);
+        vRx     =   _mem8_const (pRx + 4 * i);
+        ref0    =   HARQ_SWAP32 (DIFF_WORD0 (vRef));
+        ref1    =   HARQ_SWAP32 (DIFF_WORD1 (vRef));
+        rx0     =   DIFF_WORD0 (vRx);
+        rx1     =   DIFF_WORD1 (vRx);
+#else
+        ref0    =   HARQ_SWAP32 (pRef [i]);
+        ref1    =   HARQ_SWAP32 (pRef [i + 1]);
+        memcpy (rx, pRx + 4 * i, 8);
+        rx0     =   rx [0];
+        rx1     =   rx [1];
+#endif
+        if (((ref0 ^ rx0) | (ref1 ^ rx1)) == 0)
+            continue;
+
+        k0  =   harq_llr_errs (ref0, rx0, tol4, &maxDiff4);
+        k1  =   harq_llr_errs (ref1, rx1, tol4, &maxDiff4);
+        if (numErrs == 0 && (k0 | k1))
+            firstErr    =   k0 ? i : i + 1;
+        numErrs +=  k0 + k1;
     }
-    if (i != rxDataBufferLen/4)
-    	return -1;
-    else
-    	return 0;
+    for (; i < numWords; i ++)
+    {
+        ref0    =   HARQ_SWAP32 (pRef [i]);
+        memcpy (&rx0, pRx + 4 * i, 4);
+        if (ref0 == rx0)
+            continue;
+        k0  =   harq_llr_errs (ref0, rx0, tol4, &maxDiff4);
+        if (numErrs == 0 && k0)
+            firstErr    =   i;
+        numErrs +=  k0;
+    }
+
+    if (numErrs == 0)
+        return 0;
+
+    maxDiff =   maxDiff4 & 0xff;
+    for (k = 8; k < 32; k += 8)
+        if (((maxDiff4 >> k) & 0xff) > maxDiff)
+            maxDiff =   (maxDiff4 >> k) & 0xff;
+    Bcp_osalLog ("HARQ output mismatch: %d LLRs off by more than %d, up to %d, first in word %d \n", 
+                 numErrs, llrTol, maxDiff, (dataOffset >> 2) + firstErr);
+
+    return -1;
 }
 
 /** ============================================================================
@@ -325,7 +676,8 @@ Int32 validate_harqoutput
  *   @n numDesc         Number of descriptors setup on this Rx/Tx FDQ.
  * 
  *   @param[in]  
- *   @n buffSize        Size of pre-allocated buffers linked to the descriptor.
+ *   @n buffSize        Size of pre-allocated buffers linked to the descriptor,
+ *                      0 if the descriptors have no buffers.
  * 
  *   @param[in]  
  *   @n hHistQ          History queue handle obtained earlier from @a allocate_fdq () 
@@ -365,7 +717,8 @@ Void deallocate_fdq
 	    pCppiDesc = (Void*) (QMSS_DESC_PTR (pCppiDesc));    
         Cppi_getData (Cppi_DescType_HOST, pCppiDesc, &pDataBuffer, &dataBufferLen);
         Cppi_setDataLen (Cppi_DescType_HOST, pCppiDesc, buffSize);
-        Bcp_osalFree (pDataBuffer, buffSize, TRUE);
+        if (buffSize > 0)
+            Bcp_osalFree (pDataBuffer, buffSize, TRUE);
 
         //Cppi_linkNextBD (Cppi_DescType_HOST, pCppiDesc, NULL);
 
@@ -381,6 +734,57 @@ Void deallocate_fdq
     return;        
 }
 
+/** ============================================================================
+ *   @n@b unlink_fdq
+ *
+ *   @b Description
+ *   @n Tx descriptors are returned with the buffer descriptors linked to
+ *      them. This API unlinks every descriptor on a Tx FDQ and returns the 
+ *      linked buffer descriptors to their own FDQ, so that both FDQs can be
+ *      de-allocated.
+ *
+ *   @param[in]  
+ *   @n hFDQ            Tx FDQ handle.
+ *
+ *   @param[in]  
+ *   @n hLinkFDQ        FDQ of the linked buffer descriptors.
+ *
+ *   @param[in]  
+ *   @n numDesc         Number of descriptors setup on the Tx FDQ.
+ * 
+ *   @return        
+ *   @n None.
+ * =============================================================================
+ */
+Void unlink_fdq 
+(
+    Qmss_QueueHnd       hFDQ, 
+    Qmss_QueueHnd       hLinkFDQ, 
+    UInt32              numDesc
+)
+{
+    UInt32              i;
+    Cppi_Desc*          pCppiDesc;
+    Cppi_Desc*          pLinkDesc;
+
+    for (i = 0; i < numDesc; i ++)
+    {
+        if ((pCppiDesc = Qmss_queuePop (hFDQ)) == NULL)
+            break;                
+        pCppiDesc = (Void*) (QMSS_DESC_PTR (pCppiDesc));    
+
+        if ((pLinkDesc = Cppi_getNextBD (Cppi_DescType_HOST, pCppiDesc)) != NULL)
+        {
+            Cppi_linkNextBD (Cppi_DescType_HOST, pCppiDesc, NULL);
+            Qmss_queuePushDescSize (hLinkFDQ, pLinkDesc, 256);           
+        }
+
+        Qmss_queuePushDescSize (hFDQ, pCppiDesc, 256);           
+    }
+
+    return;        
+}
+
 /** ============================================================================
  *   @n@b allocate_fdq
  *
@@ -399,7 +803,10 @@ Void deallocate_fdq
  * 
  *   @param[in]  
  *   @n buffSize        Size of data buffer to allocate. The data buffer is 
- *                      linked to descriptor at FDQ allocation time.
+ *                      linked to descriptor at FDQ allocation time. 0 sets up
+ *                      descriptors without buffers, to point at buffers owned
+ *                      by the application, e.g., Tx payloads linked to a 
+ *                      header descriptor.
  * 
  *   @param[in]  
  *   @n bAllocHistQ     Boolean flag to indicate whether a History queue must
@@ -471,7 +878,9 @@ Int32 allocate_fdq
          * 4 bits of the address.
          */
 	    pCppiDesc = (Void*) (QMSS_DESC_PTR (pCppiDesc));    
-        if ((pDataBuffer =   (uint8_t *) Bcp_osalMalloc (buffSize, TRUE)) == NULL)
+        if (buffSize == 0)
+            pDataBuffer =   NULL;
+        else if ((pDataBuffer =   (uint8_t *) Bcp_osalMalloc (buffSize, TRUE)) == NULL)
         {
         	Bcp_osalLog ("OOM error while allocating buffers\n");
             break;                
@@ -0,0 +1,356 @@
+/**
+ *   @file  test_golden.c
+ *
+ *   @brief
+ *      Compressed golden output store.
+ *
+ *      Golden outputs are kept dictionary coded, as written by
+ *      tools/golden_pack.c: the distinct words of the output, and for each
+ *      word its index in that dictionary, packed 1, 2, 4 or 8 bits wide.
+ *      As the indices are of fixed width any word of the output is found
+ *      directly, so data received at any offset of a packet is checked by
+ *      expanding just the part of the golden output it covers, a chunk at
+ *      a time, and the whole output is never expanded in memory.
+ *
+ *      Long runs only need to know whether the output matched. Such outputs
+ *      are kept as a digest instead, a 64 bit hash of each 1 KB chunk,
+ *      about 1/128 the size of the output, and received data is hashed
+ *      as it arrives. Only a chunk that does not match is read back from
+ *      the test vector file of the output, to tell the words that differ.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Expected words of a chunk that does not match its digest */
+#pragma DATA_SECTION (digestRefChunk, ".testData");
+static UInt32           digestRefChunk [BCP_TEST_DIGEST_CHUNK_BYTES / 4];
+
+/** ============================================================================
+ *   @n@b golden_expand
+ *
+ *   @b Description
+ *   @n Expands words of a golden output.
+ *
+ *   @param[in]
+ *   @n pGolden     Golden output.
+ *
+ *   @param[in]
+ *   @n firstWord   First word to expand.
+ *
+ *   @param[in]
+ *   @n numWords    Number of words to expand.
+ *
+ *   @param[out]
+ *   @n pOut        Words expanded.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void golden_expand (const BcpTest_Golden* pGolden, UInt32 firstWord, UInt32 numWords, UInt32* pOut)
+{
+    const UInt32*       pIdx;
+    UInt32              idxBits = pGolden->idxBits;
+    UInt32              mask, shift, idxWord, i;
+
+    if (idxBits == 32)
+    {
+        memcpy (pOut, pGolden->pIdx + firstWord, numWords * 4);
+        return;
+    }
+
+    /* Indices never straddle words, as the index width is a power of 2 */
+    mask    =   (1u << idxBits) - 1;
+    pIdx    =   pGolden->pIdx + ((firstWord * idxBits) >> 5);
+    shift   =   (firstWord * idxBits) & 31;
+    idxWord =   *pIdx ++;
+    for (i = 0; i < numWords; i ++)
+    {
+        pOut [i]    =   pGolden->pDict [(idxWord >> shift) & mask];
+        shift       +=  idxBits;
+        if (shift == 32 && i + 1 < numWords)
+        {
+            idxWord =   *pIdx ++;
+            shift   =   0;
+        }
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b golden_validate
+ *
+ *   @b Description
+ *   @n Validates a data buffer received from BCP against a golden output,
+ *      as @a validate_rxdata () does against an uncompressed one. The golden
+ *      output is expanded a chunk at a time into the comparison.
+ *
+ *   @param[in]
+ *   @n pGolden         Golden output.
+ *
+ *   @param[in]
+ *   @n pRxDataBuffer   Data buffer received from BCP.
+ *
+ *   @param[in]
+ *   @n rxDataBufferLen Number of bytes to compare.
+ *
+ *   @param[in]
+ *   @n dataOffset      Byte offset of the data buffer in the golden output.
+ *
+ *   @return        Int32
+ *   @n 0       -   Data buffer matches the golden output.
+ *
+ *   @n -1      -   Validation failed.
+ * =============================================================================
+ */
+Int32 golden_validate
+(
+    const BcpTest_Golden*   pGolden,
+    const UInt8*        pRxDataBuffer,
+    UInt32              rxDataBufferLen,
+    UInt32              dataOffset
+)
+{
+    UInt32              chunk [BCP_TEST_GOLDEN_CHUNK_WORDS];
+    UInt32              word, skip, numWords, len;
+    BcpTest_RxDiff      diff;
+
+    if (!pRxDataBuffer || dataOffset + rxDataBufferLen > pGolden->numWords * 4)
+        return -1;
+
+    /* Data may start and end within a word */
+    word    =   dataOffset >> 2;
+    skip    =   dataOffset & 3;
+    while (rxDataBufferLen)
+    {
+        numWords    =   (skip + rxDataBufferLen + 3) >> 2;
+        if (numWords > BCP_TEST_GOLDEN_CHUNK_WORDS)
+            numWords    =   BCP_TEST_GOLDEN_CHUNK_WORDS;
+        len         =   numWords * 4 - skip;
+        if (len > rxDataBufferLen)
+            len     =   rxDataBufferLen;
+
+        golden_expand (pGolden, word, numWords, chunk);
+        if (rxdata_diff ((UInt8 *) chunk + skip, pRxDataBuffer, len, word * 4 + skip, &diff) != 0)
+        {
+            rxdata_diff_log (&diff);
+            return -1;
+        }
+
+        pRxDataBuffer   +=  len;
+        rxDataBufferLen -=  len;
+        word            +=  numWords;
+        skip            =   0;
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b digest_diff_chunk
+ *
+ *   @b Description
+ *   @n Reads the expected words of a chunk that does not match its digest
+ *      from the test vector file of the output, and logs the words that
+ *      differ.
+ * =============================================================================
+ */
+static Void digest_diff_chunk (const BcpTest_DigestCheck* pCheck, UInt32 chunkIdx, UInt32 numWords)
+{
+    const BcpTest_Digest*   pDigest = pCheck->pDigest;
+    UInt32              firstWord = chunkIdx * (BCP_TEST_DIGEST_CHUNK_BYTES / 4);
+    UInt32              numDiffs = 0, i;
+
+    if (pDigest->pVecFile == NULL ||
+        vec_read_words (pDigest->pVecFile, firstWord, numWords, digestRefChunk) != 0)
+    {
+        Bcp_osalLog ("Golden output mismatch in bytes %d - %d \n", firstWord * 4, 
+                     firstWord * 4 + pCheck->chunkLen - 1);
+        return;
+    }
+
+    for (i = 0; i < numWords; i ++)
+    {
+        if (pCheck->chunk [i] == digestRefChunk [i])
+            continue;
+        if (numDiffs ++ < BCP_TEST_DIGEST_MAX_DIFFS)
+            Bcp_osalLog ("Golden output mismatch at word %d: 0x%08x, expected 0x%08x \n", firstWord + i,
+                         pCheck->chunk [i], digestRefChunk [i]);
+    }
+    Bcp_osalLog ("Golden output mismatch: %d of words %d - %d differ \n", numDiffs, firstWord, 
+                 firstWord + numWords - 1);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b digest_check_chunk
+ *
+ *   @b Description
+ *   @n Checks the chunk of data gathered against its digest, and starts the
+ *      next chunk.
+ * =============================================================================
+ */
+static Int32 digest_check_chunk (BcpTest_DigestCheck* pCheck)
+{
+    const UInt32*       pHash;
+    UInt32              chunkIdx, numWords, hashLo, hashHi, i;
+
+    /* A last chunk ending within a word is hashed zero padded */
+    numWords    =   (pCheck->chunkLen + 3) >> 2;
+    memset ((UInt8 *) pCheck->chunk + pCheck->chunkLen, 0, numWords * 4 - pCheck->chunkLen);
+
+    hashLo  =   BCP_TEST_DIGEST_SEED_LO;
+    hashHi  =   BCP_TEST_DIGEST_SEED_HI;
+    for (i = 0; i < numWords; i ++)
+    {
+        hashLo  =   BCP_TEST_DIGEST_STEP_LO (hashLo, pCheck->chunk [i]);
+        hashHi  =   BCP_TEST_DIGEST_STEP_HI (hashHi, pCheck->chunk [i]);
+    }
+
+    chunkIdx    =   (pCheck->dataOffset - 1) / BCP_TEST_DIGEST_CHUNK_BYTES;
+    pHash       =   &pCheck->pDigest->pHashes [chunkIdx * 2];
+    if (hashLo != pHash [0] || hashHi != pHash [1])
+    {
+        pCheck->numMismatch ++;
+        digest_diff_chunk (pCheck, chunkIdx, numWords);
+        pCheck->chunkLen    =   0;
+        return -1;
+    }
+
+    pCheck->chunkLen    =   0;
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b digest_check_start
+ *
+ *   @b Description
+ *   @n Starts checking the output of a packet against a golden output digest.
+ *      The data is then passed in as it is received by
+ *      @a digest_check_data (), and the check completed by
+ *      @a digest_check_end ().
+ *
+ *   @param[out]
+ *   @n pCheck      Check state.
+ *
+ *   @param[in]
+ *   @n pDigest     Golden output digest.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void digest_check_start (BcpTest_DigestCheck* pCheck, const BcpTest_Digest* pDigest)
+{
+    pCheck->pDigest     =   pDigest;
+    pCheck->dataOffset  =   0;
+    pCheck->chunkLen    =   0;
+    pCheck->numMismatch =   0;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b digest_check_data
+ *
+ *   @b Description
+ *   @n Takes in a data buffer received from BCP. The data is gathered a chunk
+ *      at a time, and each chunk is checked against its digest once complete.
+ *
+ *   @param[in]
+ *   @n pCheck          Check started by @a digest_check_start ().
+ *
+ *   @param[in]
+ *   @n pRxDataBuffer   Data buffer received from BCP.
+ *
+ *   @param[in]
+ *   @n rxDataBufferLen Number of bytes received.
+ *
+ *   @param[in]
+ *   @n dataOffset      Byte offset of the data buffer in the output. Data
+ *                      must be passed in order.
+ *
+ *   @return        Int32
+ *   @n 0       -   The chunks completed by the data buffer match.
+ *
+ *   @n -1      -   Validation failed.
+ * =============================================================================
+ */
+Int32 digest_check_data
+(
+    BcpTest_DigestCheck*    pCheck,
+    const UInt8*        pRxDataBuffer,
+    UInt32              rxDataBufferLen,
+    UInt32              dataOffset
+)
+{
+    UInt32              len;
+    Int32               retVal = 0;
+
+    if (!pRxDataBuffer || dataOffset != pCheck->dataOffset ||
+        rxDataBufferLen > pCheck->pDigest->numBytes - dataOffset)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Golden output digest: %d bytes at offset %d out of order or past the end \n",
+                     rxDataBufferLen, dataOffset);
+#endif
+        pCheck->numMismatch ++;
+        return -1;
+    }
+
+    while (rxDataBufferLen)
+    {
+        len =   BCP_TEST_DIGEST_CHUNK_BYTES - pCheck->chunkLen;
+        if (len > rxDataBufferLen)
+            len =   rxDataBufferLen;
+
+        memcpy ((UInt8 *) pCheck->chunk + pCheck->chunkLen, pRxDataBuffer, len);
+        pCheck->chunkLen    +=  len;
+        pCheck->dataOffset  +=  len;
+        pRxDataBuffer       +=  len;
+        rxDataBufferLen     -=  len;
+
+        if (pCheck->chunkLen == BCP_TEST_DIGEST_CHUNK_BYTES && digest_check_chunk (pCheck) != 0)
+            retVal  =   -1;
+    }
+
+    return retVal;
+}
+
+/** ============================================================================
+ *   @n@b digest_check_end
+ *
+ *   @b Description
+ *   @n Completes the check of the output of a packet, checking its last
+ *      chunk and its length.
+ *
+ *   @param[in]
+ *   @n pCheck      Check started by @a digest_check_start ().
+ *
+ *   @return        Int32
+ *   @n 0       -   Output matches the golden output.
+ *
+ *   @n -1      -   Validation failed.
+ * =============================================================================
+ */
+Int32 digest_check_end (BcpTest_DigestCheck* pCheck)
+{
+    /* A short last chunk cannot match */
+    if (pCheck->dataOffset != pCheck->pDigest->numBytes)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Golden output digest: %d bytes received, expected %d \n", pCheck->dataOffset,
+                     pCheck->pDigest->numBytes);
+#endif
+        return -1;
+    }
+
+    if (pCheck->chunkLen)
+        digest_check_chunk (pCheck);
+
+    return (pCheck->numMismatch == 0) ? 0 : -1;
+}
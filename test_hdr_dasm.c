@@ -0,0 +1,897 @@
+/**
+ *   @file  test_hdr_dasm.c
+ *
+ *   @brief
+ *      BCP header chain disassembler.
+ *
+ *      Decodes the global header and the module headers of a packet back
+ *      into Bcp_*Cfg structures, to trace what the Bcp_add*Header () calls
+ *      wrote and to diff a packet against the headers expected.
+ *
+ *      As for header templates, the header layout is not coded here but
+ *      learnt from the LLD once, by building every module header with a
+ *      zero configuration and with each configuration bit set in turn. This
+ *      gives, per field, the header bits it maps to, and per module, the
+ *      constant bits of its first word that identify it in a packet.
+ *      Decoding is then a walk over the module headers, hdr_end_ptr and
+ *      local_hdr_len delimiting them, with a shift and mask per field.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Max size of a module header */
+#define     HDR_DASM_MAX_WORDS              32
+
+/* Max number of decoded fields over all modules */
+#define     HDR_DASM_MAX_FIELDS             256
+
+/* Max number of contiguous bit runs a field is split into */
+#define     HDR_DASM_MAX_SEG                2
+
+/* Max length of a trace line */
+#define     HDR_DASM_LINE_LEN               160
+
+/* Configuration field, or array of fields */
+typedef struct _HdrDasmDesc
+{
+    const char*         pName;
+    UInt16              offset;
+    UInt8               size;
+    UInt8               count;
+    UInt16              stride;
+} HdrDasmDesc;
+
+/* Module header builder */
+typedef struct _HdrDasmModDesc
+{
+    const char*         pName;
+    UInt32              cfgSize;
+    Int32               (*addFxn) (Void* pCfg, UInt8* pData, UInt32* pLen);
+    const HdrDasmDesc*  pDesc;
+    UInt32              numDesc;
+} HdrDasmModDesc;
+
+/* Contiguous run of field bits in a header word */
+typedef struct _HdrDasmSeg
+{
+    UInt32              mask;           /* Field bits, in place in the word */
+    UInt8               wordIdx;
+    UInt8               shift;
+    UInt8               width;
+    UInt8               valShift;
+} HdrDasmSeg;
+
+/* Learnt location of one field */
+typedef struct _HdrDasmField
+{
+    UInt16              offset;
+    UInt8               size;
+    UInt8               numSeg;
+    UInt16              descIdx;
+    UInt8               elemIdx;
+    HdrDasmSeg          seg [HDR_DASM_MAX_SEG];
+} HdrDasmField;
+
+/* Learnt layout of one module header */
+typedef struct _HdrDasmMap
+{
+    UInt32              sig;            /* Constant first word bits */
+    UInt32              sigMask;
+    UInt16              firstField;
+    UInt16              numFields;
+    UInt16              numWords;       /* Size of a zero configuration header */
+    Int16               lenField;       /* local_hdr_len field, -1 if none */
+    UInt8               bValid;
+} HdrDasmMap;
+
+#define HDR_DASM_FLD(type, m)                                               \
+    { #m, offsetof (type, m), sizeof (((type *) 0)->m), 1, 0 }
+#define HDR_DASM_ARR(type, m)                                               \
+    { #m, offsetof (type, m), sizeof (((type *) 0)->m [0]),                 \
+      sizeof (((type *) 0)->m) / sizeof (((type *) 0)->m [0]),              \
+      sizeof (((type *) 0)->m [0]) }
+#define HDR_DASM_SUB(type, s, stype, m)                                     \
+    { #s "." #m, offsetof (type, s) + offsetof (stype, m),                  \
+      sizeof (((stype *) 0)->m), sizeof (((type *) 0)->s) / sizeof (stype), \
+      sizeof (stype) }
+
+#pragma DATA_SECTION (hdrDasmGlblDesc, ".testData");
+static const HdrDasmDesc hdrDasmGlblDesc[] = {
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, pkt_type),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, flush),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, drop),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, halt),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, radio_standard),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, hdr_end_ptr),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, flow_id),
+    HDR_DASM_FLD (Bcp_GlobalHdrCfg, destn_tag)
+};
+
+#pragma DATA_SECTION (hdrDasmTmDesc, ".testData");
+static const HdrDasmDesc hdrDasmTmDesc[] = {
+    HDR_DASM_FLD (Bcp_TmHdrCfg, ps_data_size),
+    HDR_DASM_FLD (Bcp_TmHdrCfg, info_data_size)
+};
+
+#pragma DATA_SECTION (hdrDasmCrcDesc, ".testData");
+static const HdrDasmDesc hdrDasmCrcDesc[] = {
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, local_hdr_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, num_scramble_sys),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, filler_bits),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, bit_order),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, dtx_format),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, method2_id),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, va_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, va_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, va_blks),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vb_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vb_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vb_blks),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vc_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vc_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, vc_blks),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d1_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d1_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d1_blks),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d2_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d2_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, d2_blks),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, dc_blk_len),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, dc_crc),
+    HDR_DASM_FLD (Bcp_CrcHdrCfg, dc_blks)
+};
+
+#pragma DATA_SECTION (hdrDasmEncDesc, ".testData");
+static const HdrDasmDesc hdrDasmEncDesc[] = {
+    HDR_DASM_FLD (Bcp_EncHdrCfg, local_hdr_len),
+    HDR_DASM_FLD (Bcp_EncHdrCfg, turbo_conv_sel),
+    HDR_DASM_FLD (Bcp_EncHdrCfg, scr_crc_en),
+    HDR_DASM_FLD (Bcp_EncHdrCfg, code_rate_flag),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, block_size),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, num_code_blks),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, intvpar0),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, intvpar1),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, intvpar2),
+    HDR_DASM_SUB (Bcp_EncHdrCfg, blockCfg, Bcp_EncBlockCfg, intvpar3)
+};
+
+#pragma DATA_SECTION (hdrDasmLteRmDesc, ".testData");
+static const HdrDasmDesc hdrDasmLteRmDesc[] = {
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, local_hdr_len),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, input_bit_format),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, output_bit_format),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, num_filler_bits_f),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, rv_start_column1),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, rv_start_column2),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, param_ncb1_column),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, param_ncb1_row),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, param_ncb2_column),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, param_ncb2_row),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, channel_type),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, num_code_blocks_c1),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, block_size_k1),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, num_code_blocks_c2),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, block_size_k2),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, num_code_blocks_ce1),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, num_code_blocks_ce2),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, block_size_e1),
+    HDR_DASM_FLD (Bcp_RmHdr_LteCfg, block_size_e2)
+};
+
+#pragma DATA_SECTION (hdrDasmModDesc, ".testData");
+static const HdrDasmDesc hdrDasmModDesc[] = {
+    HDR_DASM_FLD (Bcp_ModHdrCfg, local_hdr_len),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, uva_val),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, mod_type_sel),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, cmux_ln),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, q_format),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, b_table_index),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, jack_bit),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, split_mode_en),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, scr_en),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, sh_mod_sel),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, rmux_ln),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, cqi_ln),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, ri_ln),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, ack_ln),
+    HDR_DASM_FLD (Bcp_ModHdrCfg, cinit_p2)
+};
+
+#pragma DATA_SECTION (hdrDasmLteSslDesc, ".testData");
+static const HdrDasmDesc hdrDasmLteSslDesc[] = {
+    HDR_DASM_FLD (Bcp_SslHdr_LteCfg, local_hdr_len),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, split_mode_en),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, jack_bit),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, lte_descrambler_en),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, mod_type_sel),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, cmux_ln),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, q_format),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, b_matrix_sel),
+    HDR_DASM_SUB (Bcp_SslHdr_LteCfg, modeSelCfg, Bcp_SslModeSelCfg, rmux_ln_index),
+    HDR_DASM_FLD (Bcp_SslHdr_LteCfg, ri_ln),
+    HDR_DASM_FLD (Bcp_SslHdr_LteCfg, ack_ln),
+    HDR_DASM_FLD (Bcp_SslHdr_LteCfg, cinit_p2),
+    HDR_DASM_FLD (Bcp_SslHdr_LteCfg, uva),
+    HDR_DASM_ARR (Bcp_SslHdr_LteCfg, scale_c0),
+    HDR_DASM_ARR (Bcp_SslHdr_LteCfg, scale_c1)
+};
+
+#pragma DATA_SECTION (hdrDasmLteRdDesc, ".testData");
+static const HdrDasmDesc hdrDasmLteRdDesc[] = {
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, local_hdr_len),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, num_code_blocks_c1),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_k1),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, num_code_blocks_c2),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_k2),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, num_code_blocks_ce1),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, num_code_blocks_ce2),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_e1),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_e2),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_outq_cqi),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, block_size_inq_cqi),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, cqi_pass_through),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, rv_start_column),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, num_filler_bits_f),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, enable_harq_input),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, enable_harq_output),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, harq_input_address),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, harq_output_address),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, init_cb_flowId),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, flowId_hi),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, flowId_cqi_offset),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, tcp3d_scale_factor),
+    HDR_DASM_FLD (Bcp_RdHdr_LteCfg, tcp3d_dyn_range)
+};
+
+static Int32 hdr_dasm_add_glbl (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addGlobalHeader ((Bcp_GlobalHdrCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_tm (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addTMHeader ((Bcp_TmHdrCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_crc (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addCRCHeader ((Bcp_CrcHdrCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_enc (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addEncoderHeader ((Bcp_EncHdrCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_lte_rm (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addLte_RMHeader ((Bcp_RmHdr_LteCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_mod (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addModulatorHeader ((Bcp_ModHdrCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_lte_ssl (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addLTE_SSLHeader ((Bcp_SslHdr_LteCfg *) pCfg, pData, pLen);
+}
+
+static Int32 hdr_dasm_add_lte_rd (Void* pCfg, UInt8* pData, UInt32* pLen)
+{
+    return Bcp_addLTE_RDHeader ((Bcp_RdHdr_LteCfg *) pCfg, pData, pLen);
+}
+
+#define HDR_DASM_NUM(tbl)                   (sizeof (tbl) / sizeof (tbl [0]))
+
+/* Module header builders, the global header first */
+#pragma DATA_SECTION (hdrDasmModules, ".testData");
+static const HdrDasmModDesc hdrDasmModules[] = {
+    { "GLBL",  sizeof (Bcp_GlobalHdrCfg),     hdr_dasm_add_glbl,      hdrDasmGlblDesc,    HDR_DASM_NUM (hdrDasmGlblDesc) },
+    { "TM",    sizeof (Bcp_TmHdrCfg),         hdr_dasm_add_tm,        hdrDasmTmDesc,      HDR_DASM_NUM (hdrDasmTmDesc) },
+    { "CRC",   sizeof (Bcp_CrcHdrCfg),        hdr_dasm_add_crc,       hdrDasmCrcDesc,     HDR_DASM_NUM (hdrDasmCrcDesc) },
+    { "ENC",   sizeof (Bcp_EncHdrCfg),        hdr_dasm_add_enc,       hdrDasmEncDesc,     HDR_DASM_NUM (hdrDasmEncDesc) },
+    { "RM",    sizeof (Bcp_RmHdr_LteCfg),     hdr_dasm_add_lte_rm,    hdrDasmLteRmDesc,   HDR_DASM_NUM (hdrDasmLteRmDesc) },
+    { "MOD",   sizeof (Bcp_ModHdrCfg),        hdr_dasm_add_mod,       hdrDasmModDesc,     HDR_DASM_NUM (hdrDasmModDesc) },
+    { "SSL",   sizeof (Bcp_SslHdr_LteCfg),    hdr_dasm_add_lte_ssl,   hdrDasmLteSslDesc,  HDR_DASM_NUM (hdrDasmLteSslDesc) },
+    { "RD",    sizeof (Bcp_RdHdr_LteCfg),     hdr_dasm_add_lte_rd,    hdrDasmLteRdDesc,   HDR_DASM_NUM (hdrDasmLteRdDesc) }
+};
+
+#define HDR_DASM_NUM_MODULES                HDR_DASM_NUM (hdrDasmModules)
+
+/* The TM header ends the header chain, any words after it up to the header
+ * end are PS and info words.
+ */
+#define HDR_DASM_MOD_TM                     1
+
+/* Learnt header layouts */
+#pragma DATA_SECTION (hdrDasmMaps, ".testData");
+static HdrDasmMap       hdrDasmMaps[HDR_DASM_NUM_MODULES];
+#pragma DATA_SECTION (hdrDasmFields, ".testData");
+static HdrDasmField     hdrDasmFields[HDR_DASM_MAX_FIELDS];
+#pragma DATA_SECTION (hdrDasmReady, ".testData");
+static Int32            hdrDasmReady = 0;
+
+/* Probe builds */
+#pragma DATA_SECTION (hdrDasmBase, ".testData");
+static UInt32           hdrDasmBase[HDR_DASM_MAX_WORDS];
+#pragma DATA_SECTION (hdrDasmProbe, ".testData");
+static UInt32           hdrDasmProbe[HDR_DASM_MAX_WORDS];
+#pragma DATA_SECTION (hdrDasmCfg, ".testData");
+static BcpTest_HdrCfg   hdrDasmCfg;
+
+/* Packet headers decoded by hdr_dasm_trace () */
+#pragma DATA_SECTION (hdrDasmTraceMods, ".testData");
+static BcpTest_HdrDasmMod   hdrDasmTraceMods[BCP_TEST_HDR_DASM_MAX_MODULES];
+
+/** ============================================================================
+ *   @n@b hdr_dasm_get
+ *
+ *   @b Description
+ *   @n Reads a field of a configuration structure.
+ * =============================================================================
+ */
+static UInt32 hdr_dasm_get (const Void* pCfg, const HdrDasmField* pField)
+{
+    const UInt8*        p = (const UInt8 *) pCfg + pField->offset;
+
+    if (pField->size == 1)
+        return *p;
+    else if (pField->size == 2)
+        return *(const UInt16 *) p;
+    else
+        return *(const UInt32 *) p;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_set
+ *
+ *   @b Description
+ *   @n Writes a field of a configuration structure.
+ * =============================================================================
+ */
+static Void hdr_dasm_set (Void* pCfg, const HdrDasmField* pField, UInt32 val)
+{
+    UInt8*              p = (UInt8 *) pCfg + pField->offset;
+
+    if (pField->size == 1)
+        *p  =   (UInt8) val;
+    else if (pField->size == 2)
+        *(UInt16 *) p   =   (UInt16) val;
+    else
+        *(UInt32 *) p   =   val;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_locate
+ *
+ *   @b Description
+ *   @n Returns the bit position (word * 32 + bit) of the single bit a probe
+ *      build differs in from the zero configuration build, or -1 if the
+ *      builds do not differ in exactly one bit.
+ * =============================================================================
+ */
+static Int32 hdr_dasm_locate (UInt32 numWords)
+{
+    UInt32              i, diff;
+    Int32               pos = -1;
+
+    for (i = 0; i < numWords; i ++)
+    {
+        if ((diff = hdrDasmBase [i] ^ hdrDasmProbe [i]) == 0)
+            continue;
+
+        if (pos >= 0 || (diff & (diff - 1)))
+            return -1;
+
+#ifdef _TMS320C6X
+        pos =   i * 32 + (31 - _lmbd (1, diff));
+#else
+        for (pos = i * 32; !(diff & 1); pos ++)
+            diff    >>= 1;
+#endif
+    }
+
+    return pos;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_learn_field
+ *
+ *   @b Description
+ *   @n Locates the header bits of one field by building the module header
+ *      with each field bit set in turn, and merges them into runs of
+ *      contiguous bits. Bits that do not show, or show as more than one
+ *      header bit, are not decoded.
+ *
+ *   @return        Int32
+ *   @n 0       -   Field located, or has no header bits.
+ *   @n -1      -   Field split into more than HDR_DASM_MAX_SEG runs.
+ * =============================================================================
+ */
+static Int32 hdr_dasm_learn_field
+(
+    const HdrDasmModDesc*   pModDesc,
+    UInt32              baseWords,
+    HdrDasmField*       pField,
+    UInt32*             pUsedBits
+)
+{
+    HdrDasmSeg*         pSeg = NULL;
+    UInt32              b, len, numWords;
+    Int32               pos;
+
+    pField->numSeg  =   0;
+    for (b = 0; b < pField->size * 8u; b ++)
+    {
+        memset (&hdrDasmCfg, 0, sizeof (hdrDasmCfg));
+        hdr_dasm_set (&hdrDasmCfg, pField, 1u << b);
+
+        memset (hdrDasmProbe, 0, sizeof (hdrDasmProbe));
+        len =   0;
+        if (pModDesc->addFxn (&hdrDasmCfg, (UInt8 *) hdrDasmProbe, &len) < 0 ||
+            len > HDR_DASM_MAX_WORDS * 4)
+            continue;
+
+        /* A field may add words to the header */
+        numWords    =   (len + 3) >> 2;
+        if (numWords < baseWords)
+            numWords    =   baseWords;
+        if ((pos = hdr_dasm_locate (numWords)) < 0)
+            continue;
+        pUsedBits [pos >> 5]    |=  1u << (pos & 31);
+
+        if (pSeg != NULL && pos == pSeg->wordIdx * 32 + pSeg->shift + pSeg->width &&
+            b == pSeg->valShift + pSeg->width && pSeg->shift + pSeg->width < 32)
+        {
+            pSeg->width ++;
+            pSeg->mask  |=  1u << (pos & 31);
+            continue;
+        }
+
+        if (pField->numSeg == HDR_DASM_MAX_SEG)
+            return -1;
+        pSeg            =   &pField->seg [pField->numSeg ++];
+        pSeg->mask      =   1u << (pos & 31);
+        pSeg->wordIdx   =   pos >> 5;
+        pSeg->shift     =   pos & 31;
+        pSeg->width     =   1;
+        pSeg->valShift  =   b;
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_init
+ *
+ *   @b Description
+ *   @n Learns the layout of every module header from the LLD. Called on the
+ *      first decode; a module whose zero configuration header cannot be
+ *      built is left out.
+ *
+ *   @return        Int32
+ *   @n 0       -   Layouts learnt.
+ *   @n -1      -   Global header layout unknown, or too many fields.
+ * =============================================================================
+ */
+Int32 hdr_dasm_init (Void)
+{
+    const HdrDasmModDesc*   pModDesc;
+    const HdrDasmDesc*  pDesc;
+    HdrDasmMap*         pMap;
+    HdrDasmField*       pField;
+    UInt32              usedBits [HDR_DASM_MAX_WORDS];
+    UInt32              m, d, e, len, numFields = 0;
+
+    for (m = 0; m < HDR_DASM_NUM_MODULES; m ++)
+    {
+        pModDesc    =   &hdrDasmModules [m];
+        pMap        =   &hdrDasmMaps [m];
+        memset (pMap, 0, sizeof (HdrDasmMap));
+        pMap->lenField  =   -1;
+
+        memset (&hdrDasmCfg, 0, sizeof (hdrDasmCfg));
+        memset (hdrDasmBase, 0, sizeof (hdrDasmBase));
+        len =   0;
+        if (pModDesc->addFxn (&hdrDasmCfg, (UInt8 *) hdrDasmBase, &len) < 0 ||
+            len == 0 || len > HDR_DASM_MAX_WORDS * 4)
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Header disassembler: cannot build %s header \n", pModDesc->pName);
+#endif
+            continue;
+        }
+        pMap->numWords      =   (len + 3) >> 2;
+        pMap->firstField    =   numFields;
+        memset (usedBits, 0, sizeof (usedBits));
+
+        for (d = 0; d < pModDesc->numDesc; d ++)
+        {
+            pDesc   =   &pModDesc->pDesc [d];
+            for (e = 0; e < pDesc->count; e ++)
+            {
+                if (numFields == HDR_DASM_MAX_FIELDS)
+                    return -1;
+
+                pField          =   &hdrDasmFields [numFields];
+                pField->offset  =   pDesc->offset + e * pDesc->stride;
+                pField->size    =   pDesc->size;
+                pField->descIdx =   d;
+                pField->elemIdx =   e;
+                if (hdr_dasm_learn_field (pModDesc, pMap->numWords, pField, usedBits) < 0)
+                {
+#ifdef BCP_TEST_DEBUG
+                    Bcp_osalLog ("Header disassembler: %s.%s is scattered \n", pModDesc->pName, pDesc->pName);
+#endif
+                    continue;
+                }
+                if (pField->numSeg == 0)
+                    continue;
+
+                if (strcmp (pDesc->pName, "local_hdr_len") == 0)
+                    pMap->lenField  =   numFields;
+                numFields ++;
+            }
+        }
+        pMap->numFields =   numFields - pMap->firstField;
+
+        /* What is left of the first word is the module id */
+        pMap->sigMask   =   ~usedBits [0];
+        pMap->sig       =   hdrDasmBase [0] & pMap->sigMask;
+        pMap->bValid    =   1;
+    }
+
+    if (!hdrDasmMaps [0].bValid)
+        return -1;
+    hdrDasmReady    =   1;
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_extract
+ *
+ *   @b Description
+ *   @n Gathers the value of one field from a module header, words past
+ *      numWords reading as zero.
+ * =============================================================================
+ */
+static UInt32 hdr_dasm_extract
+(
+    const HdrDasmField* pField,
+    const UInt32*       pWords,
+    UInt32              numWords
+)
+{
+    const HdrDasmSeg*   pSeg = pField->seg;
+    UInt32              val;
+
+    if (pSeg->wordIdx >= numWords)
+        return 0;
+    val =   ((pWords [pSeg->wordIdx] & pSeg->mask) >> pSeg->shift) << pSeg->valShift;
+
+    if (pField->numSeg > 1 && (++ pSeg)->wordIdx < numWords)
+        val |=  ((pWords [pSeg->wordIdx] & pSeg->mask) >> pSeg->shift) << pSeg->valShift;
+
+    return val;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_decode_module
+ *
+ *   @b Description
+ *   @n Extracts the fields of one module header.
+ * =============================================================================
+ */
+static Void hdr_dasm_decode_module
+(
+    UInt32              modIdx,
+    const UInt32*       pWords,
+    UInt32              numWords,
+    BcpTest_HdrCfg*     pCfg
+)
+{
+    const HdrDasmMap*   pMap = &hdrDasmMaps [modIdx];
+    const HdrDasmField* pField = &hdrDasmFields [pMap->firstField];
+    UInt32              f;
+
+    memset (pCfg, 0, hdrDasmModules [modIdx].cfgSize);
+    for (f = 0; f < pMap->numFields; f ++, pField ++)
+        hdr_dasm_set (pCfg, pField, hdr_dasm_extract (pField, pWords, numWords));
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_decode
+ *
+ *   @b Description
+ *   @n Decodes the header chain of a packet. The global header gives the
+ *      end of the chain; each module header is identified by its first
+ *      word and is local_hdr_len + 1 words long, or the size the LLD builds
+ *      for modules without a local_hdr_len field.
+ *
+ *   @param[in]
+ *   @n pPkt            Packet, 32 bit aligned.
+ *
+ *   @param[in]
+ *   @n pktLen          Packet length in bytes.
+ *
+ *   @param[out]
+ *   @n pMod            Decoded module headers, in packet order.
+ *
+ *   @param[in]
+ *   @n maxMod          Size of pMod.
+ *
+ *   @return        Int32
+ *   @n >0      -   Number of module headers decoded, including the global
+ *                  header. Decoding stops after a module that is not
+ *                  recognised, returned with modIdx -1.
+ *   @n -1      -   Packet too short or header layouts unknown.
+ * =============================================================================
+ */
+Int32 hdr_dasm_decode
+(
+    const UInt8*        pPkt,
+    UInt32              pktLen,
+    BcpTest_HdrDasmMod* pMod,
+    UInt32              maxMod
+)
+{
+    const UInt32*       pWords = (const UInt32 *) pPkt;
+    const HdrDasmMap*   pMap;
+    UInt32              hdrEnd, pos, numWords, m, numMod = 0;
+
+    if (!hdrDasmReady && hdr_dasm_init () < 0)
+        return -1;
+    if (maxMod == 0 || pktLen < hdrDasmMaps [0].numWords * 4u)
+        return -1;
+
+    pos =   hdrDasmMaps [0].numWords;
+    hdr_dasm_decode_module (0, pWords, pos, &pMod->cfg);
+    pMod->modIdx        =   0;
+    pMod->pName         =   hdrDasmModules [0].pName;
+    pMod->wordOffset    =   0;
+    pMod->numWords      =   pos;
+    numMod ++;
+
+    hdrEnd  =   pMod->cfg.glbl.hdr_end_ptr;
+    if (hdrEnd > (pktLen >> 2))
+        hdrEnd  =   pktLen >> 2;
+
+    while (pos < hdrEnd && numMod < maxMod)
+    {
+        pMod ++;
+        pMod->wordOffset    =   pos;
+        for (m = 1; m < HDR_DASM_NUM_MODULES; m ++)
+        {
+            pMap    =   &hdrDasmMaps [m];
+            if (pMap->bValid && (pWords [pos] & pMap->sigMask) == pMap->sig)
+                break;
+        }
+        numMod ++;
+
+        if (m == HDR_DASM_NUM_MODULES)
+        {
+            pMod->modIdx    =   -1;
+            pMod->pName     =   "?";
+            pMod->numWords  =   hdrEnd - pos;
+            memset (&pMod->cfg, 0, sizeof (BcpTest_HdrCfg));
+            break;
+        }
+
+        if (pMap->lenField >= 0)
+            numWords    =   1 + hdr_dasm_extract (&hdrDasmFields [pMap->lenField], &pWords [pos], 1);
+        else
+            numWords    =   pMap->numWords;
+        if (numWords > hdrEnd - pos)
+            numWords    =   hdrEnd - pos;
+
+        hdr_dasm_decode_module (m, &pWords [pos], numWords, &pMod->cfg);
+        pMod->modIdx    =   m;
+        pMod->pName     =   hdrDasmModules [m].pName;
+        pMod->numWords  =   numWords;
+        pos             +=  numWords;
+        if (m == HDR_DASM_MOD_TM)
+            break;
+    }
+
+    return numMod;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_field_name
+ *
+ *   @b Description
+ *   @n Formats the name of a field, with its index for array elements.
+ * =============================================================================
+ */
+static Int32 hdr_dasm_field_name (char* pBuf, UInt32 size, UInt32 modIdx, const HdrDasmField* pField)
+{
+    const HdrDasmDesc*  pDesc = &hdrDasmModules [modIdx].pDesc [pField->descIdx];
+
+    if (pDesc->count > 1)
+        return snprintf (pBuf, size, "%s[%d]", pDesc->pName, pField->elemIdx);
+    else
+        return snprintf (pBuf, size, "%s", pDesc->pName);
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_print
+ *
+ *   @b Description
+ *   @n Logs decoded module headers, one line per module with its word
+ *      offset and its non-zero fields.
+ *
+ *   @param[in]
+ *   @n pMod            Module headers returned by @a hdr_dasm_decode ().
+ *
+ *   @param[in]
+ *   @n numMod          Number of module headers.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void hdr_dasm_print
+(
+    const BcpTest_HdrDasmMod*   pMod,
+    UInt32              numMod
+)
+{
+    char                line [HDR_DASM_LINE_LEN];
+    const HdrDasmMap*   pMap;
+    const HdrDasmField* pField;
+    UInt32              i, f, val, n;
+
+    for (i = 0; i < numMod; i ++, pMod ++)
+    {
+        n   =   snprintf (line, sizeof (line), "%s@%d/%d:", pMod->pName, pMod->wordOffset, pMod->numWords);
+        if (pMod->modIdx < 0)
+        {
+            Bcp_osalLog ("%s\n", line);
+            continue;
+        }
+
+        pMap    =   &hdrDasmMaps [pMod->modIdx];
+        pField  =   &hdrDasmFields [pMap->firstField];
+        for (f = 0; f < pMap->numFields; f ++, pField ++)
+        {
+            if ((val = hdr_dasm_get (&pMod->cfg, pField)) == 0)
+                continue;
+
+            /* Room for a name and a value, else start a new line */
+            if (n > sizeof (line) - 48)
+            {
+                Bcp_osalLog ("%s\n", line);
+                n   =   snprintf (line, sizeof (line), "   ");
+            }
+            line [n ++] =   ' ';
+            n   +=  hdr_dasm_field_name (&line [n], sizeof (line) - n, pMod->modIdx, pField);
+            n   +=  snprintf (&line [n], sizeof (line) - n, "=%u", val);
+        }
+        Bcp_osalLog ("%s\n", line);
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_diff
+ *
+ *   @b Description
+ *   @n Compares decoded module headers against expected ones, e.g., decoded
+ *      from a packet built with the expected configurations, and logs every
+ *      difference if asked to.
+ *
+ *   @param[in]
+ *   @n pMod            Module headers decoded from the packet.
+ *
+ *   @param[in]
+ *   @n numMod          Number of module headers in pMod.
+ *
+ *   @param[in]
+ *   @n pRef            Expected module headers.
+ *
+ *   @param[in]
+ *   @n numRef          Number of module headers in pRef.
+ *
+ *   @param[in]
+ *   @n bLog            Set to log the differences, clear when they are
+ *                      expected and only counted.
+ *
+ *   @return        UInt32
+ *   @n Number of fields and modules that differ.
+ * =============================================================================
+ */
+UInt32 hdr_dasm_diff
+(
+    const BcpTest_HdrDasmMod*   pMod,
+    UInt32              numMod,
+    const BcpTest_HdrDasmMod*   pRef,
+    UInt32              numRef,
+    UInt32              bLog
+)
+{
+    char                name [HDR_DASM_LINE_LEN];
+    const HdrDasmMap*   pMap;
+    const HdrDasmField* pField;
+    UInt32              i, f, val, refVal, numDiff = 0;
+
+    for (i = 0; i < numMod && i < numRef; i ++, pMod ++, pRef ++)
+    {
+        if (pMod->modIdx != pRef->modIdx || pMod->modIdx < 0)
+        {
+            if (bLog)
+                Bcp_osalLog ("Header %d: %s module, expected %s \n", i, pMod->pName, pRef->pName);
+            numDiff ++;
+            continue;
+        }
+
+        pMap    =   &hdrDasmMaps [pMod->modIdx];
+        pField  =   &hdrDasmFields [pMap->firstField];
+        for (f = 0; f < pMap->numFields; f ++, pField ++)
+        {
+            val     =   hdr_dasm_get (&pMod->cfg, pField);
+            refVal  =   hdr_dasm_get (&pRef->cfg, pField);
+            if (val == refVal)
+                continue;
+
+            if (bLog)
+            {
+                hdr_dasm_field_name (name, sizeof (name), pMod->modIdx, pField);
+                Bcp_osalLog ("Header %d: %s.%s = %u, expected %u \n", i, pMod->pName, name, val, refVal);
+            }
+            numDiff ++;
+        }
+    }
+
+    if (numMod != numRef)
+    {
+        if (bLog)
+            Bcp_osalLog ("%d module headers, expected %d \n", numMod, numRef);
+        numDiff +=  (numMod > numRef) ? numMod - numRef : numRef - numMod;
+    }
+
+    return numDiff;
+}
+
+/** ============================================================================
+ *   @n@b hdr_dasm_trace
+ *
+ *   @b Description
+ *   @n Decodes and logs the header chain of a packet.
+ *
+ *   @param[in]
+ *   @n pPkt            Packet, 32 bit aligned.
+ *
+ *   @param[in]
+ *   @n pktLen          Packet length in bytes.
+ *
+ *   @return        Int32
+ *   @n Number of module headers decoded, or -1 on error.
+ * =============================================================================
+ */
+Int32 hdr_dasm_trace
+(
+    const UInt8*        pPkt,
+    UInt32              pktLen
+)
+{
+    Int32               numMod;
+
+    if ((numMod = hdr_dasm_decode (pPkt, pktLen, hdrDasmTraceMods, BCP_TEST_HDR_DASM_MAX_MODULES)) < 0)
+    {
+        Bcp_osalLog ("Header disassembler: cannot decode packet \n");
+        return -1;
+    }
+    hdr_dasm_print (hdrDasmTraceMods, numMod);
+
+    return numMod;
+}
@@ -0,0 +1,432 @@
+/**
+ *   @file  test_hdr_tmpl.c
+ *
+ *   @brief
+ *      BCP header chain templates.
+ *
+ *      Consecutive packets of a test usually share their whole header chain
+ *      except for a few fields, e.g., the scrambler cinit, the RV start
+ *      column or the flow id. A template holds the packed header words of
+ *      one configuration along with the word and bit position of each such
+ *      volatile field, so that a packet header is built with a copy and a
+ *      masked store per field instead of the Bcp_add*Header () calls.
+ *
+ *      Field positions are not taken from the BCP header layout but found
+ *      by building the chain once per field bit with that bit flipped, so a
+ *      template works for any header the test builds. A field that does not
+ *      map to contiguous bits of one word is reported, and the caller builds
+ *      its headers the usual way.
+ *
+ *      Ready templates can be exported as C source, one pre-packed blob per
+ *      configuration. Once linked and registered, a blob is loaded on a
+ *      cache miss in place of building the template, so a catalogue of
+ *      fixed configurations needs neither the header setup code nor any
+ *      floating point at run time.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Header template cache */
+#pragma DATA_SECTION (hdrTmplCache, ".testData");
+static BcpTest_HdrTmpl  hdrTmplCache[BCP_TEST_HDR_TMPL_CACHE_SIZE];
+#pragma DATA_SECTION (hdrTmplUseCtr, ".testData");
+static UInt32           hdrTmplUseCtr = 0;
+
+/* Registered pre-packed templates */
+#pragma DATA_SECTION (hdrTmplBlobs, ".testData");
+static const BcpTest_HdrBlob*   hdrTmplBlobs = NULL;
+#pragma DATA_SECTION (hdrTmplNumBlobs, ".testData");
+static UInt32           hdrTmplNumBlobs = 0;
+
+/* Probe build buffer */
+#pragma DATA_SECTION (hdrTmplProbe, ".testData");
+static UInt32           hdrTmplProbe[BCP_TEST_HDR_TMPL_MAX_WORDS];
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_load_blob
+ *
+ *   @b Description
+ *   @n Fills a cache entry from a pre-packed template.
+ * =============================================================================
+ */
+static Void hdr_tmpl_load_blob (BcpTest_HdrTmpl* pTmpl, const BcpTest_HdrBlob* pBlob)
+{
+    pTmpl->hdrLen       =   pBlob->hdrLen;
+    pTmpl->numFields    =   pBlob->numFields;
+    memcpy (pTmpl->field, pBlob->field, sizeof (pTmpl->field));
+    memcpy (pTmpl->auxData, pBlob->auxData, sizeof (pTmpl->auxData));
+    memcpy (pTmpl->hdr, pBlob->pHdr, pBlob->hdrLen);
+    pTmpl->state        =   BCP_TEST_HDR_TMPL_READY;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_lookup
+ *
+ *   @b Description
+ *   @n Returns the template of the configuration key passed. When the key
+ *      is not cached the least recently used entry is replaced, either by
+ *      the registered blob of the key, in BCP_TEST_HDR_TMPL_READY state, or
+ *      else in BCP_TEST_HDR_TMPL_EMPTY state, to be filled in with
+ *      @a hdr_tmpl_create ().
+ *
+ *   @param[in]
+ *   @n pKey            Configuration key, i.e., all header inputs other
+ *                      than the volatile fields.
+ *
+ *   @param[in]
+ *   @n keyLen          Number of key words.
+ *
+ *   @return        BcpTest_HdrTmpl*
+ *   @n NULL    -   Key too long.
+ *   @n Valid template handle otherwise.
+ * =============================================================================
+ */
+BcpTest_HdrTmpl* hdr_tmpl_lookup
+(
+    const UInt32*       pKey,
+    UInt32              keyLen
+)
+{
+    UInt32              i, victim = 0;
+    BcpTest_HdrTmpl*    pTmpl;
+
+    if (keyLen > BCP_TEST_HDR_TMPL_MAX_KEY)
+        return NULL;
+
+    for (i = 0; i < BCP_TEST_HDR_TMPL_CACHE_SIZE; i ++)
+    {
+        pTmpl = &hdrTmplCache [i];
+
+        if (pTmpl->state != BCP_TEST_HDR_TMPL_EMPTY && pTmpl->keyLen == keyLen &&
+            memcmp (pTmpl->key, pKey, keyLen * 4) == 0)
+        {
+            pTmpl->lastUsed = ++ hdrTmplUseCtr;
+            return pTmpl;
+        }
+
+        if (hdrTmplCache [i].lastUsed < hdrTmplCache [victim].lastUsed)
+            victim = i;
+    }
+
+    pTmpl = &hdrTmplCache [victim];
+    memset (pTmpl->key, 0, sizeof (pTmpl->key));
+    memcpy (pTmpl->key, pKey, keyLen * 4);
+    pTmpl->keyLen   =   keyLen;
+    pTmpl->state    =   BCP_TEST_HDR_TMPL_EMPTY;
+    pTmpl->lastUsed =   ++ hdrTmplUseCtr;
+
+    for (i = 0; i < hdrTmplNumBlobs; i ++)
+    {
+        if (hdrTmplBlobs [i].keyLen == keyLen && memcmp (hdrTmplBlobs [i].key, pKey, keyLen * 4) == 0)
+        {
+            hdr_tmpl_load_blob (pTmpl, &hdrTmplBlobs [i]);
+            break;
+        }
+    }
+
+    return pTmpl;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_locate
+ *
+ *   @b Description
+ *   @n Compares a probe build against the template header and returns the
+ *      bit position (word * 32 + bit) of the single bit that differs, or -1
+ *      if the builds do not differ in exactly one bit.
+ * =============================================================================
+ */
+static Int32 hdr_tmpl_locate (const BcpTest_HdrTmpl* pTmpl)
+{
+    UInt32              i, diff, numWords = (pTmpl->hdrLen + 3) >> 2;
+    Int32               pos = -1;
+
+    for (i = 0; i < numWords; i ++)
+    {
+        if ((diff = pTmpl->hdr [i] ^ hdrTmplProbe [i]) == 0)
+            continue;
+
+        if (pos >= 0 || (diff & (diff - 1)))
+            return -1;
+
+#ifdef _TMS320C6X
+        pos =   i * 32 + (31 - _lmbd (1, diff));
+#else
+        for (pos = i * 32; !(diff & 1); pos ++)
+            diff    >>= 1;
+#endif
+    }
+
+    return pos;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_create
+ *
+ *   @b Description
+ *   @n Builds the template header with the base field values and locates
+ *      every volatile field, flipping one field bit at a time.
+ *
+ *   @param[in]
+ *   @n pTmpl           Template returned by @a hdr_tmpl_lookup ().
+ *
+ *   @param[in]
+ *   @n buildFxn        Header chain builder.
+ *
+ *   @param[in]
+ *   @n pArg            Builder argument.
+ *
+ *   @param[in]
+ *   @n numFields       Number of volatile fields.
+ *
+ *   @param[in]
+ *   @n pBaseVal        Field values to build the template with.
+ *
+ *   @param[in]
+ *   @n pWidth          Number of bits of each field, 1 to 32.
+ *
+ *   @return        Int32
+ *   @n 0       -   Template ready.
+ *   @n -1      -   Build error, invalid field width, or a field could not be
+ *                  located. The template is left in BCP_TEST_HDR_TMPL_NO_PATCH
+ *                  state in the latter two cases.
+ * =============================================================================
+ */
+Int32 hdr_tmpl_create
+(
+    BcpTest_HdrTmpl*    pTmpl,
+    BcpTest_HdrBuildFxn buildFxn,
+    Void*               pArg,
+    UInt32              numFields,
+    const UInt32*       pBaseVal,
+    const UInt8*        pWidth
+)
+{
+    UInt32              val [BCP_TEST_HDR_TMPL_MAX_FIELDS];
+    UInt32              f, b;
+    Int32               len, pos;
+
+    if (numFields > BCP_TEST_HDR_TMPL_MAX_FIELDS)
+        return -1;
+
+    memset (pTmpl->hdr, 0, sizeof (pTmpl->hdr));
+    if ((len = buildFxn (pArg, pBaseVal, (UInt8 *) pTmpl->hdr)) <= 0)
+        return -1;
+    pTmpl->hdrLen       =   len;
+    pTmpl->numFields    =   numFields;
+    pTmpl->state        =   BCP_TEST_HDR_TMPL_NO_PATCH;
+
+    for (f = 0; f < numFields; f ++)
+    {
+        /* hdr_tmpl_apply () masks 1 to 32 bits */
+        if (pWidth [f] == 0 || pWidth [f] > 32)
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Header template field %d width %d not supported \n", f, pWidth [f]);
+#endif
+            return -1;
+        }
+
+        memcpy (val, pBaseVal, numFields * 4);
+
+        for (b = 0; b < pWidth [f]; b ++)
+        {
+            val [f] =   pBaseVal [f] ^ (1u << b);
+
+            memset (hdrTmplProbe, 0, sizeof (hdrTmplProbe));
+            if (buildFxn (pArg, val, (UInt8 *) hdrTmplProbe) != len)
+                return -1;
+
+            if ((pos = hdr_tmpl_locate (pTmpl)) < 0)
+            {
+#ifdef BCP_TEST_DEBUG
+                Bcp_osalLog ("Header template field %d bit %d not found \n", f, b);
+#endif
+                return -1;
+            }
+
+            if (b == 0)
+            {
+                pTmpl->field [f].wordIdx    =   pos >> 5;
+                pTmpl->field [f].shift      =   pos & 31;
+            }
+            else if ((UInt32) pTmpl->field [f].shift + b > 31 ||
+                     (UInt32) pos != pTmpl->field [f].wordIdx * 32 + pTmpl->field [f].shift + b)
+            {
+#ifdef BCP_TEST_DEBUG
+                Bcp_osalLog ("Header template field %d is not contiguous \n", f);
+#endif
+                return -1;
+            }
+        }
+        pTmpl->field [f].width  =   pWidth [f];
+    }
+    pTmpl->state    =   BCP_TEST_HDR_TMPL_READY;
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_apply
+ *
+ *   @b Description
+ *   @n Copies the template header to the data buffer and stores the
+ *      volatile field values passed.
+ *
+ *   @param[in]
+ *   @n pTmpl           Template in BCP_TEST_HDR_TMPL_READY state.
+ *
+ *   @param[in]
+ *   @n pFieldVal       Field values of this packet.
+ *
+ *   @param[out]
+ *   @n pDataBuffer     Packet buffer, 32 bit aligned.
+ *
+ *   @return        UInt32
+ *   @n Number of header bytes added.
+ * =============================================================================
+ */
+UInt32 hdr_tmpl_apply
+(
+    const BcpTest_HdrTmpl* pTmpl,
+    const UInt32*       pFieldVal,
+    UInt8*              pDataBuffer
+)
+{
+    UInt32*             pWord = (UInt32 *) pDataBuffer;
+    const BcpTest_HdrField* pField = pTmpl->field;
+    UInt32              f, mask;
+
+    memcpy (pDataBuffer, pTmpl->hdr, pTmpl->hdrLen);
+
+    for (f = 0; f < pTmpl->numFields; f ++, pField ++)
+    {
+        mask    =   (0xFFFFFFFFu >> (32 - pField->width)) << pField->shift;
+        pWord [pField->wordIdx] =   (pWord [pField->wordIdx] & ~mask) | ((pFieldVal [f] << pField->shift) & mask);
+    }
+
+    return pTmpl->hdrLen;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_flush_cache
+ *
+ *   @b Description
+ *   @n Invalidates all cached header templates.
+ * =============================================================================
+ */
+Void hdr_tmpl_flush_cache (Void)
+{
+    UInt32              i;
+
+    for (i = 0; i < BCP_TEST_HDR_TMPL_CACHE_SIZE; i ++)
+    {
+        hdrTmplCache [i].state      =   BCP_TEST_HDR_TMPL_EMPTY;
+        hdrTmplCache [i].lastUsed   =   0;
+    }
+    hdrTmplUseCtr   =   0;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_register_blobs
+ *
+ *   @b Description
+ *   @n Registers a table of pre-packed templates, e.g., one written by
+ *      @a hdr_tmpl_export_cache () and linked in. Cached templates are left
+ *      as they are.
+ *
+ *   @param[in]
+ *   @n pBlobs          Template table.
+ *
+ *   @param[in]
+ *   @n numBlobs        Number of templates in the table.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void hdr_tmpl_register_blobs
+(
+    const BcpTest_HdrBlob*  pBlobs,
+    UInt32              numBlobs
+)
+{
+    hdrTmplBlobs    =   pBlobs;
+    hdrTmplNumBlobs =   numBlobs;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b hdr_tmpl_export_cache
+ *
+ *   @b Description
+ *   @n Writes all ready templates of the cache as C source: the header words
+ *      of each template and a BcpTest_HdrBlob table pName[] of pName_count
+ *      entries, to be registered with @a hdr_tmpl_register_blobs ().
+ *
+ *   @param[in]
+ *   @n fpOut           Output file handle.
+ *
+ *   @param[in]
+ *   @n pName           Table name.
+ *
+ *   @return        Int32
+ *   @n Number of templates written.
+ * =============================================================================
+ */
+Int32 hdr_tmpl_export_cache
+(
+    FILE*               fpOut,
+    const char*         pName
+)
+{
+    BcpTest_HdrTmpl*    pTmpl;
+    UInt32              i, j, numBlobs = 0;
+
+    fprintf (fpOut, "/* Pre-packed BCP header templates, generated by hdr_tmpl_export_cache () */\n");
+    fprintf (fpOut, "#include \"bcp_test.h\"\n\n");
+
+    for (i = 0; i < BCP_TEST_HDR_TMPL_CACHE_SIZE; i ++)
+    {
+        pTmpl = &hdrTmplCache [i];
+        if (pTmpl->state != BCP_TEST_HDR_TMPL_READY)
+            continue;
+
+        fprintf (fpOut, "static const UInt32 %s_hdr%d[%d] = {", pName, i, (pTmpl->hdrLen + 3) >> 2);
+        for (j = 0; j < (pTmpl->hdrLen + 3) >> 2; j ++)
+            fprintf (fpOut, "%s0x%08x%s", (j % 6) ? " " : "\n    ", pTmpl->hdr [j],
+                     (j + 1 < (pTmpl->hdrLen + 3) >> 2) ? "," : "");
+        fprintf (fpOut, "\n};\n\n");
+    }
+
+    fprintf (fpOut, "const BcpTest_HdrBlob %s[] = {\n", pName);
+    for (i = 0; i < BCP_TEST_HDR_TMPL_CACHE_SIZE; i ++)
+    {
+        pTmpl = &hdrTmplCache [i];
+        if (pTmpl->state != BCP_TEST_HDR_TMPL_READY)
+            continue;
+
+        fprintf (fpOut, "    {\n        {");
+        for (j = 0; j < BCP_TEST_HDR_TMPL_MAX_KEY; j ++)
+            fprintf (fpOut, "%s%u", j ? ", " : "", pTmpl->key [j]);
+        fprintf (fpOut, "}, %u, %u, %u,\n        {", pTmpl->keyLen, pTmpl->hdrLen, pTmpl->numFields);
+        for (j = 0; j < BCP_TEST_HDR_TMPL_MAX_FIELDS; j ++)
+            fprintf (fpOut, "%s{%u, %u, %u}", j ? ", " : "", pTmpl->field [j].wordIdx,
+                     pTmpl->field [j].shift, pTmpl->field [j].width);
+        fprintf (fpOut, "},\n        {");
+        for (j = 0; j < BCP_TEST_HDR_TMPL_MAX_AUX; j ++)
+            fprintf (fpOut, "%s%u", j ? ", " : "", pTmpl->auxData [j]);
+        fprintf (fpOut, "},\n        %s_hdr%d\n    },\n", pName, i);
+        numBlobs ++;
+    }
+    fprintf (fpOut, "};\n\nconst UInt32 %s_count = %d;\n", pName, numBlobs);
+
+    return numBlobs;
+}
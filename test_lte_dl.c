@@ -19,12 +19,40 @@
 
 /* Test configuration parameters */
 #define     TX_DATA_BUFFER_SIZE             2048 
+#define     TX_HDR_BUFFER_SIZE              (BCP_TEST_HDR_TMPL_MAX_WORDS * 4)
 #define     RX_DATA_BUFFER_SIZE             2048
 #define     TX_NUM_DESC                     2
-#define     RX_NUM_DESC                     (BCP_TEST_NUM_HOST_DESC/4 - TX_NUM_DESC)
+#define     RX_NUM_DESC                     (BCP_TEST_NUM_HOST_DESC/4 - 2 * TX_NUM_DESC)
 #define     RX_Q_NUM                        900 + CSL_chipReadReg (CSL_CHIP_DNUM)
 #define     RX_FLOW_ID                      0 + CSL_chipReadReg (CSL_CHIP_DNUM)
 
+/* Modulator output RMS */
+#define     LTE_DL_MOD_RMS                  1024
+
+/* Define LTE_DL_MOD_COMPRESSED to run the test with the hard modulator in
+ * compressed mode. BCP then outputs packed constellation indices instead of
+ * I/Q words, which are expanded back before validating against the golden
+ * output.
+ *
+ * Define LTE_DL_GOLDEN_DIGEST to check the output against a digest of the
+ * golden output instead of the golden output itself, for long runs.
+ *
+ * Define LTE_DL_REF_MODEL to check the output against the output of the DL
+ * chain model of test_lte_ref.c instead, computed from the transport block
+ * and the header configuration of the packet while BCP runs, so that grants
+ * with no stored golden output can be checked. host/lte_ref_dl_check.c
+ * checks the model against the golden output of the test grant.
+ */
+#if defined (LTE_DL_REF_MODEL) && defined (LTE_DL_GOLDEN_DIGEST)
+#error "LTE_DL_REF_MODEL and LTE_DL_GOLDEN_DIGEST are exclusive"
+#endif
+
+#ifdef LTE_DL_MOD_COMPRESSED
+#define     LTE_DL_MOD_OPERATION_MODE       1
+#else
+#define     LTE_DL_MOD_OPERATION_MODE       0
+#endif
+
 /* High Priority Accumulator configuration . */
 #define     ACC_CHANNEL_NUM                 4 + CSL_chipReadReg (CSL_CHIP_DNUM)
 #define     ACC_LIST_ENTRY_CNT              1
@@ -48,6 +76,12 @@ static UInt32       gRxPktList[ACC_LIST_SIZE];
 #pragma DATA_SECTION (gRxPktListCtr, ".testData");
 static UInt32       gRxPktListCtr;
 
+/* Packets the ISR found no room for on the software list. They are never
+ * validated nor their descriptors recycled, so any drop fails the test.
+ */
+#pragma DATA_SECTION (gRxPktListDrops, ".testData");
+static UInt32       gRxPktListDrops;
+
 static Void register_rx_interrupts (Void);
 
 /* Rx High Priority Accumulation ISR */
@@ -280,3283 +314,407 @@ static const UInt16 TurboInterTable[189][3] = {
 /* Reference Output Data for the test */
 #define LTE_DL_OUTPUT_PKT_1_WRD_SIZE  12600
 
-#pragma DATA_SECTION (lte_dl_out_packet_1, ".testData");
-static UInt32 lte_dl_out_packet_1[LTE_DL_OUTPUT_PKT_1_WRD_SIZE] = {
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d402d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4, 0xfd2cfd2c,
-  0x02d402d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4,
-  0x02d402d4, 0xfd2c02d4, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d402d4, 0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d402d4, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0xfd2cfd2c, 0xfd2c02d4,
-  0xfd2c02d4, 0x02d4fd2c, 0x02d4fd2c, 0x02d402d4,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0x02d402d4, 0x02d402d4, 0x02d4fd2c, 0xfd2c02d4,
-  0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4, 0x02d4fd2c,
-  0x02d4fd2c, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2c02d4,
-  0x02d402d4, 0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d402d4, 0x02d4fd2c, 0xfd2cfd2c,
-  0x02d402d4, 0x02d4fd2c, 0x02d402d4, 0x02d402d4,
-  0xfd2cfd2c, 0x02d402d4, 0x02d402d4, 0x02d4fd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4, 0xfd2c02d4,
-  0x02d4fd2c, 0x02d4fd2c, 0xfd2c02d4, 0xfd2cfd2c,
-  0x02d4fd2c, 0xfd2cfd2c, 0x02d4fd2c, 0x02d402d4,
-  0xfd2cfd2c, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0x02d4fd2c, 0xfd2c02d4, 0x02d4fd2c, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0xfd2c02d4, 0x02d402d4,
-  0xfd2c02d4, 0xfd2c02d4, 0x02d402d4, 0xfd2c02d4,
-  0xfd2c02d4, 0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c,
-  0xfd2cfd2c, 0x02d4fd2c, 0xfd2cfd2c, 0xfd2cfd2c};
+#ifdef LTE_DL_GOLDEN_DIGEST
+/* Reference output digest, written by tools/golden_pack.c -d: the output is
+ * checked a 1 KB chunk at a time as it arrives, and only a chunk that does
+ * not match is read back from LTE_DL_VEC_MOD_OUT, the reference output
+ * converted by tools/vec_conv.c, to locate the words that differ.
+ */
+#define LTE_DL_VEC_MOD_OUT                   "..\\..\\lte\\pdsch_modOut_0002.bvec"
+
+#pragma DATA_SECTION (lteDlDigestPkt1_hashes, ".testData");
+static const UInt32 lteDlDigestPkt1_hashes[100] = {
+  0x6e4ac43d, 0xa7aa7301, 0xc6dec5ed, 0x93ffa2f5,
+  0x538df45d, 0x3b62b9b3, 0x4f65cd55, 0x56007ff3,
+  0x66895275, 0xeb30cf63, 0xf73c57fd, 0xf17377ef,
+  0x0ea048b5, 0x2ea21d33, 0x01c0fc4d, 0x9c968bb1,
+  0xc2febcfd, 0x90c292f1, 0x15931ccd, 0xc44006b8,
+  0x30a6b4f5, 0x01dbf761, 0x15efc48d, 0xdac1b457,
+  0xac3cac25, 0xefce94e1, 0xd994168d, 0x3f715aac,
+  0x3259c7c5, 0xa8d4222f, 0x0e428a9d, 0xa86b6189,
+  0xde284b3d, 0xdeb02a05, 0x98e7d6ad, 0xe64fc2a0,
+  0x54c2d045, 0x88b56801, 0x3b7d42a5, 0x9357a7fe,
+  0x8418115d, 0x2fdba965, 0x9a8267ed, 0xefa84de5,
+  0x0303443d, 0xca43a0f2, 0xc2ff7ee5, 0xeb4bda97,
+  0xc58e7915, 0xbb50a9f9, 0xe9a16035, 0x58eb1ab2,
+  0x6953455d, 0xd3bb852a, 0xad80ce0d, 0x4749003e,
+  0x92b8c09d, 0x08533799, 0x8ff0a24d, 0x904a62e0,
+  0x94c029a5, 0x232fb6c6, 0x0b376dfd, 0x6c059694,
+  0x40faf90d, 0x8a2e98b6, 0x00a32dbd, 0x347389d2,
+  0xb5490445, 0x25d267d4, 0x968bbc75, 0x6c70c270,
+  0xc2a286bd, 0xb1b06c93, 0x9638b085, 0xd2136aa2,
+  0x6068f295, 0xc8357683, 0xa44c4445, 0x1a962d8b,
+  0x23e1d52d, 0x40df9165, 0x515affcd, 0x5e8c35db,
+  0xb738402d, 0x164cf11d, 0x82d28015, 0x3c69b344,
+  0x6eae883d, 0x922eb347, 0x716313dd, 0xdbbf066c,
+  0x8a781b6d, 0xa10055b5, 0x3fa7f6ad, 0x0627c7fe,
+  0x90c46325, 0xd88ab603, 0x5246f45d, 0x9d13032d};
+
+static const BcpTest_Digest lteDlDigestPkt1 = {50400, 50, lteDlDigestPkt1_hashes, LTE_DL_VEC_MOD_OUT};
+
+#pragma DATA_SECTION (lteDlDigestCheck, ".testData");
+static BcpTest_DigestCheck lteDlDigestCheck;
+#elif defined (LTE_DL_REF_MODEL)
+/* Reference output computed by the DL chain model, and its length in bytes */
+#pragma DATA_SECTION (lteDlRefJob, ".testData");
+static BcpTest_LteRefJob*   lteDlRefJob;
+#pragma DATA_SECTION (lteDlRefOut, ".testData");
+static const UInt32*        lteDlRefOut;
+#pragma DATA_SECTION (lteDlRefOutLen, ".testData");
+static UInt32               lteDlRefOutLen;
+#else
+/* Reference output, dictionary coded by tools/golden_pack.c: the I/Q words
+ * of the QPSK modulator output as 2 bit indices into the words used.
+ */
+#pragma DATA_SECTION (lteDlGoldenPkt1_dict, ".testData");
+static const UInt32 lteDlGoldenPkt1_dict[4] = {
+  0xfd2c02d4, 0x02d402d4, 0xfd2cfd2c, 0x02d4fd2c};
+
+#pragma DATA_SECTION (lteDlGoldenPkt1_idx, ".testData");
+static const UInt32 lteDlGoldenPkt1_idx[788] = {
+  0xe11f7950, 0xa06471da, 0xcfe6b160, 0xb67b8c0b,
+  0x25445c3e, 0x5187eda6, 0xfca7cbbf, 0xb66b6af2,
+  0x1b268473, 0x45ede65d, 0x55c72bba, 0x438d7cb8,
+  0x03aa5045, 0xcc1194ab, 0x5dd42b4b, 0x130c2b27,
+  0x2414286a, 0x96ed53c2, 0xc3e22bce, 0xea7d644b,
+  0x3a577267, 0xe25ae3d2, 0xf731c4f9, 0x34bf6474,
+  0x42ca2a67, 0x6417cba8, 0x85b9d8fa, 0x8b2a367b,
+  0x4749acd6, 0x97b67492, 0x53781592, 0x84eef340,
+  0x738d8893, 0xdea214fe, 0x00a7e893, 0xec6e8ea9,
+  0x75f1463a, 0x27409fef, 0x2fd99f2b, 0x99d39702,
+  0x12ee41f3, 0x15bf6f00, 0x992f5fa4, 0xf64ae4e3,
+  0x3a96cf31, 0x14489682, 0xb1d8a13b, 0x84c24733,
+  0xbb57a55b, 0x5b5d8674, 0x378ae55b, 0x4971d314,
+  0xd458ad5c, 0x5020fea1, 0x42e078b3, 0xa9fc150b,
+  0x2bfefcd6, 0xf2512533, 0x4c9e81cd, 0x0d2a4615,
+  0xb3e44fe1, 0x52b5c62f, 0x886a8832, 0x85c3335e,
+  0x54c58453, 0xa75de8c0, 0xe9b2dc07, 0xe81f8d6b,
+  0x36492b46, 0x8eb957fd, 0xa668deb4, 0xa7d1603a,
+  0xb0b49d2c, 0x9b2a989b, 0xd92a3cff, 0x1d9c08f4,
+  0x6568cb50, 0xffe7be43, 0x5040b3e1, 0xbab7d7ce,
+  0xe459cd5c, 0xb9c694aa, 0xfdc93be5, 0xf06a423e,
+  0x0b82787a, 0xc5bf6992, 0xd85057f4, 0x81695b6d,
+  0xf55e8d99, 0x930d8c36, 0xf7e60f00, 0x3611b425,
+  0x435e73d4, 0xb9dd1fda, 0xdf73c2b1, 0xb81b2399,
+  0xb6a9f54c, 0x2850e1c1, 0x103c7cf5, 0xad47ec96,
+  0xc6e21169, 0x4904d30c, 0x8975ece0, 0xeb616bf0,
+  0xfe3fe01d, 0x824c525a, 0x32d80c34, 0xa60870b7,
+  0xde7251e5, 0x089c20ed, 0x17e56095, 0x8d3d16e1,
+  0xf84238aa, 0xb5a13029, 0x9759ba7a, 0xb789cdee,
+  0x7b7d103d, 0x8a496efb, 0xd21c8eea, 0x1e65a24e,
+  0x07f165d9, 0x199a75ab, 0xef08245e, 0xf428721f,
+  0xbc1cbc74, 0x3835247f, 0x91dd7e49, 0x85cb7811,
+  0x5fee9fe4, 0x358d5833, 0x3fba20e4, 0x543eb2ec,
+  0x8bd541f1, 0xef98ea9a, 0x6cb5c526, 0x7867c4b6,
+  0x11aef543, 0xab747c7e, 0x02d8f65d, 0xbe63b789,
+  0xa3606356, 0xc6f0b88c, 0x79e270e3, 0x104450d1,
+  0xb72cb087, 0x4c4a7f23, 0x15a6f5b4, 0x1dafc8c5,
+  0xb7c02a87, 0x3598fbfc, 0x9f83dd7e, 0xba896db0,
+  0xda78b1c8, 0x75cb2b7d, 0xe79604e1, 0xbf1c3658,
+  0x427956ed, 0x5eac777f, 0xb22b2454, 0xb883f14b,
+  0xe34baa2d, 0xf5c46e0d, 0xdd6cf2be, 0x73403707,
+  0xf93365d1, 0xa5be7a21, 0x930616da, 0x7a429554,
+  0xdf152f60, 0x3eee3403, 0x037715de, 0x4315fe98,
+  0x457776cd, 0x4be93594, 0xf67264a8, 0x0f728814,
+  0x16e85200, 0x23cb334f, 0xf40ea4d9, 0x5fd4b81d,
+  0x70182cf9, 0x7baed211, 0xdf7ae89a, 0xc88d1d4d,
+  0x4c591513, 0xd6b9d236, 0x781370f6, 0x5c29deeb,
+  0x93f3853c, 0x6a6d943f, 0xdff206f9, 0xf3fc8ad4,
+  0xfba20d39, 0xdf0691c0, 0x576520dc, 0xacba96d1,
+  0x271ddad6, 0x77cf328a, 0xe8a12206, 0xd586268e,
+  0xbcee3027, 0x2eb4eeb9, 0x041f8be4, 0xdea8af4c,
+  0x97a8b3f1, 0x3cde984b, 0x1bafc7b4, 0xcb91b1e1,
+  0x689851ac, 0x32dabc22, 0x962bfd42, 0x19945d64,
+  0x50cf55cf, 0x713ef5da, 0x83147a80, 0xa3cfc010,
+  0x3c4e9f98, 0x9233cba0, 0x9d89439b, 0xbbfc72d5,
+  0x62d2a9e8, 0x4f8d6f0e, 0x8c099c55, 0x2a4c558b,
+  0x6bfeaad2, 0x58604905, 0x7cb7e527, 0x98435dc0,
+  0x66af39ad, 0x7b78b249, 0xf08f1aca, 0x234e8655,
+  0x5181de53, 0xd0b38ed2, 0x0683e600, 0x7368be18,
+  0x94cab336, 0x9ad705f3, 0x91b1906b, 0xfb1d57f6,
+  0xab1aee33, 0x12df85c9, 0xb50ad503, 0xce18734c,
+  0x40536fcb, 0x889285b8, 0x76f552ad, 0xc1f1ed26,
+  0x3c75305f, 0xcc74c66e, 0x0c357fe8, 0x091e5c57,
+  0xf1924eb3, 0x70034e67, 0x9477dcbb, 0x8f5c000d,
+  0xf8920fc1, 0x64226cf2, 0x1b2cb2b5, 0x30f9bd84,
+  0x7644599e, 0xc3b7ed0c, 0xdd1661c1, 0xad04ef4a,
+  0xffe29f87, 0x25eaf299, 0xa4581f53, 0x3a1a76ed,
+  0xf88c4c61, 0x4f6c3c64, 0x96fca076, 0xd2a22a0f,
+  0x1d2f44a5, 0x866cd336, 0xe6534a24, 0x1f676cd9,
+  0x183dc154, 0xe06cc899, 0xead08fb7, 0xf3b73ab3,
+  0x142dae1a, 0xd5a53442, 0xa03dcdde, 0xf68be8c6,
+  0x0859b908, 0x6dc98cfb, 0x5877aa2b, 0x63397f74,
+  0xec401904, 0xc6920067, 0x9a2315b3, 0xad32609b,
+  0x99e0933c, 0xef76dc48, 0x46c4f7bb, 0x1e13883c,
+  0xdcdfea31, 0xa2781578, 0x8fe59cfa, 0x618dd64f,
+  0x03a0e68f, 0xd9ab35aa, 0x2afebdf1, 0x69f99d6c,
+  0x2fa7074c, 0xa0e17691, 0x82ec9178, 0xbfec45bb,
+  0x30bcacd5, 0x55c0a10a, 0x67678e03, 0x64e2507f,
+  0x66c54889, 0x8a2dfe8e, 0x44a691ab, 0x3a934b4d,
+  0x571041a5, 0x92b3411f, 0xd67298bd, 0xdceb8d3b,
+  0x917febbb, 0xbb7bf98b, 0x2d9b3176, 0xb2122ffe,
+  0x117d4e49, 0x14e49932, 0xec9270ec, 0xd1f13683,
+  0x2bb78821, 0x076740e7, 0x3561cfac, 0x203e780b,
+  0x6b6e636e, 0xcb912eec, 0x45b04c01, 0x530e0c3a,
+  0x01d187d6, 0x0fe0269e, 0x1be02b80, 0x33c39286,
+  0x33ab9129, 0xdc96c7bf, 0x69e43b66, 0x75a0b93d,
+  0x13153e21, 0x6ed9c148, 0xd8f383fd, 0x49e05a17,
+  0x7eb1c556, 0x71679df8, 0x6d0886cf, 0xf44dbc6c,
+  0x03151c7a, 0x68323cbf, 0x477769fa, 0x526cd657,
+  0x1ccce60b, 0x787cab80, 0x94a5ea5d, 0xbb9f0a71,
+  0x18e89911, 0xacffea13, 0xfedebe96, 0xeb093135,
+  0xbe86a91c, 0x1c5b9c5d, 0x378843b6, 0x49114a03,
+  0x3eec68cb, 0x167983a0, 0x51154688, 0xacf5e9ca,
+  0xeef92f38, 0x2c678b95, 0xeb16df39, 0x53b0f7f2,
+  0x276079ee, 0x0ae8e247, 0xc617acde, 0x58900801,
+  0xec08ae74, 0xdd8f6697, 0xd8dab231, 0x59dd699f,
+  0x2ba48845, 0x562ef04f, 0x3b996219, 0x71dfdfa9,
+  0x865b6c1d, 0xeb5c23f3, 0x2f6c84e8, 0xe6696dab,
+  0xb9e965c2, 0x0b681695, 0x55dfd622, 0xedb11b63,
+  0x53df623a, 0x51ad943b, 0x6310b34a, 0x5ebf5ddf,
+  0x04c7b330, 0xcc717616, 0x1343fefa, 0x0467c200,
+  0x238a880b, 0x3e3859e2, 0x4fafcff3, 0x2e387943,
+  0x4f0ebf1f, 0x577a7bbe, 0xd3354a20, 0xf7f236db,
+  0x667d8c69, 0x9027c3f8, 0x771e5699, 0x088219b2,
+  0x77f2512e, 0x3e72c838, 0x7279f8d4, 0x846d658f,
+  0x29db0317, 0xb14aaaad, 0x874a2038, 0x7f9f15ee,
+  0x8ea8aa48, 0x509b9ab2, 0x723514ec, 0xadc1716a,
+  0xec21a34f, 0x6caac156, 0x5bbe81e9, 0xc6197d37,
+  0xfb2b28d6, 0x684e7f8e, 0xb9739437, 0x53444402,
+  0xeb26628d, 0x5191ebbb, 0x742b1faa, 0xbcded577,
+  0xb8f17de6, 0xa1cef329, 0x820e03a1, 0xf82bcfe6,
+  0x7ad53679, 0x429bdad4, 0xa7fc5eb6, 0xe10b7ee6,
+  0x3fa7f733, 0xbbf3f7a2, 0x88a59c8e, 0xe10259bf,
+  0x422e7a04, 0xac8dcf17, 0x9cb5ae23, 0x8edf4661,
+  0x33d730b9, 0x815b0cb4, 0x18fc06f5, 0xf28bdb4c,
+  0x789182e2, 0xd878b3be, 0xb45ebe23, 0x3fe334d5,
+  0x26950863, 0xeea72b59, 0x1672582d, 0x6be1d385,
+  0x1956db62, 0x2f822cc7, 0x2a34fc5f, 0xed3706c7,
+  0xa548a658, 0x7e33d84e, 0xbbec2d1a, 0xf1ebc154,
+  0x0d020810, 0x12867f6f, 0x52159ce0, 0xbf38eec6,
+  0x82bbf3a1, 0xd551a42c, 0xfb621d85, 0x0854716b,
+  0x586b410d, 0x1eb9bfbd, 0x964e778a, 0x3cad0231,
+  0x4e2b542b, 0xc8104fa4, 0x7164d7b8, 0xa9e8ffb8,
+  0x2ce4ef13, 0x8c88bd61, 0x7269fa8b, 0xed9eaa22,
+  0xb11a4273, 0xa2cac877, 0x218432b1, 0x564d87d3,
+  0x53499173, 0xf95adf61, 0xf518541d, 0x5bb58d5f,
+  0xaa490aa9, 0xe8cc6e34, 0xc18c2ca3, 0x1cd491b4,
+  0x4e1ff05e, 0xcb868772, 0x53661eae, 0xf292edae,
+  0xa3b04c8a, 0x3f84c100, 0xef99c903, 0x54310923,
+  0x8f12d899, 0x012e23ad, 0x8c6d9fa0, 0x2a43769c,
+  0x39b7d995, 0x885fc942, 0xb0fcb40d, 0x60819cdf,
+  0x6075f2a8, 0x5afe1d0b, 0x59f3b2de, 0x82c2fbc3,
+  0x76344f55, 0x3c0fadaa, 0x83315480, 0x41e1944c,
+  0xee7da7d3, 0xfb94b653, 0x3f9e8763, 0x9047cfc5,
+  0x76eb6151, 0x5e18e4d7, 0x5256c564, 0x71cad7af,
+  0xd9084f2e, 0x642928c4, 0xd36926d7, 0xcfd0b240,
+  0x535d3ab4, 0xad7fde5e, 0x90eb241c, 0x1b579d52,
+  0x9ef18bc5, 0xbed2eeb4, 0xf15e1c7d, 0x9ca08148,
+  0xe7a3cd9a, 0x89763fe3, 0x42b21593, 0xe4359b5b,
+  0xea192431, 0x61ce95d8, 0x37cce66c, 0x1adfaa51,
+  0x46a4cb9e, 0x7b4045bc, 0xaea1c645, 0x1cd2be86,
+  0xa0b7141e, 0x19329a1e, 0x1fc1f118, 0x827436d6,
+  0x84e1f5f1, 0x7aba5857, 0xc2e863e8, 0xc4c908ca,
+  0x15f7a79d, 0x7f056fa6, 0x5bc01445, 0xc3560500,
+  0x1da13a6e, 0x0d0f50bc, 0xe9fdbbc6, 0x996622fc,
+  0x237d5559, 0x7e7624c2, 0x94e9b36c, 0x9ba32ecb,
+  0x4619553a, 0x64c9326a, 0xac349d31, 0xf6d89e1f,
+  0xeceafc50, 0x2772c736, 0x4c401c73, 0x1650acbd,
+  0x457542e4, 0x4c6c5ab1, 0x88438214, 0x340208d9,
+  0xa8bbd9ac, 0xf40e7020, 0x9cd7be48, 0xbb7e2ba6,
+  0x99abb791, 0xbc87b4b1, 0xe5097cab, 0xb782207a,
+  0x7eba3a5a, 0x8e58e7df, 0x4b4924d1, 0xe8f3927e,
+  0xf4c33df5, 0xd412d2fb, 0xc11512e7, 0x4cb7bc00,
+  0xb6209d53, 0x8b0522af, 0x40a2ddd4, 0x51f0dbef,
+  0x2ad02c3c, 0x82b247e8, 0x0299f380, 0x52e487e0,
+  0xdafddeaa, 0x573a2e2a, 0x1ee7eaba, 0xd567b396,
+  0x4d8401dd, 0x244ba24e, 0x21944373, 0xce8e7afa,
+  0x66456d48, 0x4bf78b24, 0xa0b5663a, 0x9b2516ec,
+  0xf798522e, 0x061a82e0, 0xe3c534a7, 0xfbf6a52c,
+  0xff660a5a, 0x81b5f8d3, 0x499f4f33, 0x95f4d22b,
+  0x9b400283, 0xed169be4, 0x8ed0942c, 0xfeb4ba82,
+  0x1da58e5a, 0xc503ed34, 0x303ce01b, 0x1324b702,
+  0x03880e8a, 0xe67d72b2, 0xb3b3b8f6, 0x5ff4f9ed,
+  0x8974920c, 0x58a85bee, 0x77e71d4a, 0xdc5e42f7,
+  0x4a761f22, 0xcf4ae237, 0xeb770612, 0x35b590c9,
+  0xb1e7e7ea, 0xa87683a1, 0x51fdcc68, 0x0219b2df,
+  0x8bf903b6, 0x78f82126, 0x900fc39a, 0x50c635af,
+  0x40904a36, 0x9e359999, 0x857ff6ed, 0x58a36d1c,
+  0xc27e684f, 0x8f2c3d58, 0xce834ab9, 0x71c450f0,
+  0x409151ae, 0xb448099c, 0xc0295ae8, 0xbf8e23a7,
+  0xfc03e7d5, 0x9c993cbf, 0x2770bc32, 0x466c203f,
+  0x7fbf396e, 0xa440e683, 0x3ee0572a, 0xbd5b9ab5,
+  0xb9996f4e, 0x59a65049, 0xa54e9c1e, 0xe934be99,
+  0x527426fc, 0xba5948c0, 0xdf21f8d0, 0x9ca6e82c,
+  0x6ce0c418, 0x779af57d, 0x71fcb6a1, 0x089be998,
+  0x7fcd96b9, 0xd778718c, 0x84243951, 0x5b32fe6f,
+  0x57933c29, 0xf818d7c9, 0xe8ca0859, 0xb2e4c741,
+  0x45b5b634, 0x7a4d9978, 0xd18c9b5a, 0x5e56e9d7,
+  0xc69446b6, 0xbf6181e8, 0x063b85a5, 0xa41d2a46,
+  0x6b937854, 0x69b64c81, 0x61f6124a, 0x406619e6,
+  0x513c3980, 0x7ccc5f47, 0xc2e89c82, 0xac60883b,
+  0x12b556d2, 0xe9e9a4f4, 0x1f652384, 0xba13bc4a,
+  0xb0cc9626, 0x26f97c43, 0xe4a6da4c, 0xbc265efd,
+  0x31ea5943, 0x08421957, 0xf6fb6750, 0xfc8b1fc2,
+  0xbe149f4a, 0xd0db7821, 0xb7759108, 0x8463b1d2,
+  0x585dda41, 0x91e711bb, 0xec4331dc, 0x17dba0c5,
+  0x65d38888, 0xd9926c58, 0x621b33b9, 0xfd660d78,
+  0x9abd22ef, 0x32d7758b, 0x474b41c7, 0xde8a2c08,
+  0x0654f990, 0xfae1b815, 0x4ab150ad, 0xa7ae1702,
+  0xcc8ed9c1, 0x3b453184, 0xc8e69152, 0xa1b40f14,
+  0x1a6a36c3, 0x2c3ad745, 0x8f96140f, 0x1075e44b,
+  0x7f001bbe, 0x2b4aa341, 0xc6ad5d8e, 0xebd108a3,
+  0x8978c9d3, 0x89256489, 0xef5db606, 0x6ed6214d,
+  0xc5c19a32, 0x431ff749, 0x1cbc497b, 0xcaf42161,
+  0x021e705b, 0x3a0f2b8e, 0xf5c63e7a, 0xfc8aff8d,
+  0x37f83d18, 0x7c2869ce, 0xe48eebbb, 0x0ee7c335,
+  0xd65db691, 0x127b8f1e, 0x10407340, 0x0000aeb8};
+
+static const BcpTest_Golden lteDlGoldenPkt1 = {12600, 2, 4, lteDlGoldenPkt1_dict, lteDlGoldenPkt1_idx};
+#endif
 
-/** ============================================================================
- *   @n@b read_test_config
- *
- *   @b Description
- *   @n Utility function that reads the input test vector params from a given
- *      file.
- *
- *   @param[in]  
- *   @n fp              Test configuration file handle.
- * 
- *   @return        
- *   @n None.
- * =============================================================================
+#ifdef LTE_DL_MOD_COMPRESSED
+/* Compressed modulator output of a packet gathered from the Rx descriptors,
+ * sized for up to 8 bits per symbol.
  */
-static Void read_test_config(FILE* fp)
-{
-	Char            lineBuf[300];
-	Char*           ptrBuf;
-	Int32           i;
-	
-    while (fgets (lineBuf, 300, fp) != NULL)
-	{
-        if ((ptrBuf = strstr(lineBuf, "="))!=NULL)
-		{
-			ptrBuf ++;
-			if (strstr(lineBuf,"TBS")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				tbSize = i;
-				continue;
-			}
-		
-			if (strstr(lineBuf,"UeCat")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				ueCategory = (UInt8) i;
-				continue;
+#define LTE_DL_OUTPUT_PKT_1_PACKED_WRD_SIZE  (LTE_DL_OUTPUT_PKT_1_WRD_SIZE / 4)
 
-			}
+#pragma DATA_SECTION (lte_dl_rx_packed, ".testData");
+#pragma DATA_ALIGN (lte_dl_rx_packed, 8)
+static UInt32 lte_dl_rx_packed[LTE_DL_OUTPUT_PKT_1_PACKED_WRD_SIZE];
 
-			if (strstr(lineBuf,"UeTM")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				ueTransMode = (UInt8) i;
-				continue;
+/* Number of symbols expanded at a time during validation */
+#define LTE_DL_EXPAND_BLK_SIZE               64
+#endif
 
-			}
+/* Volatile fields of the DL header chain template */
+#define LTE_DL_HDR_FIELD_CINIT               0
+#define LTE_DL_HDR_FIELD_RV_COL1             1
+#define LTE_DL_HDR_FIELD_RV_COL2             2
+#define LTE_DL_HDR_FIELD_FLOW_ID             3
+#define LTE_DL_HDR_NUM_FIELDS                4
 
-			if (strstr(lineBuf,"MaxNumHarqProcess")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				maxNumHarqProcess = (UInt8) i;
-				continue;
+#pragma DATA_SECTION (lteDlHdrFieldWidth, ".testData");
+static const UInt8 lteDlHdrFieldWidth[LTE_DL_HDR_NUM_FIELDS] = {31, 6, 6, 8};
 
-			}
+/* Header template auxData: RV start columns of each RV, column 1 in the low
+ * half word and column 2 in the high one, then the byte offset of the PS 
+ * words.
+ */
+#define LTE_DL_HDR_AUX_RV_COLS               0
+#define LTE_DL_HDR_AUX_PS_OFFSET             4
 
-			if (strstr(lineBuf,"Nir")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				Nir = i;
-				continue;
-			}
+/* Byte offset of the PS words in the last header chain built */
+#pragma DATA_SECTION (lteDlHdrPsOffset, ".testData");
+static UInt32 lteDlHdrPsOffset;
 
+/* Header templates are written to LTE_DL_HDR_BLOB_FILE with LTE_DL_HDR_EXPORT
+ * defined; a build with LTE_DL_HDR_BLOBS defined links that file and loads
+ * its templates instead of building them.
+ */
+#define LTE_DL_HDR_BLOB_FILE                 "..\\..\\lte\\lte_dl_hdr_blobs.c"
 
-			if (strstr(lineBuf,"G")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numBitsG = i;
-				continue;
-			}
+/* Transport block of the test grant */
+#pragma DATA_SECTION (lteDlPayload, ".testData");
+#pragma DATA_ALIGN (lteDlPayload, 16)
+static UInt8 lteDlPayload[TX_DATA_BUFFER_SIZE];
 
-			if (strstr(lineBuf,"RV")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				rvIdx = (UInt8) i;
-				continue;
-			}
+#ifdef BCP_TEST_BIN_VECTORS
+/* With BCP_TEST_BIN_VECTORS defined the transport block is loaded from its
+ * binary test vector, converted by tools/vec_conv.c, and sent in place.
+ */
+#define LTE_DL_VEC_INFO_BITS                 "..\\..\\lte\\pdsch_inforBits_0002.bvec"
 
-			if (strstr(lineBuf,"RNTI")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				rnti = (UInt16) i;
-				continue;
-			}
+#pragma DATA_SECTION (lteDlPayloadVec, ".testData");
+static BcpTest_Vec lteDlPayloadVec;
+#endif
 
-			if (strstr(lineBuf,"CodeWord")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				codeWordIdx = (UInt8) i;
-				continue;
-			}
+#ifdef LTE_DL_VEC_STREAM
+/* With LTE_DL_VEC_STREAM defined the transport block of each packet is
+ * streamed from a binary test vector of one transport block per packet, read
+ * ahead of the packet builds by a vector stream, e.g. for
+ * BCP_TEST_NUM_PACKETS = 10:
+ *
+ *   for i in $(seq 10); do cat lte/pdsch_inforBits_0002.dat; done > lte/pdsch_inforBits_stream.dat
+ *   vec_conv lte/pdsch_inforBits_stream.dat
+ *
+ * Each record is linked to its packet in place and handed back to the stream
+ * once the packet is received. The output is still checked against that of
+ * the test grant, so the records must all be its transport block.
+ */
+#ifdef USE_CRC_FUNCTION
+#error "LTE_DL_VEC_STREAM: no software CRC is appended to the transport blocks streamed"
+#endif
+#define LTE_DL_VEC_STREAM_FILE               "..\\..\\lte\\pdsch_inforBits_stream.bvec"
 
-			if (strstr(lineBuf,"ns")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				ns = (UInt8) i;
-				continue;
-			}
+/* Records read ahead, beyond those linked to the packets in flight */
+#define LTE_DL_VEC_STREAM_BUFS               (TX_NUM_DESC + 2)
 
-			if (strstr(lineBuf,"CellID")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				cellID = (UInt16) i;
-				continue;
-			}
+#pragma DATA_SECTION (lteDlTbStream, ".testData");
+static BcpTest_VecStream* lteDlTbStream;
+#endif
 
-			if (strstr(lineBuf,"Modulation")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				modulation = (UInt8) i;
-				continue;
-			}
+#ifdef LTE_DL_HDR_BLOBS
+extern const BcpTest_HdrBlob lteDlHdrBlobs[];
+extern const UInt32 lteDlHdrBlobs_count;
+#endif
 
-			if (strstr(lineBuf,"NumLayers")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numLayers = (UInt8) i;
-				continue;
+/* Test configuration parameters. The slot number is given as the range of
+ * slots of the subframe, of which the first is used.
+ */
+#pragma DATA_SECTION (nsRange, ".testData");
+static BcpTest_ParamRange   nsRange;
 
-			}
-		}
-	}
+#pragma DATA_SECTION (lteDlParams, ".testData");
+static const BcpTest_ParamDesc lteDlParams[] = 
+{
+    {"TBS",                 BcpTest_ParamType_UInt32,   &tbSize,            1,  391656},
+    {"UeCat",               BcpTest_ParamType_UInt8,    &ueCategory,        1,  8},
+    {"UeTM",                BcpTest_ParamType_UInt8,    &ueTransMode,       1,  9},
+    {"MaxNumHarqProcess",   BcpTest_ParamType_UInt8,    &maxNumHarqProcess, 1,  15},
+    {"Nir",                 BcpTest_ParamType_UInt32,   &Nir,               0,  0x7FFFFFFF},
+    {"G",                   BcpTest_ParamType_UInt32,   &numBitsG,          0,  0x7FFFFFFF},
+    {"RV",                  BcpTest_ParamType_UInt8,    &rvIdx,             0,  3},
+    {"RNTI",                BcpTest_ParamType_UInt16,   &rnti,              0,  0xFFFF},
+    {"CodeWord",            BcpTest_ParamType_UInt8,    &codeWordIdx,       0,  1},
+    {"ns",                  BcpTest_ParamType_Range,    &nsRange,           0,  19},
+    {"CellID",              BcpTest_ParamType_UInt16,   &cellID,            0,  503},
+    {"Modulation",          BcpTest_ParamType_UInt8,    &modulation,        1,  8},
+    {"NumLayers",           BcpTest_ParamType_UInt8,    &numLayers,         1,  LTE_MAX_NUM_LAYERS}
+};
+
+#pragma DATA_SECTION (lteDlParamSchema, ".testData");
+static BcpTest_ParamSchema  lteDlParamSchema;
 
-    return;
+/** ============================================================================
+ *   @n@b read_test_config
+ *
+ *   @b Description
+ *   @n Utility function that reads the input test vector params from a given
+ *      file.
+ *
+ *   @param[in]  
+ *   @n fp              Test configuration file handle.
+ * 
+ *   @return        Int32
+ *   @n 0       -   Test configuration read.
+ *
+ *   @n -1      -   Malformed or out of range parameter.
+ * =============================================================================
+ */
+static Int32 read_test_config(FILE* fp)
+{
+    if (lteDlParamSchema.numParams == 0 &&
+        param_schema_init (&lteDlParamSchema, lteDlParams, sizeof (lteDlParams) / sizeof (lteDlParams[0])) < 0)
+        return -1;
+
+    nsRange.first   =   ns;
+    nsRange.last    =   ns;
+    if (param_parse_file (&lteDlParamSchema, fp) < 0)
+        return -1;
+    ns              =   (UInt8) nsRange.first;
+
+    return 0;
 }
 
 /** ============================================================================
@@ -4132,14 +1290,7 @@ static Void prepare_modhdr_cfg
     {
         if (operationMode == 0) // uncompressed mode hard modulator
         {
-            if (mod == 1 || mod == 2) // BPSK
-                pModHdrCfg->uva_val =   (rms * 23170 + 0x4000) >> 15;        
-            else if (mod == 4) //16 QAM
-                pModHdrCfg->uva_val =   (rms * 10362 + 0x4000) >> 15;        
-            else if (mod == 6) //64 QAM 
-                pModHdrCfg->uva_val =   (rms * 5056 + 0x4000) >> 15;        
-            else //256 QAM
-                pModHdrCfg->uva_val =   (rms * 2513 + 0x4000) >> 15;
+            pModHdrCfg->uva_val =   lte_mod_hard_uva (mod, rms);
         }
         else //compressed mode hard modulator
         {
@@ -4192,7 +1343,8 @@ static Void prepare_modhdr_cfg
  *   @n@b prepare_tmhdr_cfg
  *
  *   @b Description
- *   @n Sets up the Traffic Manager header for the test. 
+ *   @n Sets up the Traffic Manager header for the test. Every packet carries
+ *      the PS words of its metadata, see @a pkt_meta_submit ().
  *
  *   @param[out]  
  *   @n pTmHdrCfg   TM Header configuration thus populated for the test.
@@ -4203,79 +1355,115 @@ static Void prepare_modhdr_cfg
  */
 static Void prepare_tmhdr_cfg (Bcp_TmHdrCfg* pTmHdrCfg)
 {
-    pTmHdrCfg->ps_data_size     =   0;
+    pTmHdrCfg->ps_data_size     =   BCP_TEST_PKT_META_PS_WORDS;
     pTmHdrCfg->info_data_size   =   0;
 
     return;
 }
 
 /** ============================================================================
- *   @n@b add_test_config_data
+ *   @n@b prepare_dl_hdr_cfgs
  *
  *   @b Description
- *   @n Given a data buffer, this API sets up the packet contents for the test.
- *      It adds all the BCP configuration params (header) and the payload to the 
- *      data buffer. On success, returns the number of bytes of configuration 
- *      and payload data added to the data buffer passed. 
+ *   @n Sets up the configuration of the CRC, encoder, rate matching and
+ *      modulator headers of the DL test from the test configuration. Without
+ *      a CRC module header, with USE_CRC_FUNCTION defined, the CRC header
+ *      configuration is cleared.
  *
  *   @param[in]  
- *   @n hBcp        BCP driver handle
+ *   @n pCodeBlkParams  Code block parameters.
+ *
+ *   @param[in]  
+ *   @n pFieldVal       Volatile field values, indexed by LTE_DL_HDR_FIELD_*.
+ *
+ *   @param[out]  
+ *   @n pChainCfg       Header configurations.
+ * 
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+static Void prepare_dl_hdr_cfgs 
+(
+    BcpTest_LteCBParams*        pCodeBlkParams, 
+    const UInt32*               pFieldVal, 
+    BcpTest_LteRefChainCfg*     pChainCfg
+)
+{
+    BcpTest_RateMatchParams     rmParams;
+
+#ifdef USE_CRC_FUNCTION
+    memset (&pChainCfg->crc, 0, sizeof (Bcp_CrcHdrCfg));
+#else
+    prepare_crchdr_cfg (&pChainCfg->crc, Bcp_RadioStd_LTE, tbSize, pCodeBlkParams->numFillerBits, 0, 0, 0, 0, 0, 0, 0, NULL);
+#endif
+
+    prepare_lte_enchdr_cfg (&pChainCfg->enc, Bcp_RadioStd_LTE, LTE_PDSCH, pCodeBlkParams);
+
+    compute_rmGamma_ref (numBitsG,
+                         modulation,
+                         numLayers,
+                         pCodeBlkParams,
+                         rvIdx,
+                         0, //ratio is 0
+                         0,
+                         Nir,
+                         LTE_PDSCH,
+                         &rmParams);
+    prepare_lte_rmhdr_cfg (&pChainCfg->lteRm, LTE_PDSCH, pCodeBlkParams, &rmParams);
+    pChainCfg->lteRm.rv_start_column1   =   pFieldVal [LTE_DL_HDR_FIELD_RV_COL1];
+    pChainCfg->lteRm.rv_start_column2   =   pFieldVal [LTE_DL_HDR_FIELD_RV_COL2];
+
+    prepare_modhdr_cfg (&pChainCfg->mod, 
+                        Bcp_RadioStd_LTE, 
+				        0, // number of subcarrier, not used,
+				        modulation,
+				        LTE_DL_MOD_OPERATION_MODE,
+				        LTE_DL_MOD_RMS,
+				        0, //numOFDMsymPerSubfrm, not used
+				        0, //numCqiSubcs
+				        0, //numRiSubcs
+				        0, //numAckSubcs
+				        pFieldVal [LTE_DL_HDR_FIELD_CINIT],
+				        0); //qformat
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b add_dl_headers
+ *
+ *   @b Description
+ *   @n Adds the BCP header chain of the DL test to a data buffer, padded to
+ *      128 bits. Matches @a BcpTest_HdrBuildFxn so that it also serves as
+ *      the header template builder.
+ *
+ *   @param[in]  
+ *   @n pArg        Code block parameters, BcpTest_LteCBParams*.
  *
  *   @param[in]  
- *   @n pDataBuffer Data Buffer handle to which the payload and BCP configuration
- *                  params need to be added.
+ *   @n pFieldVal   Volatile field values, indexed by LTE_DL_HDR_FIELD_*.
+ *
+ *   @param[in]  
+ *   @n pDataBuffer Data Buffer handle to which the headers need to be added.
  * 
  *   @return        Int32
- *   @n >0      -   Number of bytes of data (payload + header configuration) added 
- *                  to the data buffer.
+ *   @n >0      -   Number of bytes of headers added to the data buffer.
  *
  *   @n -1      -   Error populating the data buffer.
  * =============================================================================
  */
-static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
+static Int32 add_dl_headers (Void* pArg, const UInt32* pFieldVal, UInt8* pDataBuffer)
 {
-	FILE*                       pTestCfgFile;
+    BcpTest_LteCBParams*        pCodeBlkParams = (BcpTest_LteCBParams *) pArg;
     UInt32                      dataBufferLen, tmpLen;
-    BcpTest_LteCBParams         codeBlkParams;
-    UInt32                      lteChanType, cInit;
     Bcp_RadioStd                radioStd;
     Bcp_GlobalHdrCfg            bcpGlblHdrCfg;
-    Bcp_CrcHdrCfg               crcHdrCfg;
-    Bcp_EncHdrCfg               encHdrCfg;
-    BcpTest_RateMatchParams     rmParams;
-    Bcp_RmHdr_LteCfg            lteRmHdrCfg;
-    Bcp_ModHdrCfg               modHdrCfg;
+    BcpTest_LteRefChainCfg      chainCfg;
     Bcp_TmHdrCfg                tmHdrCfg;
     UInt8*  					pStartDataBuffer;
-#ifdef USE_CRC_FUNCTION
-    UInt8*  					pDataBufferPayload;
-    UInt32						crcBits;
-    UInt32						i;
-    UInt8*						tempBuf;
-#endif
-
-    /* Get the test configuration from the file. */
-    if ((pTestCfgFile = fopen("..\\..\\lte\\pdsch_parameters_DV021.dat","r")) == NULL)
-    {
-#ifdef BCP_TEST_DEBUG            
-        Bcp_osalLog ("Failed to open test configuration file: ..\..\lte\pdsch_parameters_DV021.dat\n");
-#endif
-        return -1;
-    }
-#ifdef BCP_TEST_DEBUG            
-    Bcp_osalLog ("Reading test configuration ... \n");
-#endif
-    read_test_config(pTestCfgFile);
-    fclose (pTestCfgFile);
-
-    /* Get the code block params */
-    compute_cbparams_ref (tbSize, &codeBlkParams);
 
-    /* To begin with, lets test LTE PSDCH channel */
     radioStd    =   Bcp_RadioStd_LTE; 
-    lteChanType =   LTE_PDSCH;
-    
-    /* Start adding BCP Packet headers based on the test configuration we read. */
 
     /* Initialize our data buffer length running counter */
     dataBufferLen   =   0;
@@ -4286,10 +1474,12 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     pDataBuffer 	+=	8;
     dataBufferLen	+=	8;
 
+    /* Configuration of headers 2 - 5 */
+    prepare_dl_hdr_cfgs (pCodeBlkParams, pFieldVal, &chainCfg);
+
     /* Header 2: CRC Header */
-    prepare_crchdr_cfg (&crcHdrCfg, radioStd, tbSize, codeBlkParams.numFillerBits, 0, 0, 0, 0, 0, 0, 0, NULL);
 #ifndef USE_CRC_FUNCTION
-    if (Bcp_addCRCHeader (&crcHdrCfg, pDataBuffer, &tmpLen) < 0)
+    if (Bcp_addCRCHeader (&chainCfg.crc, pDataBuffer, &tmpLen) < 0)
     {
 #ifdef BCP_TEST_DEBUG            
         Bcp_osalLog ("Failed to add CRC Header to packet \n");
@@ -4302,8 +1492,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 #endif
 
     /* Header 3: Encoder Header */
-    prepare_lte_enchdr_cfg (&encHdrCfg, radioStd, lteChanType, &codeBlkParams);
-    if (Bcp_addEncoderHeader (&encHdrCfg, pDataBuffer, &tmpLen) < 0)
+    if (Bcp_addEncoderHeader (&chainCfg.enc, pDataBuffer, &tmpLen) < 0)
     {
 #ifdef BCP_TEST_DEBUG            
         Bcp_osalLog ("Failed to add Encoder Header to packet \n");            
@@ -4315,18 +1504,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     tmpLen			=	0;
 
     /* Header 4: Rate matching header */
-    compute_rmGamma_ref (numBitsG,
-                         modulation,
-                         numLayers, //assumed 1 layer
-                         &codeBlkParams,
-                         rvIdx,
-                         0, //ratio is 0
-                         0,
-                         Nir,
-                         lteChanType,
-                         &rmParams);
-    prepare_lte_rmhdr_cfg (&lteRmHdrCfg, lteChanType, &codeBlkParams, &rmParams);
-    if (Bcp_addLte_RMHeader (&lteRmHdrCfg, pDataBuffer, &tmpLen) < 0)
+    if (Bcp_addLte_RMHeader (&chainCfg.lteRm, pDataBuffer, &tmpLen) < 0)
     {
 #ifdef BCP_TEST_DEBUG            
         Bcp_osalLog ("Failed to add lte rate modulation header to packet \n");            
@@ -4338,20 +1516,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     tmpLen			=	0;
 
     /* Header 5: Modulation header */
-    cInit = rnti * (1<<14) + codeWordIdx * (1<<13) + ns/2  * (1<<9) + cellID;
-    prepare_modhdr_cfg (&modHdrCfg, 
-                        radioStd, 
-				        0, // number of subcarrier, not used,
-				        modulation,
-				        0, //uncompressed mode
-				        1024,//rms
-				        0, //numOFDMsymPerSubfrm, not used
-				        0, //numCqiSubcs
-				        0, //numRiSubcs
-				        0, //numAckSubcs
-				        cInit,
-				        0); //qformat
-    if (Bcp_addModulatorHeader (&modHdrCfg, pDataBuffer, &tmpLen) < 0)
+    if (Bcp_addModulatorHeader (&chainCfg.mod, pDataBuffer, &tmpLen) < 0)
     {
 #ifdef BCP_TEST_DEBUG            
         Bcp_osalLog ("Failed to add Modulation header to packet \n");            
@@ -4375,6 +1540,12 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     dataBufferLen	+=	tmpLen;
     tmpLen			=	0;
 
+    /* PS words, cleared. The packet metadata is stored over them. */
+    lteDlHdrPsOffset    =   dataBufferLen;
+    memset (pDataBuffer, 0, BCP_TEST_PKT_META_PS_WORDS * 4);
+    pDataBuffer 	+=	BCP_TEST_PKT_META_PS_WORDS * 4;
+    dataBufferLen	+=	BCP_TEST_PKT_META_PS_WORDS * 4;
+
     /* Header 1: Global Header */
     bcpGlblHdrCfg.pkt_type          =   Bcp_PacketType_Normal;
     bcpGlblHdrCfg.flush             =   0;
@@ -4382,7 +1553,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     bcpGlblHdrCfg.halt              =   0;
     bcpGlblHdrCfg.radio_standard    =   radioStd;
     bcpGlblHdrCfg.hdr_end_ptr       =   ((dataBufferLen + 3) >> 2); // Num Words
-    bcpGlblHdrCfg.flow_id           =   RX_FLOW_ID;
+    bcpGlblHdrCfg.flow_id           =   pFieldVal [LTE_DL_HDR_FIELD_FLOW_ID];
     bcpGlblHdrCfg.destn_tag         =   0xDEAD;
     if (Bcp_addGlobalHeader (&bcpGlblHdrCfg, pStartDataBuffer, &tmpLen) < 0)
     {
@@ -4392,21 +1563,81 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
         return -1;
     }
 
-    /* No Info words/PS to be added for now */
-
 	/* Check and Add padding to align data on 128 bits (16 bytes) */
     tmpLen = (dataBufferLen % 16)? (16 - (dataBufferLen % 16)): 0;
 
 	/* Add padding to align data on 128 bits */
-    pDataBuffer 	+=	tmpLen;
     dataBufferLen	+=	tmpLen;
 
+    return dataBufferLen;
+}
+
+/** ============================================================================
+ *   @n@b read_test_grant
+ *
+ *   @b Description
+ *   @n Reads the test configuration and transport block from the test vector
+ *      files into a grant. The transport block is read into lteDlPayload, or
+ *      used in place from its binary test vector when there is no CRC to 
+ *      append to it.
+ *
+ *   @param[out]  
+ *   @n pGrant      Grant of the test configuration.
+ * 
+ *   @return        Int32
+ *   @n 0       -   Grant read.
+ *
+ *   @n -1      -   Error reading the test vectors.
+ * =============================================================================
+ */
+static Int32 read_test_grant (BcpTest_LteDlGrant* pGrant)
+{
+	FILE*                       pTestCfgFile;
+    UInt32                      dataBufferLen;
+    const UInt8*                pPayload;
 #ifdef USE_CRC_FUNCTION
-    /* Save payload start */
-    pDataBufferPayload = pDataBuffer;
+    UInt32						crcBits;
+    UInt32						i;
+    UInt8*						tempBuf;
+#endif
+
+    /* Get the test configuration from the file. */
+    if ((pTestCfgFile = fopen("..\\..\\lte\\pdsch_parameters_DV021.dat","r")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Failed to open test configuration file: ..\..\lte\pdsch_parameters_DV021.dat\n");
+#endif
+        return -1;
+    }
+#ifdef BCP_TEST_DEBUG            
+    Bcp_osalLog ("Reading test configuration ... \n");
+#endif
+    numLayers = 1;
+    if (read_test_config(pTestCfgFile) < 0)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Invalid test configuration: ..\..\lte\pdsch_parameters_DV021.dat\n");
 #endif
+        fclose (pTestCfgFile);
+        return -1;
+    }
+    fclose (pTestCfgFile);
 
-    /* Finally add the data to the packet in the same order as the headers */
+    /* Transport block */
+#ifdef BCP_TEST_BIN_VECTORS
+    if (vec_load (LTE_DL_VEC_INFO_BITS, &lteDlPayloadVec) < 0)
+        return -1;
+    dataBufferLen   =   lteDlPayloadVec.numWords * 4;
+#ifdef USE_CRC_FUNCTION
+    /* The CRC is appended to a copy */
+    if (dataBufferLen + 4 > sizeof (lteDlPayload))
+        return -1;
+    memcpy (lteDlPayload, lteDlPayloadVec.pWords, dataBufferLen);
+    pPayload        =   lteDlPayload;
+#else
+    pPayload        =   (const UInt8 *) lteDlPayloadVec.pWords;
+#endif
+#else
     if ((pTestCfgFile = fopen("..\\..\\lte\\pdsch_inforBits_0002.dat","r")) == NULL)
     {
 #ifdef BCP_TEST_DEBUG            
@@ -4414,8 +1645,11 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 #endif
         return -1;
     }
-    read_data_from_file (pTestCfgFile, pDataBuffer, &dataBufferLen);
+    dataBufferLen   =   0;
+    read_data_from_file (pTestCfgFile, lteDlPayload, &dataBufferLen);
     fclose (pTestCfgFile);
+    pPayload        =   lteDlPayload;
+#endif
 
 #ifdef USE_CRC_FUNCTION
     /* Allocate Temp Buffer */
@@ -4423,7 +1657,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 
     /* Re-order bits as expected by CRC function */
     for (i=0;i<tbSize/8;i++)
-    	tempBuf[i] = _extu(_bitr(pDataBufferPayload[i]), 0, 24);
+    	tempBuf[i] = _extu(_bitr(lteDlPayload[i]), 0, 24);
 
     crcBits = bcp_crcCodecC64pByte (tempBuf,
     								tbSize,
@@ -4433,59 +1667,537 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 
     /* Re-order bits as expected by BCP and then append */
     for (i=0;i<3;i++)
-    	pDataBufferPayload[tbSize/8 + i] = _extu(_bitr(((crcBits >> ((3-1-i)*8)) & 0xFF)), 0, 24);
+    	lteDlPayload[tbSize/8 + i] = _extu(_bitr(((crcBits >> ((3-1-i)*8)) & 0xFF)), 0, 24);
 
     /* Free Temp Buffer */
     Bcp_osalFree ((uint8_t *) tempBuf, tbSize/8, TRUE);
 #endif
 
-    /* Successfully read the test configuration */        
-    return dataBufferLen;
+    pGrant->tbSize      =   tbSize;
+    pGrant->numBitsG    =   numBitsG;
+    pGrant->Nir         =   Nir;
+    pGrant->rnti        =   rnti;
+    pGrant->cellID      =   cellID;
+    pGrant->modulation  =   modulation;
+    pGrant->numLayers   =   numLayers;
+    pGrant->rvIdx       =   rvIdx;
+    pGrant->codeWordIdx =   codeWordIdx;
+    pGrant->ns          =   ns;
+    pGrant->flowId      =   RX_FLOW_ID;
+    pGrant->harqProcId  =   0;
+    pGrant->tti         =   0;
+    pGrant->pPayload    =   pPayload;
+    pGrant->payloadLen  =   dataBufferLen;
+
+    return 0;
 }
 
 /** ============================================================================
- *   @n@b test_lte_dl
+ *   @n@b add_dl_grant
  *
  *   @b Description
- *   @n Sets up the parameters required and runs an LTE Downlink (DL) test case.
+ *   @n Given a data buffer, this API sets up the BCP configuration params 
+ *      (header) of a grant in it, padded to 16 bytes. On success, returns the
+ *      number of bytes of configuration data added to the data buffer passed.
+ *      The payload is added by the caller, either copied after the headers or
+ *      in a descriptor linked to the header descriptor.
+ *
+ *      The headers are copied from the cached header template of the grant
+ *      configuration, with the per packet fields stored over it. The
+ *      template of the previous grant is reused without a lookup when the
+ *      configuration is the same, and the code block and rate matching
+ *      parameters are only computed to build a new template.
  *
  *   @param[in]  
- *   @n hBcp        BCP driver handle
+ *   @n pGrant      Grant to build the packet of.
+ *
+ *   @param[in,out]  
+ *   @n ppHdrTmpl   Template of the previous grant, or NULL. Set to the
+ *                  template of this grant.
  *
  *   @param[in]  
- *   @n hGlblFDQ    Global free descriptor queue handle. The test will allocate all its
- *                  free descriptors from this queue for its run and release them
- *                  back once done to this queue.
+ *   @n pPsWords    PS words of the packet metadata, or NULL to leave them 0.
+ *
+ *   @param[in]  
+ *   @n pDataBuffer Data Buffer handle to which the BCP configuration params 
+ *                  need to be added, at least TX_HDR_BUFFER_SIZE bytes.
  * 
- *   @return
- *   @n None
+ *   @return        Int32
+ *   @n >0      -   Number of bytes of header configuration added to the data 
+ *                  buffer.
  *
+ *   @n -1      -   Error populating the data buffer.
  * =============================================================================
  */
-Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
+static Int32 add_dl_grant 
+(
+    const BcpTest_LteDlGrant*   pGrant, 
+    BcpTest_HdrTmpl**           ppHdrTmpl,
+    const UInt32*               pPsWords,
+    UInt8*                      pDataBuffer
+)
 {
-    Bcp_TxCfg           txCfg;
-    Bcp_TxHandle        hTx = NULL;
-    Bcp_RxCfg           rxCfg;
-    Bcp_RxHandle        hRx = NULL;
-    Qmss_QueueHnd       hTxFDQ, hRxFDQ;
-    UInt8               rxFlowId, rxSrcId;
-    UInt32              i, testFail = 0, numTestPkts;
-    UInt32              dataBufferLen, rxDataBufferLen, rxPsInfoLen, rxDataTotalLen, key;
-    UInt16              rxDestnTag;
-    Cppi_Desc*          pCppiDesc;
-    UInt8*              pDataBuffer;
-    UInt8*              pRxDataBuffer;
-    UInt8*              pRxPsInfo;
+    BcpTest_HdrTmpl*            pHdrTmpl = *ppHdrTmpl;
+    BcpTest_LteCBParams         codeBlkParams;
+    BcpTest_RateMatchParams     rmParams;
+    UInt32                      tmplKey [4];
+    UInt32                      fieldVal [LTE_DL_HDR_NUM_FIELDS];
+    UInt32                      rv, psOffset;
+    Int32                       hdrLen;
+
+    /* Header chain template of this configuration. Only cinit, the RV
+     * start columns and the flow id change from packet to packet.
+     */
+    tmplKey [0] =   pGrant->tbSize;
+    tmplKey [1] =   pGrant->numBitsG;
+    tmplKey [2] =   pGrant->Nir;
+    tmplKey [3] =   pGrant->modulation | (pGrant->numLayers << 8);
+    if (pHdrTmpl == NULL || pHdrTmpl->state != BCP_TEST_HDR_TMPL_READY || 
+        pHdrTmpl->keyLen != 4 || memcmp (pHdrTmpl->key, tmplKey, sizeof (tmplKey)) != 0)
+    {
+        if ((pHdrTmpl = hdr_tmpl_lookup (tmplKey, 4)) == NULL)
+            return -1;
+        *ppHdrTmpl  =   pHdrTmpl;
+    }
+
+    /* Get the code block params, not needed with a ready template. The
+     * header setup takes the configuration from the test globals.
+     */
+    if (pHdrTmpl->state != BCP_TEST_HDR_TMPL_READY)
+    {
+        tbSize      =   pGrant->tbSize;
+        numBitsG    =   pGrant->numBitsG;
+        Nir         =   pGrant->Nir;
+        modulation  =   pGrant->modulation;
+        numLayers   =   pGrant->numLayers;
+        rvIdx       =   pGrant->rvIdx;
+        compute_cbparams_ref (tbSize, &codeBlkParams);
+    }
+
+    if (pHdrTmpl->state == BCP_TEST_HDR_TMPL_EMPTY)
+    {
+        /* RV start columns of all 4 RVs, as set up by prepare_lte_rmhdr_cfg () */
+        for (rv = 0; rv < 4; rv ++)
+        {
+            compute_rmGamma_ref (numBitsG, modulation, numLayers, &codeBlkParams, rv, 0, 0, Nir, LTE_PDSCH, &rmParams);
+            if (codeBlkParams.numCodeBksKm == 0)
+                pHdrTmpl->auxData [LTE_DL_HDR_AUX_RV_COLS + rv] =   rmParams.rvKp;
+            else
+                pHdrTmpl->auxData [LTE_DL_HDR_AUX_RV_COLS + rv] =   rmParams.rvKm | (rmParams.rvKp << 16);
+        }
+    }
+
+    fieldVal [LTE_DL_HDR_FIELD_CINIT]   =   pGrant->rnti * (1<<14) + pGrant->codeWordIdx * (1<<13) + 
+                                            pGrant->ns/2  * (1<<9) + pGrant->cellID;
+    fieldVal [LTE_DL_HDR_FIELD_RV_COL1] =   pHdrTmpl->auxData [LTE_DL_HDR_AUX_RV_COLS + (pGrant->rvIdx & 3)] & 0xFFFF;
+    fieldVal [LTE_DL_HDR_FIELD_RV_COL2] =   pHdrTmpl->auxData [LTE_DL_HDR_AUX_RV_COLS + (pGrant->rvIdx & 3)] >> 16;
+    fieldVal [LTE_DL_HDR_FIELD_FLOW_ID] =   pGrant->flowId;
+
+    if (pHdrTmpl->state == BCP_TEST_HDR_TMPL_EMPTY)
+    {
+        hdr_tmpl_create (pHdrTmpl, add_dl_headers, &codeBlkParams, LTE_DL_HDR_NUM_FIELDS,
+                         fieldVal, lteDlHdrFieldWidth);
+        pHdrTmpl->auxData [LTE_DL_HDR_AUX_PS_OFFSET]    =   lteDlHdrPsOffset;
+    }
+
+    /* Headers from the template, or built in full if its fields could not
+     * be located. Only the header area is cleared for the alignment padding,
+     * the template already carries it.
+     */
+    if (pHdrTmpl->state == BCP_TEST_HDR_TMPL_READY)
+    {
+        hdrLen      =   hdr_tmpl_apply (pHdrTmpl, fieldVal, pDataBuffer);
+        psOffset    =   pHdrTmpl->auxData [LTE_DL_HDR_AUX_PS_OFFSET];
+    }
+    else
+    {
+        memset (pDataBuffer, 0, TX_HDR_BUFFER_SIZE);
+        if ((hdrLen = add_dl_headers (&codeBlkParams, fieldVal, pDataBuffer)) < 0)
+            return -1;
+        psOffset    =   lteDlHdrPsOffset;
+    }
+
+    /* Packet metadata */
+    if (pPsWords != NULL)
+        memcpy (pDataBuffer + psOffset, pPsWords, BCP_TEST_PKT_META_PS_WORDS * 4);
+
+    return hdrLen;
+}
+
+#ifdef LTE_DL_REF_MODEL
+/** ============================================================================
+ *   @n@b prepare_dl_ref_chain
+ *
+ *   @b Description
+ *   @n Sets up the DL chain model configuration of a grant, the header
+ *      configurations @a add_dl_grant () builds its packet with.
+ *
+ *   @param[in]  
+ *   @n pGrant      Grant.
+ *
+ *   @param[out]  
+ *   @n pChainCfg   DL chain model configuration.
+ * 
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+static Void prepare_dl_ref_chain (const BcpTest_LteDlGrant* pGrant, BcpTest_LteRefChainCfg* pChainCfg)
+{
+    BcpTest_LteCBParams         codeBlkParams;
+    BcpTest_RateMatchParams     rmParams;
+    UInt32                      fieldVal [LTE_DL_HDR_NUM_FIELDS];
+
+    /* The header setup takes the configuration from the test globals */
+    tbSize      =   pGrant->tbSize;
+    numBitsG    =   pGrant->numBitsG;
+    Nir         =   pGrant->Nir;
+    modulation  =   pGrant->modulation;
+    numLayers   =   pGrant->numLayers;
+    rvIdx       =   pGrant->rvIdx;
+    compute_cbparams_ref (tbSize, &codeBlkParams);
+
+    compute_rmGamma_ref (numBitsG, modulation, numLayers, &codeBlkParams, rvIdx & 3, 0, 0, Nir, LTE_PDSCH, &rmParams);
+    fieldVal [LTE_DL_HDR_FIELD_CINIT]   =   pGrant->rnti * (1<<14) + pGrant->codeWordIdx * (1<<13) + 
+                                            pGrant->ns/2  * (1<<9) + pGrant->cellID;
+    fieldVal [LTE_DL_HDR_FIELD_RV_COL1] =   (codeBlkParams.numCodeBksKm == 0) ? rmParams.rvKp : rmParams.rvKm;
+    fieldVal [LTE_DL_HDR_FIELD_RV_COL2] =   (codeBlkParams.numCodeBksKm == 0) ? 0 : rmParams.rvKp;
+    fieldVal [LTE_DL_HDR_FIELD_FLOW_ID] =   pGrant->flowId;
+
+    prepare_dl_hdr_cfgs (&codeBlkParams, fieldVal, pChainCfg);
+
+    return;
+}
+#endif
+
+/** ============================================================================
+ *   @n@b build_dl_batch
+ *
+ *   @b Description
+ *   @n Builds the packets of a batch of grants, e.g., all PDSCH grants of a
+ *      TTI, into Tx descriptors and sets up the descriptor lengths. The next
+ *      descriptor buffer is touched into cache before each packet is built.
+ *      Each packet is entered in the table of packets in flight, and carries
+ *      its metadata in its PS words.
+ *
+ *      Given a link FDQ, the headers alone are built in the Tx descriptor and
+ *      the payload buffer of the grant is linked to it as the next descriptor,
+ *      so that the payload is not copied. The payload must stay untouched
+ *      until BCP returns the packet. Returned packets come back with the 
+ *      payload descriptor still linked, which is then reused. Without a link
+ *      FDQ the payload is copied after the headers.
+ *
+ *   @param[in]  
+ *   @n pGrant      Grants.
+ *
+ *   @param[in]  
+ *   @n numGrants   Number of grants.
+ *
+ *   @param[in]  
+ *   @n ppDesc      Tx descriptor of each grant.
+ *
+ *   @param[in]  
+ *   @n hLinkFDQ    FDQ of buffer-less descriptors to link payloads with, or 
+ *                  NULL to copy the payloads.
+ * 
+ *   @return        Int32
+ *   @n 0       -   All packets built.
+ *
+ *   @n -1      -   Error populating a packet.
+ * =============================================================================
+ */
+static Int32 build_dl_batch 
+(
+    const BcpTest_LteDlGrant*   pGrant, 
+    UInt32                      numGrants,
+    Cppi_Desc**                 ppDesc,
+    Qmss_QueueHnd               hLinkFDQ
+)
+{
+    BcpTest_HdrTmpl*            pHdrTmpl = NULL;
+    BcpTest_PktMeta             pktMeta;
+    UInt32                      psWords [BCP_TEST_PKT_META_PS_WORDS];
+    Cppi_Desc*                  pLinkDesc;
+    UInt8*                      pDataBuffer;
+    UInt8*                      pNextDataBuffer = NULL;
+    UInt32                      dataBufferLen, nextDataBufferLen = 0, touchLen, i;
+    Int32                       dataBufferLenUsed, hdrLen;
+
+    if (numGrants == 0)
+        return 0;
+
+    Cppi_getData (Cppi_DescType_HOST, ppDesc [0], &pDataBuffer, &dataBufferLen);
+    for (i = 0; i < numGrants; i ++)
+    {
+        if (i + 1 < numGrants)
+        {
+            Cppi_getData (Cppi_DescType_HOST, ppDesc [i + 1], &pNextDataBuffer, &nextDataBufferLen);
+            touchLen    =   TX_HDR_BUFFER_SIZE + (hLinkFDQ ? 0 : pGrant [i + 1].payloadLen);
+            touch_data_buffer (pNextDataBuffer, (touchLen < nextDataBufferLen) ? touchLen : nextDataBufferLen);
+        }
+
+        /* Enter the packet in the table of packets in flight */
+        pktMeta.ueId        =   pGrant [i].rnti;
+        pktMeta.harqProcId  =   pGrant [i].harqProcId;
+        pktMeta.tti         =   pGrant [i].tti;
+        pktMeta.pRequest    =   (Void *) &pGrant [i];
+        if (pkt_meta_submit (&pktMeta, psWords) < 0)
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Too many packets in flight! \n");
+#endif
+            return -1;
+        }
+
+        if (dataBufferLen < TX_HDR_BUFFER_SIZE ||
+            (hdrLen = add_dl_grant (&pGrant [i], &pHdrTmpl, psWords, pDataBuffer)) <= 0)
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Error populating packet %d of %d \n", i, numGrants);
+#endif
+            return -1;
+        }
+        dataBufferLenUsed   =   hdrLen;
+
+#ifdef BCP_TEST_HDR_TRACE
+        /* Log the header chain built */
+        hdr_dasm_trace (pDataBuffer, hdrLen);
+#endif
+
+        /* Finally add the data to the packet in the same order as the headers, 
+         * linked or copied.
+         */
+        pLinkDesc   =   hLinkFDQ ? Cppi_getNextBD (Cppi_DescType_HOST, ppDesc [i]) : NULL;
+        if (hLinkFDQ && pGrant [i].pPayload != NULL && pGrant [i].payloadLen > 0)
+        {
+            if (pLinkDesc == NULL)
+            {
+                if ((pLinkDesc = (Cppi_Desc*) Qmss_queuePop (hLinkFDQ)) == NULL)
+                {
+#ifdef BCP_TEST_DEBUG
+                    Bcp_osalLog ("Out of link FDs! \n");
+#endif
+                    return -1;
+                }
+                pLinkDesc   =   (Cppi_Desc *) (QMSS_DESC_PTR (pLinkDesc));
+                Cppi_linkNextBD (Cppi_DescType_HOST, ppDesc [i], pLinkDesc);
+            }
+            Cppi_setData (Cppi_DescType_HOST, pLinkDesc, 
+                          (UInt8 *) convert_coreLocalToGlobalAddr ((UInt32) pGrant [i].pPayload), 
+                          pGrant [i].payloadLen);
+            Cppi_setDataLen (Cppi_DescType_HOST, pLinkDesc, pGrant [i].payloadLen);
+            dataBufferLenUsed   +=  pGrant [i].payloadLen;
+        }
+        else
+        {
+            if (pLinkDesc != NULL)
+            {
+                Cppi_linkNextBD (Cppi_DescType_HOST, ppDesc [i], NULL);
+                Qmss_queuePushDescSize (hLinkFDQ, pLinkDesc, 256);
+            }
+            if (pGrant [i].pPayload != NULL)
+            {
+                if (hdrLen + pGrant [i].payloadLen > dataBufferLen)
+                {
+#ifdef BCP_TEST_DEBUG
+                    Bcp_osalLog ("Error populating packet %d of %d \n", i, numGrants);
+#endif
+                    return -1;
+                }
+                memcpy (pDataBuffer + hdrLen, pGrant [i].pPayload, pGrant [i].payloadLen);
+                hdrLen              +=  pGrant [i].payloadLen;
+                dataBufferLenUsed   =   hdrLen;
+            }
+        }
+
+        /* Setup the data length in the descriptor */
+        Cppi_setDataLen (Cppi_DescType_HOST, ppDesc [i], hdrLen);
+        Cppi_setPacketLen (Cppi_DescType_HOST, ppDesc [i], dataBufferLenUsed);
+
+        pDataBuffer     =   pNextDataBuffer;
+        dataBufferLen   =   nextDataBufferLen;
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b validate_dl_rxdata
+ *
+ *   @b Description
+ *   @n Validates a data buffer received from BCP at the given offset of the
+ *      packet output, against the golden output or, with LTE_DL_REF_MODEL
+ *      defined, the DL chain model output. In compressed modulator mode the
+ *      buffer is only gathered
+ *      here, and checked once the whole packet is in by
+ *      @a validate_dl_packed_rxdata ().
+ *
+ *   @return        
+ *   @n 0           -       Data buffer valid.
+ *   @n -1          -       Validation failed.
+ * =============================================================================
+ */
+static Int32 validate_dl_rxdata 
+(
+    UInt8*              pRxDataBuffer, 
+    UInt32              rxDataBufferLen, 
+    UInt32              dataOffset
+)
+{
+#ifdef LTE_DL_MOD_COMPRESSED
+    if (dataOffset + rxDataBufferLen > sizeof (lte_dl_rx_packed))
+        return -1;
+
+    memcpy ((UInt8 *)lte_dl_rx_packed + dataOffset, pRxDataBuffer, rxDataBufferLen);
+    return 0;
+#elif defined (LTE_DL_GOLDEN_DIGEST)
+    if (dataOffset == 0)
+        digest_check_start (&lteDlDigestCheck, &lteDlDigestPkt1);
+
+    return digest_check_data (&lteDlDigestCheck, pRxDataBuffer, rxDataBufferLen, dataOffset);
+#elif defined (LTE_DL_REF_MODEL)
+    return validate_rxdata ((UInt8 *) lteDlRefOut, lteDlRefOutLen, pRxDataBuffer, rxDataBufferLen, dataOffset);
+#else
+    return golden_validate (&lteDlGoldenPkt1, pRxDataBuffer, rxDataBufferLen, dataOffset);
+#endif
+}
+
+#ifdef LTE_DL_MOD_COMPRESSED
+/** ============================================================================
+ *   @n@b validate_dl_packed_rxdata
+ *
+ *   @b Description
+ *   @n Validates the compressed modulator output of a packet gathered by
+ *      @a validate_dl_rxdata (). The packed constellation indices are expanded
+ *      to I/Q words a block at a time and compared against the reference
+ *      output, expanded alongside, or checked against its digest with
+ *      LTE_DL_GOLDEN_DIGEST defined. The DL chain model outputs the packed
+ *      indices, compared as they are with LTE_DL_REF_MODEL defined.
+ *
+ *   @param[in]  
+ *   @n rxDataTotalLen  Total length of data received for the packet.
+ *
+ *   @return        
+ *   @n 0           -       Data valid.
+ *   @n -1          -       Validation failed.
+ * =============================================================================
+ */
+static Int32 validate_dl_packed_rxdata (UInt32 rxDataTotalLen)
+{
+#ifdef LTE_DL_REF_MODEL
+    if (rxDataTotalLen < lteDlRefOutLen)
+        return -1;
+
+    return validate_rxdata ((UInt8 *) lteDlRefOut, lteDlRefOutLen, (UInt8 *) lte_dl_rx_packed, lteDlRefOutLen, 0);
+#else
+    UInt32              expandBuf [LTE_DL_EXPAND_BLK_SIZE];
+#ifndef LTE_DL_GOLDEN_DIGEST
+    UInt32              goldenBuf [LTE_DL_EXPAND_BLK_SIZE];
+    BcpTest_RxDiff      diff;
+#endif
+    UInt32              numSymb, blkSize, i;
+    UInt16              uva;
+
+    if (rxDataTotalLen < lte_mod_packed_size (LTE_DL_OUTPUT_PKT_1_WRD_SIZE, modulation))
+        return -1;
+
+    uva =   lte_mod_hard_uva (modulation, LTE_DL_MOD_RMS);
+#ifdef LTE_DL_GOLDEN_DIGEST
+    digest_check_start (&lteDlDigestCheck, &lteDlDigestPkt1);
+#endif
+    for (i = 0; i < LTE_DL_OUTPUT_PKT_1_WRD_SIZE; i += LTE_DL_EXPAND_BLK_SIZE)
+    {
+        numSymb =   LTE_DL_OUTPUT_PKT_1_WRD_SIZE - i;
+        blkSize =   (numSymb < LTE_DL_EXPAND_BLK_SIZE) ? numSymb : LTE_DL_EXPAND_BLK_SIZE;
+
+        /* Block start is always word aligned in the packed stream */
+        lte_mod_expand (&lte_dl_rx_packed [(i * modulation) >> 5], blkSize, modulation, uva, expandBuf);
+#ifdef LTE_DL_GOLDEN_DIGEST
+        digest_check_data (&lteDlDigestCheck, (UInt8 *) expandBuf, blkSize * 4, i * 4);
+#else
+        golden_expand (&lteDlGoldenPkt1, i, blkSize, goldenBuf);
+
+        if (rxdata_diff ((UInt8 *) goldenBuf, (UInt8 *) expandBuf, blkSize * 4, i * 4, &diff) != 0)
+        {
+            rxdata_diff_log (&diff);
+            return -1;
+        }
+#endif
+    }
+
+#ifdef LTE_DL_GOLDEN_DIGEST
+    return digest_check_end (&lteDlDigestCheck);
+#else
+    return 0;
+#endif
+#endif
+}
+#endif
+
+/** ============================================================================
+ *   @n@b test_lte_dl
+ *
+ *   @b Description
+ *   @n Sets up the parameters required and runs an LTE Downlink (DL) test case.
+ *
+ *   @param[in]  
+ *   @n hBcp        BCP driver handle
+ *
+ *   @param[in]  
+ *   @n hGlblFDQ    Global free descriptor queue handle. The test will allocate all its
+ *                  free descriptors from this queue for its run and release them
+ *                  back once done to this queue.
+ * 
+ *   @return
+ *   @n None
+ *
+ * =============================================================================
+ */
+Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
+{
+    Bcp_TxCfg           txCfg;
+    Bcp_TxHandle        hTx = NULL;
+    Bcp_RxCfg           rxCfg;
+    Bcp_RxHandle        hRx = NULL;
+    Qmss_QueueHnd       hTxFDQ, hTxLinkFDQ = NULL, hRxFDQ;
+    UInt8               rxFlowId, rxSrcId;
+    UInt32              i, testFail = 0, numTestPkts;
+    UInt32              rxDataBufferLen, rxPsInfoLen, rxDataTotalLen, key;
+    UInt16              rxDestnTag;
+    Cppi_Desc*          pCppiDesc;
+    UInt8*              pRxDataBuffer;
+    UInt8*              pRxPsInfo;
     Bcp_DrvBufferHandle hRxDrvBuffer;
     Bcp_DrvBufferHandle hVoid;
     Bcp_DrvBufferHandle hTmp;
-    Int32               dataBufferLenUsed;
+    Cppi_Desc*          txDesc [TX_NUM_DESC];
+    BcpTest_LteDlGrant  txGrant [TX_NUM_DESC];
+    UInt32              txBatchSize = 0, txBatchIdx = 0;
+#ifdef BCP_TEST_DEBUG
+    UInt32              t0;
+#endif
+    UInt32              rxPktList [ACC_LIST_SIZE], numRxPkts, numRxDrops, tIntOff, tRx;
+    UInt32              maxIntOffCycles = 0, maxRxCycles = 0;
+    BcpTest_PktMeta*    pPktMeta;
+#ifdef LTE_DL_REF_MODEL
+    BcpTest_LteRefChainCfg  refChainCfg;
+#endif
+#ifdef LTE_DL_HDR_EXPORT
+    FILE*               pBlobFile;
+#endif
+#ifdef LTE_DL_VEC_STREAM
+    BcpTest_VecStreamStats  tbStreamStats;
+    UInt32              tbNumWords;
+#endif
 
     ((Void)maxNumHarqProcess);
     ((Void)ueCategory);
     ((Void)ueTransMode);
 
+#ifdef LTE_DL_HDR_BLOBS
+    hdr_tmpl_register_blobs (lteDlHdrBlobs, lteDlHdrBlobs_count);
+#endif
+
     /* Setup Rx side:
      *  -   Open BCP Rx queue on which BCP results are to be received
      *  -   Setup a Rx FDQ, Rx flow to receive data
@@ -4510,7 +2222,7 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
     rxCfg.flowCfg.rx_dest_qnum          =   RX_Q_NUM;  
     rxCfg.flowCfg.rx_desc_type          =   Cppi_DescType_HOST; 
     rxCfg.flowCfg.rx_ps_location        =   Cppi_PSLoc_PS_IN_DESC;  
-    rxCfg.flowCfg.rx_psinfo_present     =   0;           
+    rxCfg.flowCfg.rx_psinfo_present     =   1;              //  PS words carry the packet metadata
     rxCfg.flowCfg.rx_error_handling     =   0;              //  Drop the packet, do not retry on starvation
     rxCfg.flowCfg.rx_einfo_present      =   0;              //  By default no EPIB info
     
@@ -4596,6 +2308,7 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
 		goto cleanup_and_return;
     }
     bIsAccPingListUsed = 0;
+    gRxPktListDrops = 0;
 
     /* Setup Tx side:
      *  -   Open BCP Tx queue using which data would be sent 
@@ -4610,7 +2323,10 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
         return;
     }
 
-    if (allocate_fdq (hGlblFDQ, TX_NUM_DESC, TX_DATA_BUFFER_SIZE, 0, &hTxFDQ, NULL) < 0)
+    /* Tx FDs only carry the headers, the payload is linked to them from a
+     * second FDQ of descriptors without buffers.
+     */
+    if (allocate_fdq (hGlblFDQ, TX_NUM_DESC, TX_HDR_BUFFER_SIZE, 0, &hTxFDQ, NULL) < 0)
     {
         Bcp_osalLog ("Error opening Tx FDQ \n");            
         return;
@@ -4620,36 +2336,115 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
         Bcp_osalLog ("Tx FDQ %d successfully setup with %d descriptors\n", hTxFDQ, TX_NUM_DESC);
     }
 
+    if (allocate_fdq (hGlblFDQ, TX_NUM_DESC, 0, 0, &hTxLinkFDQ, NULL) < 0)
+    {
+        Bcp_osalLog ("Error opening Tx link FDQ \n");            
+        hTxLinkFDQ  =   NULL;
+        testFail ++;
+        goto cleanup_and_return;
+    }
+
+    /* Read test configuration. All packets of the test carry the same grant. */
+    if (read_test_grant (&txGrant [0]) < 0)
+    {
+        Bcp_osalLog ("Error reading test vectors \n");
+        testFail ++;
+        goto cleanup_and_return;
+    }
+    for (i = 1; i < TX_NUM_DESC; i ++)
+        txGrant [i] =   txGrant [0];
+
+#ifdef LTE_DL_VEC_STREAM
+    if ((lteDlTbStream = vec_stream_open (LTE_DL_VEC_STREAM_FILE, (txGrant [0].payloadLen + 3) >> 2, 
+                                          LTE_DL_VEC_STREAM_BUFS)) == NULL)
+    {
+        Bcp_osalLog ("Error opening transport block stream: %s \n", LTE_DL_VEC_STREAM_FILE);
+        testFail ++;
+        goto cleanup_and_return;
+    }
+#endif
+
+#ifdef LTE_DL_REF_MODEL
+    /* Reference output of the grant, computed while the first packets are
+     * built and processed by BCP.
+     */
+    prepare_dl_ref_chain (&txGrant [0], &refChainCfg);
+    if ((lteDlRefJob = lte_ref_dl_start (&refChainCfg, txGrant [0].pPayload)) == NULL)
+    {
+        Bcp_osalLog ("Error starting the DL reference model \n");
+        testFail ++;
+        goto cleanup_and_return;
+    }
+#endif
+
+    /* Start the time stamp counter used to time the packet builds */
+    TSCL    =   0;
+    pkt_meta_init ();
+
     for (numTestPkts = 0; numTestPkts < BCP_TEST_NUM_PACKETS; numTestPkts ++)
     {
-        /* Build and Send a packet with LTE DL parameters for BCP Processing */
-        if ((pCppiDesc = (Cppi_Desc*) Qmss_queuePop (hTxFDQ)) == NULL)
+        /* Build a batch of packets with LTE DL parameters for BCP Processing,
+         * one per free Tx FD.
+         */
+        if (txBatchIdx == txBatchSize)
         {
+            for (txBatchSize = 0; txBatchSize < TX_NUM_DESC && 
+                 numTestPkts + txBatchSize < BCP_TEST_NUM_PACKETS; txBatchSize ++)
+            {
+                if ((pCppiDesc = (Cppi_Desc*) Qmss_queuePop (hTxFDQ)) == NULL)
+                    break;
+                txDesc [txBatchSize]    =   (Cppi_Desc *) (QMSS_DESC_PTR (pCppiDesc));    
+            }
+            if (txBatchSize == 0)
+            {
 #ifdef BCP_TEST_DEBUG
-            Bcp_osalLog ("Out of Tx FDs! \n");
+                Bcp_osalLog ("Out of Tx FDs! \n");
 #endif
-            testFail ++;
-		    goto cleanup_and_return;
-        }
-        pCppiDesc = (Cppi_Desc *) (QMSS_DESC_PTR (pCppiDesc));    
-        Cppi_getData (Cppi_DescType_HOST, pCppiDesc, &pDataBuffer, &dataBufferLen);
-        
-	    memset (pDataBuffer, 0, dataBufferLen); 
+                testFail ++;
+                goto cleanup_and_return;
+            }
+            for (i = 0; i < txBatchSize; i ++)
+            {
+                txGrant [i].tti         =   numTestPkts + i;
+                txGrant [i].harqProcId  =   (numTestPkts + i) & 7;
+#ifdef LTE_DL_VEC_STREAM
+                /* Transport block read ahead */
+                txGrant [i].pPayload    =   (const UInt8 *) vec_stream_get (lteDlTbStream, &tbNumWords);
+                if (txGrant [i].pPayload == NULL || tbNumWords != (txGrant [i].payloadLen + 3) >> 2)
+                {
+                    Bcp_osalLog ("Transport block stream ended at packet %d \n", numTestPkts + i);
+                    for (i = 0; i < txBatchSize; i ++)
+                        Qmss_queuePushDescSize (hTxFDQ, txDesc [i], 256);
+                    testFail ++;
+                    goto cleanup_and_return;
+                }
+#endif
+            }
 
-        /* Read test configuration */
-        if ((dataBufferLenUsed = add_test_config_data (hBcp, pDataBuffer)) <= 0)
-        {
-            Bcp_osalLog ("Error reading test vectors/populating packet \n");
-            testFail ++;
-            goto cleanup_and_return;
+#ifdef BCP_TEST_DEBUG
+            t0  =   TSCL;
+#endif
+            if (build_dl_batch (txGrant, txBatchSize, txDesc, hTxLinkFDQ) < 0)
+            {
+                Bcp_osalLog ("Error populating packets \n");
+
+                /* None of the batch was sent, return its Tx FDs. Payload
+                 * descriptors linked to them are unlinked at cleanup.
+                 */
+                for (i = 0; i < txBatchSize; i ++)
+                    Qmss_queuePushDescSize (hTxFDQ, txDesc [i], 256);
+                testFail ++;
+                goto cleanup_and_return;
+            }
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Built %d packet(s) in %d cycles \n", txBatchSize, TSCL - t0);
+#endif
+            txBatchIdx  =   0;
         }
-
-        /* Setup the data length in the descriptor */
-        Cppi_setDataLen (Cppi_DescType_HOST, pCppiDesc, dataBufferLenUsed);
-        Cppi_setPacketLen (Cppi_DescType_HOST, pCppiDesc, dataBufferLenUsed);
+        pCppiDesc   =   txDesc [txBatchIdx ++];
 
 #ifdef BCP_TEST_DEBIG
-   	    Bcp_osalLog ("Sending a packet of len %d to BCP ...\n", dataBufferLenUsed);
+   	    Bcp_osalLog ("Sending a packet of len %d to BCP ...\n", Cppi_getPacketLen (Cppi_DescType_HOST, pCppiDesc));
 #endif
 
         /* Since BCP is local to the device, set destination address to NULL */
@@ -4661,20 +2456,48 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
 #endif
         Semaphore_pend (hRxSem, BIOS_WAIT_FOREVER);
 
-        /* Disable interrupts while we are reading BCP output from the Rx software list. */
+#ifdef LTE_DL_REF_MODEL
+        /* Reference output, waited for with interrupts still enabled */
+        if ((lteDlRefOut = lte_ref_dl_wait (lteDlRefJob, &lteDlRefOutLen)) == NULL)
+        {
+            Bcp_osalLog ("DL reference model failed \n");
+            testFail ++;
+        }
+#endif
+
+        /* Disable interrupts only to take the packets received off the Rx
+         * software list. They are validated and their buffers recycled with
+         * interrupts enabled, the ISR adding any packets received meanwhile
+         * to the emptied list.
+         */
+        tIntOff =   TSCL;
         key = Hwi_disable();
+        numRxPkts   =   gRxPktListCtr;
+        memcpy (rxPktList, gRxPktList, numRxPkts * sizeof (UInt32));
+        gRxPktListCtr = 0;
+        numRxDrops  =   gRxPktListDrops;
+        gRxPktListDrops = 0;
+        Hwi_restore (key);
+        tRx     =   TSCL;
+        if (tRx - tIntOff > maxIntOffCycles)
+            maxIntOffCycles =   tRx - tIntOff;
 
 #ifdef BCP_TEST_DEBUG
-        Bcp_osalLog ("Got %d packet(s) from BCP \n", gRxPktListCtr);
+        Bcp_osalLog ("Got %d packet(s) from BCP \n", numRxPkts);
 #endif
+        if (numRxDrops > 0)
+        {
+            Bcp_osalLog ("Rx ISR dropped %d packet(s) from BCP, software list full \n", numRxDrops);
+            testFail ++;
+        }
 
-        for (i = 0; i < gRxPktListCtr; i ++)
+        for (i = 0; i < numRxPkts; i ++)
         {
             /* Data could arrive scattered across multiple linked descriptors.
              * Collect data from all linked descriptors and validate it.
              */
             rxDataTotalLen  =   0;
-            hRxDrvBuffer    =   (Bcp_DrvBufferHandle) gRxPktList [i];
+            hRxDrvBuffer    =   (Bcp_DrvBufferHandle) rxPktList [i];
 
             Bcp_rxProcessDesc  (hRx,
                                 hRxDrvBuffer,
@@ -4687,11 +2510,24 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
                                 &rxSrcId,
                                 &rxDestnTag);   
 
-            if (validate_rxdata ((UInt8 *)lte_dl_out_packet_1, 
-                                LTE_DL_OUTPUT_PKT_1_WRD_SIZE*4, 
-                                pRxDataBuffer, 
-                                rxDataBufferLen, 
-                                rxDataTotalLen) != 0)
+            /* Match the packet to its request by the metadata in its PS words */
+            if ((pPktMeta = pkt_meta_lookup (pRxPsInfo, rxPsInfoLen)) == NULL)
+            {
+#ifdef BCP_TEST_DEBUG
+                Bcp_osalLog ("[Pkt %d]: No packet in flight with PS info of len %d \n", i, rxPsInfoLen);
+#endif
+                testFail ++;
+            }
+            else
+            {
+#ifdef BCP_TEST_DEBUG
+                Bcp_osalLog ("[Pkt %d]: UE 0x%x HARQ %d TTI %d, %d cycles in flight \n", i, pPktMeta->ueId, 
+                             pPktMeta->harqProcId, pPktMeta->tti, TSCL - pPktMeta->submitTime);
+#endif
+                pkt_meta_release (pPktMeta);
+            }
+
+            if (validate_dl_rxdata (pRxDataBuffer, rxDataBufferLen, rxDataTotalLen) != 0)
                 testFail ++;                
 
             rxDataTotalLen  +=  rxDataBufferLen;
@@ -4715,11 +2551,7 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
                                         &rxSrcId,
                                         &rxDestnTag);            
 
-                    if (validate_rxdata ((UInt8 *)lte_dl_out_packet_1, 
-                                        LTE_DL_OUTPUT_PKT_1_WRD_SIZE*4, 
-                                        pRxDataBuffer, 
-                                        rxDataBufferLen, 
-                                        rxDataTotalLen) != 0)
+                    if (validate_dl_rxdata (pRxDataBuffer, rxDataBufferLen, rxDataTotalLen) != 0)
                         testFail ++;                        
 
                     rxDataTotalLen  +=  rxDataBufferLen;
@@ -4733,16 +2565,55 @@ Void test_lte_dl (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
             Bcp_osalLog ("[Pkt %d]: Total Len: %d DestnTag: 0x%x SrcId: 0x%x \n", i, rxDataTotalLen, rxDestnTag, rxSrcId);
 #endif
 
+#ifdef LTE_DL_MOD_COMPRESSED
+            if (validate_dl_packed_rxdata (rxDataTotalLen) != 0)
+                testFail ++;                    
+#elif defined (LTE_DL_GOLDEN_DIGEST)
+            if (digest_check_end (&lteDlDigestCheck) != 0)
+                testFail ++;                    
+#elif defined (LTE_DL_REF_MODEL)
+            if (rxDataTotalLen != lteDlRefOutLen)
+                testFail ++;                    
+#else
             if (rxDataTotalLen != LTE_DL_OUTPUT_PKT_1_WRD_SIZE * 4)
                 testFail ++;                    
+#endif
+
+#ifdef LTE_DL_VEC_STREAM
+            /* Packets come back in order, the oldest transport block is free */
+            vec_stream_put (lteDlTbStream);
+#endif
         }
 
-        /* Done processing results received from ISR. Enable interrupts again. */
-        gRxPktListCtr = 0;
-        Hwi_restore (key);
+        /* Rx processing, as long as interrupts used to be disabled for */
+        if (TSCL - tRx > maxRxCycles)
+            maxRxCycles =   TSCL - tRx;
     }
 
 cleanup_and_return:
+#ifdef LTE_DL_VEC_STREAM
+    if (lteDlTbStream)
+    {
+        if (vec_stream_close (lteDlTbStream, &tbStreamStats) < 0)
+        {
+            Bcp_osalLog ("Error reading transport block stream: %s \n", LTE_DL_VEC_STREAM_FILE);
+            testFail ++;
+        }
+        Bcp_osalLog ("LTE DL transport block stream: %d records, %d stalls, %d stalled (TSCL cycles) \n",
+                     tbStreamStats.numRecords, tbStreamStats.numStalls, (UInt32) tbStreamStats.stallTime);
+        lteDlTbStream   =   NULL;
+    }
+#endif
+    if (gRxPktListDrops > 0)
+    {
+        Bcp_osalLog ("Rx ISR dropped %d packet(s) from BCP, software list full \n", gRxPktListDrops);
+        testFail ++;
+    }
+    if (maxRxCycles > 0)
+    {
+        Bcp_osalLog ("LTE DL Rx: interrupts disabled up to %d cycles, Rx processing up to %d cycles with interrupts enabled\n", 
+                     maxIntOffCycles, maxRxCycles);
+    }
     if (testFail > 0)
     {
         Bcp_osalLog ("LTE DL Test:    FAILED\n");                
@@ -4753,7 +2624,27 @@ cleanup_and_return:
         Bcp_osalLog ("LTE DL Test:    PASS\n");                
         totalNumTestsPass ++;
     }
+
+#ifdef LTE_DL_HDR_EXPORT
+    if ((pBlobFile = fopen (LTE_DL_HDR_BLOB_FILE, "w")) != NULL)
+    {
+        Bcp_osalLog ("LTE DL Test: %d header template(s) written to %s\n", 
+                     hdr_tmpl_export_cache (pBlobFile, "lteDlHdrBlobs"), LTE_DL_HDR_BLOB_FILE);
+        fclose (pBlobFile);
+    }
+#endif
     
+#ifdef LTE_DL_REF_MODEL
+    /* Before the payload vector it reads from is released */
+    lte_ref_dl_release (lteDlRefJob);
+    lteDlRefJob =   NULL;
+    lteDlRefOut =   NULL;
+#endif
+
+#ifdef BCP_TEST_BIN_VECTORS
+    vec_release (&lteDlPayloadVec);
+#endif
+
     if (hRxSem)
         Semaphore_delete (hRxSem);
 
@@ -4765,7 +2656,12 @@ cleanup_and_return:
     if (hTx)
         Bcp_txClose (hTx);
 
-    deallocate_fdq (hTxFDQ, hGlblFDQ, TX_NUM_DESC, TX_DATA_BUFFER_SIZE, NULL);
+    if (hTxLinkFDQ)
+    {
+        unlink_fdq (hTxFDQ, hTxLinkFDQ, TX_NUM_DESC);
+        deallocate_fdq (hTxLinkFDQ, hGlblFDQ, TX_NUM_DESC, 0, NULL);
+    }
+    deallocate_fdq (hTxFDQ, hGlblFDQ, TX_NUM_DESC, TX_HDR_BUFFER_SIZE, NULL);
 
     return;
 }
@@ -4816,6 +2712,7 @@ static Void register_rx_interrupts (Void)
 Void Bcp_HiPriorityAccumISR (Void)
 {
     UInt8                     count, i;
+    UInt32                    rxDesc;
     
     /* Process ISR. 
      *
@@ -4839,7 +2736,8 @@ Void Bcp_HiPriorityAccumISR (Void)
     /* Process all the Results received 
      *
      * Skip the first entry in the list that contains the 
-     * entry count and proceed processing results.
+     * entry count and proceed processing results. Results are appended
+     * after any the application has not taken off the list yet.
      */
     for (i = 1; i <= count; i ++)
     {
@@ -4853,7 +2751,7 @@ Void Bcp_HiPriorityAccumISR (Void)
         if (!bIsAccPingListUsed)
         {
             /* Serviced Pong list last time. So read off the Ping list now */                
-            gRxPktList [i - 1]   =   gHiPriAccumList [i];
+            rxDesc  =   gHiPriAccumList [i];
             gHiPriAccumList [i] = NULL;
         }
         else
@@ -4862,12 +2760,19 @@ Void Bcp_HiPriorityAccumISR (Void)
              *
              * Skip over Ping list length to arrive at Pong list start.
              */                
-            gRxPktList [i - 1]   =   gHiPriAccumList [i + ACC_LIST_ENTRY_CNT + 1];
+            rxDesc  =   gHiPriAccumList [i + ACC_LIST_ENTRY_CNT + 1];
             gHiPriAccumList [i + ACC_LIST_ENTRY_CNT + 1] = NULL;
         }
 
+        /* Count the packet dropped if the application has not emptied the list */
+        if (gRxPktListCtr == ACC_LIST_SIZE)
+        {
+            gRxPktListDrops ++;
+            continue;
+        }
+
         /* Increment the number of packets received and saved for application processing */
-        gRxPktListCtr ++;
+        gRxPktList [gRxPktListCtr ++]   =   rxDesc;
     }
 
     /* Wake up any application blocked on this result. */
@@ -0,0 +1,440 @@
+/**
+ *   @file  test_lte_intlv.c
+ *
+ *   @brief
+ *      Software reference of the LTE PUSCH channel interleaver/deinterleaver
+ *      with RI and ACK/NACK placement (3GPP TS 36.212 section 5.2.2.8).
+ *
+ *      The (R'mux x C'mux) interleaving matrix is built once per allocation
+ *      shape and cached as a gather index program, so that interleaving and
+ *      deinterleaving a sub-frame reduce to a single indexed copy.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* RI column set for normal and extended CP (Table 5.2.2.8-1) */
+#pragma DATA_SECTION (riColumnSet, ".testData");
+static const UInt8 riColumnSet[2][LTE_CHINTLV_NUM_COLSET] = {{1, 4, 7, 10}, {0, 3, 5, 8}};
+
+/* ACK/NACK column set for normal and extended CP (Table 5.2.2.8-2) */
+#pragma DATA_SECTION (ackColumnSet, ".testData");
+static const UInt8 ackColumnSet[2][LTE_CHINTLV_NUM_COLSET] = {{2, 3, 8, 9}, {1, 2, 6, 7}};
+
+/* Interleaver program cache */
+#pragma DATA_SECTION (chIntlvCache, ".testData");
+static BcpTest_LteChIntlvProg   chIntlvCache[LTE_CHINTLV_CACHE_SIZE];
+
+#pragma DATA_SECTION (chIntlvUseCtr, ".testData");
+static UInt32                   chIntlvUseCtr;
+
+/* Marks a matrix position that has not been assigned yet */
+#define     LTE_CHINTLV_FREE_POS            0xFFFF
+
+/** ============================================================================
+ *   @n@b lte_chintlv_free_prog
+ *
+ *   @b Description
+ *   @n Releases the index tables held by an interleaver program.
+ *
+ *   @param[in]
+ *   @n pProg           Interleaver program to clean up.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+static Void lte_chintlv_free_prog (BcpTest_LteChIntlvProg* pProg)
+{
+    UInt32              numPos = pProg->numRows * pProg->numCols;
+
+    if (pProg->pFwdIdx)
+        Bcp_osalFree (pProg->pFwdIdx, numPos * sizeof (UInt16), FALSE);
+    if (pProg->pInvIdx)
+        Bcp_osalFree (pProg->pInvIdx, pProg->numSlots * sizeof (UInt16), FALSE);
+    if (pProg->pPuncIdx)
+        Bcp_osalFree (pProg->pPuncIdx, (pProg->numAck + 1) * sizeof (UInt16), FALSE);
+
+    memset (pProg, 0, sizeof (BcpTest_LteChIntlvProg));
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_build_prog
+ *
+ *   @b Description
+ *   @n Builds the gather index program for a given allocation shape.
+ *
+ *      Source slots are numbered in the order the symbols are laid out in the
+ *      caller's un-interleaved buffer: first the H' = H'' - Q'RI data
+ *      (CQI + UL-SCH) symbols, followed by the Q'RI RI symbols and then the
+ *      Q'ACK ACK/NACK symbols. The forward table maps each matrix position (read out column
+ *      by column) to a source slot, the inverse table maps each source slot
+ *      back to its matrix position.
+ *
+ *   @param[out]
+ *   @n pProg           Interleaver program to populate.
+ *
+ *   @param[in]
+ *   @n numRows         R'mux, number of PUSCH sub-carriers.
+ *
+ *   @param[in]
+ *   @n numCols         C'mux, number of PUSCH SC-FDMA symbols (9 to 12).
+ *
+ *   @param[in]
+ *   @n numRi           Q'RI, number of RI symbols.
+ *
+ *   @param[in]
+ *   @n numAck          Q'ACK, number of ACK/NACK symbols.
+ *
+ *   @return        Int32
+ *   @n 0       -   Program built successfully.
+ *   @n -1      -   Invalid shape or out of memory.
+ * =============================================================================
+ */
+static Int32 lte_chintlv_build_prog
+(
+    BcpTest_LteChIntlvProg*     pProg,
+    UInt16                      numRows,
+    UInt8                       numCols,
+    UInt16                      numRi,
+    UInt16                      numAck
+)
+{
+    UInt32                      numPos, pos, slot, i, j, r, c, k;
+    UInt8                       cpType;
+    UInt16*                     pMatrix;
+
+    numPos = numRows * numCols;
+    if (!numRows || numCols < 9 || numCols > 12 ||
+        numRi > LTE_CHINTLV_NUM_COLSET * numRows || numAck > LTE_CHINTLV_NUM_COLSET * numRows ||
+        numPos + numAck > 0xFFFF)
+        return -1;
+
+    memset (pProg, 0, sizeof (BcpTest_LteChIntlvProg));
+    cpType              =   (numCols <= 10) ? 1 : 0;
+    pProg->numRows      =   numRows;
+    pProg->numCols      =   numCols;
+    pProg->bExtendedCp  =   cpType;
+    pProg->numRi        =   numRi;
+    pProg->numAck       =   numAck;
+    pProg->numData      =   numPos - numRi;
+    pProg->numSlots     =   numPos + numAck;
+
+    pProg->pFwdIdx      =   Bcp_osalMalloc (numPos * sizeof (UInt16), FALSE);
+    pProg->pInvIdx      =   Bcp_osalMalloc (pProg->numSlots * sizeof (UInt16), FALSE);
+    pProg->pPuncIdx     =   Bcp_osalMalloc ((numAck + 1) * sizeof (UInt16), FALSE);
+    if (!pProg->pFwdIdx || !pProg->pInvIdx || !pProg->pPuncIdx)
+    {
+        lte_chintlv_free_prog (pProg);
+        return -1;
+    }
+
+    /* Fill the matrix row by row first (y[r * C'mux + c]) in the inverse
+     * table's storage and transpose into the column-wise forward table once
+     * all symbols are placed.
+     */
+    pMatrix = pProg->pInvIdx;
+    for (pos = 0; pos < numPos; pos ++)
+        pMatrix [pos]   =   LTE_CHINTLV_FREE_POS;
+
+    /* RI: bottom rows upwards, columns visited in j = (j + 3) mod 4 order */
+    for (i = 0, j = 0, r = numRows - 1; i < numRi; )
+    {
+        c   =   riColumnSet [cpType][j];
+        pMatrix [r * numCols + c]   =   pProg->numData + i;
+        i ++;
+        r   =   numRows - 1 - (i / LTE_CHINTLV_NUM_COLSET);
+        j   =   (j + 3) % LTE_CHINTLV_NUM_COLSET;
+    }
+
+    /* Data and CQI: row by row, skipping the RI positions */
+    for (pos = 0, k = 0; pos < numPos; pos ++)
+    {
+        if (pMatrix [pos] == LTE_CHINTLV_FREE_POS)
+            pMatrix [pos]   =   k ++;
+    }
+
+    /* ACK/NACK: punctures data symbols, same placement rule as RI */
+    for (i = 0, j = 0, r = numRows - 1; i < numAck; )
+    {
+        c   =   ackColumnSet [cpType][j];
+        pProg->pPuncIdx [i]         =   pMatrix [r * numCols + c];
+        pMatrix [r * numCols + c]   =   pProg->numData + numRi + i;
+        i ++;
+        r   =   numRows - 1 - (i / LTE_CHINTLV_NUM_COLSET);
+        j   =   (j + 3) % LTE_CHINTLV_NUM_COLSET;
+    }
+
+    /* Column-wise read out of the matrix */
+    for (c = 0, pos = 0; c < numCols; c ++)
+    {
+        for (r = 0; r < numRows; r ++)
+            pProg->pFwdIdx [pos ++] =   pMatrix [r * numCols + c];
+    }
+
+    /* Inverse program. Data symbols punctured by ACK/NACK point at the
+     * ACK/NACK position and are zeroed out after the gather.
+     */
+    for (pos = 0; pos < numPos; pos ++)
+        pProg->pInvIdx [pProg->pFwdIdx [pos]]   =   pos;
+    for (i = 0; i < numAck; i ++)
+    {
+        slot    =   pProg->pPuncIdx [i];
+        pProg->pInvIdx [slot]   =   pProg->pInvIdx [pProg->numData + numRi + i];
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_gather
+ *
+ *   @b Description
+ *   @n Indexed symbol copy, pDst[i] = pSrc[pIdx[i]]. The 2, 4 and 8 byte
+ *      symbol sizes (QPSK, 16QAM and QPSK/16QAM 2-layer LLRs) run as typed
+ *      word gathers that software pipeline on the C66x; other sizes fall back
+ *      to a byte copy per symbol.
+ * =============================================================================
+ */
+static Void lte_chintlv_gather
+(
+    const UInt16*       pIdx,
+    UInt32              numSym,
+    const UInt8*        pSrc,
+    UInt8*              pDst,
+    UInt32              symSize
+)
+{
+    UInt32              i, b;
+
+    switch (symSize)
+    {
+        case 2:
+        {
+            const UInt16*   restrict pS = (const UInt16 *) pSrc;
+            UInt16*         restrict pD = (UInt16 *) pDst;
+
+            for (i = 0; i + 4 <= numSym; i += 4)
+            {
+                pD [i]      =   pS [pIdx [i]];
+                pD [i + 1]  =   pS [pIdx [i + 1]];
+                pD [i + 2]  =   pS [pIdx [i + 2]];
+                pD [i + 3]  =   pS [pIdx [i + 3]];
+            }
+            for (; i < numSym; i ++)
+                pD [i]      =   pS [pIdx [i]];
+            break;
+        }
+        case 4:
+        {
+            const UInt32*   restrict pS = (const UInt32 *) pSrc;
+            UInt32*         restrict pD = (UInt32 *) pDst;
+
+            for (i = 0; i + 4 <= numSym; i += 4)
+            {
+                pD [i]      =   pS [pIdx [i]];
+                pD [i + 1]  =   pS [pIdx [i + 1]];
+                pD [i + 2]  =   pS [pIdx [i + 2]];
+                pD [i + 3]  =   pS [pIdx [i + 3]];
+            }
+            for (; i < numSym; i ++)
+                pD [i]      =   pS [pIdx [i]];
+            break;
+        }
+        case 8:
+        {
+            const UInt64*   restrict pS = (const UInt64 *) pSrc;
+            UInt64*         restrict pD = (UInt64 *) pDst;
+
+            for (i = 0; i + 2 <= numSym; i += 2)
+            {
+                pD [i]      =   pS [pIdx [i]];
+                pD [i + 1]  =   pS [pIdx [i + 1]];
+            }
+            for (; i < numSym; i ++)
+                pD [i]      =   pS [pIdx [i]];
+            break;
+        }
+        default:
+        {
+            for (i = 0; i < numSym; i ++, pDst += symSize)
+            {
+                for (b = 0; b < symSize; b ++)
+                    pDst [b]    =   pSrc [pIdx [i] * symSize + b];
+            }
+            break;
+        }
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_get_prog
+ *
+ *   @b Description
+ *   @n Returns the interleaver program for the allocation shape passed. The
+ *      program is built on first use and cached; when the cache is full the
+ *      least recently used program is replaced.
+ *
+ *   @param[in]
+ *   @n numRows         R'mux, number of PUSCH sub-carriers.
+ *
+ *   @param[in]
+ *   @n numCols         C'mux, number of PUSCH SC-FDMA symbols.
+ *
+ *   @param[in]
+ *   @n numRi           Q'RI, number of RI symbols.
+ *
+ *   @param[in]
+ *   @n numAck          Q'ACK, number of ACK/NACK symbols.
+ *
+ *   @return        BcpTest_LteChIntlvProg*
+ *   @n NULL    -   Invalid shape or out of memory.
+ *   @n Valid program handle otherwise.
+ * =============================================================================
+ */
+BcpTest_LteChIntlvProg* lte_chintlv_get_prog
+(
+    UInt16                      numRows,
+    UInt8                       numCols,
+    UInt16                      numRi,
+    UInt16                      numAck
+)
+{
+    UInt32                      i, victim = 0;
+    BcpTest_LteChIntlvProg*     pProg;
+
+    for (i = 0; i < LTE_CHINTLV_CACHE_SIZE; i ++)
+    {
+        pProg = &chIntlvCache [i];
+
+        if (pProg->pFwdIdx && pProg->numRows == numRows && pProg->numCols == numCols &&
+            pProg->numRi == numRi && pProg->numAck == numAck)
+        {
+            pProg->lastUsed = ++ chIntlvUseCtr;
+            return pProg;
+        }
+
+        if (chIntlvCache [i].lastUsed < chIntlvCache [victim].lastUsed)
+            victim = i;
+    }
+
+    pProg = &chIntlvCache [victim];
+    lte_chintlv_free_prog (pProg);
+    if (lte_chintlv_build_prog (pProg, numRows, numCols, numRi, numAck) < 0)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Failed to build channel interleaver for %d x %d matrix \n", numRows, numCols);
+#endif
+        return NULL;
+    }
+    pProg->lastUsed = ++ chIntlvUseCtr;
+
+    return pProg;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_interleave
+ *
+ *   @b Description
+ *   @n Runs the channel interleaver.
+ *
+ *   @param[in]
+ *   @n pProg           Interleaver program obtained from @a lte_chintlv_get_prog ()
+ *
+ *   @param[in]
+ *   @n pSrc            Un-interleaved symbols: H' = H'' - Q'RI data symbols
+ *                      followed by Q'RI RI and Q'ACK ACK/NACK symbols.
+ *
+ *   @param[out]
+ *   @n pDst            Interleaved output, R'mux * C'mux symbols read out column
+ *                      by column.
+ *
+ *   @param[in]
+ *   @n symSize         Size of a symbol in bytes (Qm * NL bits or LLRs).
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_chintlv_interleave
+(
+    BcpTest_LteChIntlvProg*     pProg,
+    UInt8*                      pSrc,
+    UInt8*                      pDst,
+    UInt32                      symSize
+)
+{
+    lte_chintlv_gather (pProg->pFwdIdx, pProg->numRows * pProg->numCols, pSrc, pDst, symSize);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_deinterleave
+ *
+ *   @b Description
+ *   @n Runs the channel deinterleaver. Data symbols that were punctured by
+ *      ACK/NACK are returned as zero (erasure) symbols.
+ *
+ *   @param[in]
+ *   @n pProg           Interleaver program obtained from @a lte_chintlv_get_prog ()
+ *
+ *   @param[in]
+ *   @n pSrc            Interleaved input, R'mux * C'mux symbols.
+ *
+ *   @param[out]
+ *   @n pDst            Deinterleaved output in source slot order, i.e., H'
+ *                      data symbols, Q'RI RI and Q'ACK ACK/NACK symbols.
+ *
+ *   @param[in]
+ *   @n symSize         Size of a symbol in bytes (Qm * NL bits or LLRs).
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_chintlv_deinterleave
+(
+    BcpTest_LteChIntlvProg*     pProg,
+    UInt8*                      pSrc,
+    UInt8*                      pDst,
+    UInt32                      symSize
+)
+{
+    UInt32                      i;
+
+    lte_chintlv_gather (pProg->pInvIdx, pProg->numSlots, pSrc, pDst, symSize);
+
+    for (i = 0; i < pProg->numAck; i ++)
+        memset (pDst + pProg->pPuncIdx [i] * symSize, 0, symSize);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_chintlv_flush_cache
+ *
+ *   @b Description
+ *   @n Frees up all cached interleaver programs.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_chintlv_flush_cache (Void)
+{
+    UInt32                      i;
+
+    for (i = 0; i < LTE_CHINTLV_CACHE_SIZE; i ++)
+        lte_chintlv_free_prog (&chIntlvCache [i]);
+
+    chIntlvUseCtr   =   0;
+
+    return;
+}
@@ -0,0 +1,212 @@
+/**
+ *   @file  test_lte_layermap.c
+ *
+ *   @brief
+ *      Software reference of the LTE layer mapper/demapper for 2 layers
+ *      (3GPP TS 36.211 sections 5.3.2A.2 and 6.3.3.2), used alongside the
+ *      BCP split mode (split_mode_en) configurations.
+ *
+ *      Symbols are 32 bit I/Q words as produced by the BCP modulator and
+ *      consumed by the soft slicer. Splitting a codeword across two layers
+ *      and merging it back is done on symbol pairs held in a 64 bit register,
+ *      without any intermediate buffer.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Even (layer 0) and odd (layer 1) symbol of a 64 bit symbol pair */
+#ifdef _TMS320C6X
+#ifdef  xdc_target__bigEndian
+#define     LTE_LM_EVEN(v)          _hill (v)
+#define     LTE_LM_ODD(v)           _loll (v)
+#define     LTE_LM_PAIR(e, o)       _itoll (e, o)
+#else
+#define     LTE_LM_EVEN(v)          _loll (v)
+#define     LTE_LM_ODD(v)           _hill (v)
+#define     LTE_LM_PAIR(e, o)       _itoll (o, e)
+#endif
+#endif
+
+/** ============================================================================
+ *   @n@b lte_layer_split
+ *
+ *   @b Description
+ *   @n Splits a symbol stream into its even and odd symbols, i.e.,
+ *      pEven[i] = pIn[2i] and pOdd[i] = pIn[2i + 1].
+ * =============================================================================
+ */
+static Void lte_layer_split
+(
+    const UInt32*       restrict pIn,
+    UInt32              numPairs,
+    UInt32*             restrict pEven,
+    UInt32*             restrict pOdd
+)
+{
+    UInt32              i = 0;
+
+#ifdef _TMS320C6X
+    long long           v0, v1;
+
+    for (; i + 2 <= numPairs; i += 2)
+    {
+        v0  =   _mem8_const (&pIn [2 * i]);
+        v1  =   _mem8_const (&pIn [2 * i + 2]);
+
+        _mem8 (&pEven [i])  =   LTE_LM_PAIR (LTE_LM_EVEN (v0), LTE_LM_EVEN (v1));
+        _mem8 (&pOdd [i])   =   LTE_LM_PAIR (LTE_LM_ODD (v0), LTE_LM_ODD (v1));
+    }
+#endif
+    for (; i < numPairs; i ++)
+    {
+        pEven [i]   =   pIn [2 * i];
+        pOdd [i]    =   pIn [2 * i + 1];
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_layer_merge
+ *
+ *   @b Description
+ *   @n Inverse of @a lte_layer_split (), pOut[2i] = pEven[i] and
+ *      pOut[2i + 1] = pOdd[i].
+ * =============================================================================
+ */
+static Void lte_layer_merge
+(
+    const UInt32*       restrict pEven,
+    const UInt32*       restrict pOdd,
+    UInt32              numPairs,
+    UInt32*             restrict pOut
+)
+{
+    UInt32              i = 0;
+
+#ifdef _TMS320C6X
+    for (; i + 2 <= numPairs; i += 2)
+    {
+        _mem8 (&pOut [2 * i])       =   LTE_LM_PAIR (pEven [i], pOdd [i]);
+        _mem8 (&pOut [2 * i + 2])   =   LTE_LM_PAIR (pEven [i + 1], pOdd [i + 1]);
+    }
+#endif
+    for (; i < numPairs; i ++)
+    {
+        pOut [2 * i]        =   pEven [i];
+        pOut [2 * i + 1]    =   pOdd [i];
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_layer_map
+ *
+ *   @b Description
+ *   @n Maps one or two codewords onto 2 layers.
+ *
+ *      With a single codeword (pCw1 == NULL), symbols are distributed
+ *      alternately, x0(i) = d0(2i) and x1(i) = d0(2i + 1). With two codewords
+ *      each codeword is mapped to its own layer, x0(i) = d0(i) and
+ *      x1(i) = d1(i); the copy is skipped when the layer buffer aliases the
+ *      codeword buffer.
+ *
+ *   @param[in]
+ *   @n pCw0            Codeword 0 modulation symbols.
+ *
+ *   @param[in]
+ *   @n pCw1            Codeword 1 modulation symbols. NULL for a single
+ *                      codeword transmission.
+ *
+ *   @param[in]
+ *   @n numLayerSymb    Number of symbols per layer.
+ *
+ *   @param[out]
+ *   @n pLayer0         Layer 0 symbols.
+ *
+ *   @param[out]
+ *   @n pLayer1         Layer 1 symbols.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_layer_map
+(
+    UInt32*             pCw0,
+    UInt32*             pCw1,
+    UInt32              numLayerSymb,
+    UInt32*             pLayer0,
+    UInt32*             pLayer1
+)
+{
+    if (pCw1 == NULL)
+    {
+        lte_layer_split (pCw0, numLayerSymb, pLayer0, pLayer1);
+    }
+    else
+    {
+        if (pLayer0 != pCw0)
+            memcpy (pLayer0, pCw0, numLayerSymb * 4);
+        if (pLayer1 != pCw1)
+            memcpy (pLayer1, pCw1, numLayerSymb * 4);
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_layer_demap
+ *
+ *   @b Description
+ *   @n Inverse of @a lte_layer_map (). Recovers the codeword symbol streams
+ *      from 2 layers of (equalized) symbols.
+ *
+ *   @param[in]
+ *   @n pLayer0         Layer 0 symbols.
+ *
+ *   @param[in]
+ *   @n pLayer1         Layer 1 symbols.
+ *
+ *   @param[in]
+ *   @n numLayerSymb    Number of symbols per layer.
+ *
+ *   @param[out]
+ *   @n pCw0            Codeword 0 symbols. Holds 2 * numLayerSymb symbols
+ *                      for a single codeword transmission.
+ *
+ *   @param[out]
+ *   @n pCw1            Codeword 1 symbols. NULL for a single codeword
+ *                      transmission.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_layer_demap
+(
+    UInt32*             pLayer0,
+    UInt32*             pLayer1,
+    UInt32              numLayerSymb,
+    UInt32*             pCw0,
+    UInt32*             pCw1
+)
+{
+    if (pCw1 == NULL)
+    {
+        lte_layer_merge (pLayer0, pLayer1, numLayerSymb, pCw0);
+    }
+    else
+    {
+        if (pCw0 != pLayer0)
+            memcpy (pCw0, pLayer0, numLayerSymb * 4);
+        if (pCw1 != pLayer1)
+            memcpy (pCw1, pLayer1, numLayerSymb * 4);
+    }
+
+    return;
+}
@@ -0,0 +1,354 @@
+/**
+ *   @file  test_lte_mod.c
+ *
+ *   @brief
+ *      Modulator reference helpers for the LTE tests (3GPP TS 36.211 section 7.1).
+ *
+ *      In compressed mode (sh_mod_sel = 1, uva_val = 0) the BCP modulator
+ *      emits the scrambled constellation indices, Qm bits per symbol packed
+ *      LSB first into 32 bit words, instead of 32 bit I/Q words. The expander
+ *      below rebuilds the uncompressed I/Q words (I in the upper 16 bits, Q in
+ *      the lower 16 bits) from a symbol table, so that compressed output can be
+ *      checked against the existing uncompressed golden outputs.
+ *
+ *      The soft modulator reference maps LLRs to expected symbols, i.e.,
+ *      the constellation averaged over the bit probabilities, as used to
+ *      rebuild interference for PUSCH SIC.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Max constellation size supported, 256 QAM */
+#define     LTE_MOD_MAX_TBL_SIZE            256
+
+/* Two consecutive output symbols as a 64 bit word, first symbol at the
+ * lower address.
+ */
+#ifdef _TMS320C6X
+#ifdef  xdc_target__bigEndian
+#define     LTE_MOD_PAIR(s0, s1)            _itoll (s0, s1)
+#else
+#define     LTE_MOD_PAIR(s0, s1)            _itoll (s1, s0)
+#endif
+#endif
+
+#define     LTE_MOD_IQ_WORD(i, q)           (((UInt32)(UInt16)(i) << 16) | (UInt16)(q))
+
+/* tanh(L/2) in Q15 of every 8 bit LLR, for the LLR Q format it was built for */
+#pragma DATA_SECTION (lteModTanhTbl, ".testData");
+static Int16        lteModTanhTbl[256];
+#pragma DATA_SECTION (lteModTanhQFmt, ".testData");
+static Int16        lteModTanhQFmt = -1;
+
+/** ============================================================================
+ *   @n@b lte_mod_hard_uva
+ *
+ *   @b Description
+ *   @n Returns the uva_val to program for an uncompressed mode hard modulator,
+ *      i.e., the unit amplitude rms/sqrt(2), rms/sqrt(10), rms/sqrt(42) or
+ *      rms/sqrt(170) of the constellation in Q15.
+ *
+ *   @param[in]
+ *   @n mod             Number of bits per symbol (1, 2, 4, 6 or 8).
+ *
+ *   @param[in]
+ *   @n rms             Output RMS amplitude.
+ *
+ *   @return
+ *   @n Unit amplitude.
+ * =============================================================================
+ */
+UInt16 lte_mod_hard_uva (UInt8 mod, UInt16 rms)
+{
+    if (mod == 1 || mod == 2) // BPSK/QPSK
+        return (rms * 23170 + 0x4000) >> 15;
+    else if (mod == 4) //16 QAM
+        return (rms * 10362 + 0x4000) >> 15;
+    else if (mod == 6) //64 QAM
+        return (rms * 5056 + 0x4000) >> 15;
+    else //256 QAM
+        return (rms * 2513 + 0x4000) >> 15;
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_packed_size
+ *
+ *   @b Description
+ *   @n Returns the size in bytes of a compressed mode modulator output of
+ *      numSymb symbols.
+ * =============================================================================
+ */
+UInt32 lte_mod_packed_size (UInt32 numSymb, UInt8 mod)
+{
+    return (numSymb * mod + 7) >> 3;
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_build_table
+ *
+ *   @b Description
+ *   @n Builds the I/Q word of each of the 2^mod constellation indices. Bit j of
+ *      an index is b(i + j) of 36.211 section 7.1; even bits select the I
+ *      amplitude and odd bits the Q amplitude, most significant level first.
+ * =============================================================================
+ */
+static Void lte_mod_build_table (UInt8 mod, UInt16 uva, UInt32* pTbl)
+{
+    UInt32              idx, j, m;
+    Int32               ampI, ampQ;
+
+    if (mod == 1)
+    {
+        pTbl [0]    =   LTE_MOD_IQ_WORD (uva, uva);
+        pTbl [1]    =   LTE_MOD_IQ_WORD (-uva, -uva);
+        return;
+    }
+
+    m   =   mod >> 1;
+    for (idx = 0; idx < (1u << mod); idx ++)
+    {
+        ampI    =   1;
+        ampQ    =   1;
+        for (j = m - 1; j >= 1; j --)
+        {
+            ampI    =   (1 << (m - j)) - (((idx >> (2 * j)) & 1) ? -ampI : ampI);
+            ampQ    =   (1 << (m - j)) - (((idx >> (2 * j + 1)) & 1) ? -ampQ : ampQ);
+        }
+        if (idx & 1)
+            ampI    =   -ampI;
+        if (idx & 2)
+            ampQ    =   -ampQ;
+
+        pTbl [idx]  =   LTE_MOD_IQ_WORD (ampI * uva, ampQ * uva);
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_expand
+ *
+ *   @b Description
+ *   @n Expands compressed mode hard modulator output into I/Q words.
+ *
+ *      For BPSK, QPSK, 16 QAM and 256 QAM a word holds a whole number of
+ *      symbols, which are peeled off with shifts and written out two at a
+ *      time. 64 QAM indices straddle word boundaries and are pulled from a
+ *      64 bit bit reservoir.
+ *
+ *   @param[in]
+ *   @n pPacked         Packed constellation indices.
+ *
+ *   @param[in]
+ *   @n numSymb         Number of symbols to expand.
+ *
+ *   @param[in]
+ *   @n mod             Number of bits per symbol (1, 2, 4, 6 or 8).
+ *
+ *   @param[in]
+ *   @n uva             Unit amplitude, see @a lte_mod_hard_uva ().
+ *
+ *   @param[out]
+ *   @n pOut            numSymb I/Q words.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_mod_expand
+(
+    const UInt32*       restrict pPacked,
+    UInt32              numSymb,
+    UInt8               mod,
+    UInt16              uva,
+    UInt32*             restrict pOut
+)
+{
+    UInt32              symTbl [LTE_MOD_MAX_TBL_SIZE];
+    UInt32              mask = (1u << mod) - 1;
+    UInt32              symPerWord, numWords, word, s0, s1;
+    UInt32              i, k, n = 0;
+    unsigned long long  acc;
+    UInt32              accBits;
+
+    lte_mod_build_table (mod, uva, symTbl);
+
+    if (mod == 6)
+    {
+        acc     =   0;
+        accBits =   0;
+        for (n = 0; n < numSymb; n ++)
+        {
+            if (accBits < 6)
+            {
+                acc     |=  (unsigned long long) (*pPacked ++) << accBits;
+                accBits +=  32;
+            }
+            pOut [n]    =   symTbl [acc & 0x3F];
+            acc         >>= 6;
+            accBits     -=  6;
+        }
+        return;
+    }
+
+    symPerWord  =   32 / mod;
+    numWords    =   numSymb / symPerWord;
+    for (i = 0; i < numWords; i ++)
+    {
+        word    =   pPacked [i];
+        for (k = 0; k < symPerWord; k += 2)
+        {
+            s0      =   symTbl [word & mask];
+            word    >>= mod;
+            s1      =   symTbl [word & mask];
+            word    >>= mod;
+#ifdef _TMS320C6X
+            _mem8 (&pOut [n])   =   LTE_MOD_PAIR (s0, s1);
+#else
+            pOut [n]        =   s0;
+            pOut [n + 1]    =   s1;
+#endif
+            n   +=  2;
+        }
+    }
+
+    /* Partial last word */
+    if (n < numSymb)
+    {
+        word    =   pPacked [numWords];
+        for (; n < numSymb; n ++)
+        {
+            pOut [n]    =   symTbl [word & mask];
+            word        >>= mod;
+        }
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_build_tanh_table
+ *
+ *   @b Description
+ *   @n Fills the tanh(L/2) table for LLRs with qFmt fractional bits, using the
+ *      [7/6] continued fraction approximation of tanh, saturated to 1 where it
+ *      overshoots.
+ * =============================================================================
+ */
+static Void lte_mod_build_tanh_table (UInt8 qFmt)
+{
+    Int32               llr;
+    float               x, x2, t;
+
+    for (llr = -128; llr < 128; llr ++)
+    {
+        x   =   (float) llr / (float) (2 << qFmt);
+        x2  =   x * x;
+        t   =   x * (135135.f + x2 * (17325.f + x2 * (378.f + x2))) /
+                (135135.f + x2 * (62370.f + x2 * (3150.f + x2 * 28.f)));
+        if (t > 1.f)
+            t   =   1.f;
+        else if (t < -1.f)
+            t   =   -1.f;
+
+        lteModTanhTbl [(UInt8) llr] =   (Int16) (t * 32767.f + (t < 0 ? -0.5f : 0.5f));
+    }
+    lteModTanhQFmt  =   qFmt;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_mod_soft_symbols
+ *
+ *   @b Description
+ *   @n Computes soft modulation symbols from LLRs.
+ *
+ *      With t = tanh(L/2) = E[1 - 2b], the expected I (Q) amplitude follows
+ *      the same nesting as the hard constellation of 36.211 section 7.1, e.g.,
+ *      t0 for QPSK, t0 (2 - t2) for 16 QAM and t0 (4 - t2 (2 - t4)) for
+ *      64 QAM. The tanh is a table lookup; for BPSK/QPSK both components of
+ *      a symbol are scaled by the unit amplitude in one packed multiply.
+ *
+ *   @param[in]
+ *   @n pLlr            mod LLRs per symbol, positive for a 0 bit.
+ *
+ *   @param[in]
+ *   @n numSymb         Number of symbols.
+ *
+ *   @param[in]
+ *   @n mod             Number of bits per symbol (1, 2, 4, 6 or 8).
+ *
+ *   @param[in]
+ *   @n qFmt            Number of fractional bits of the LLRs.
+ *
+ *   @param[in]
+ *   @n uva             Unit amplitude, see @a lte_mod_hard_uva ().
+ *
+ *   @param[out]
+ *   @n pOut            numSymb I/Q words.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_mod_soft_symbols
+(
+    const Int8*         restrict pLlr,
+    UInt32              numSymb,
+    UInt8               mod,
+    UInt8               qFmt,
+    UInt16              uva,
+    UInt32*             restrict pOut
+)
+{
+    const Int16*        pTbl = lteModTanhTbl;
+    Int32               tI, tQ, ampI, ampQ;
+    UInt32              n, j, m;
+#ifdef _TMS320C6X
+    long long           p;
+#endif
+
+    if (lteModTanhQFmt != qFmt)
+        lte_mod_build_tanh_table (qFmt);
+
+    if (mod <= 2)
+    {
+        for (n = 0; n < numSymb; n ++)
+        {
+            tI  =   pTbl [(UInt8) pLlr [0]];
+            tQ  =   pTbl [(UInt8) pLlr [mod - 1]];
+            pLlr    +=  mod;
+#ifdef _TMS320C6X
+            p   =   _mpy2ir (_pack2 (tI, tQ), uva);
+            pOut [n]    =   _spack2 (_hill (p), _loll (p));
+#else
+            pOut [n]    =   LTE_MOD_IQ_WORD ((tI * uva + 0x4000) >> 15, (tQ * uva + 0x4000) >> 15);
+#endif
+        }
+        return;
+    }
+
+    /* Amplitudes in Q12 from here on */
+    m   =   mod >> 1;
+    for (n = 0; n < numSymb; n ++)
+    {
+        ampI    =   1 << 12;
+        ampQ    =   1 << 12;
+        for (j = m - 1; j >= 1; j --)
+        {
+            ampI    =   ((1 << (m - j)) << 12) - ((pTbl [(UInt8) pLlr [2 * j]] * ampI) >> 15);
+            ampQ    =   ((1 << (m - j)) << 12) - ((pTbl [(UInt8) pLlr [2 * j + 1]] * ampQ) >> 15);
+        }
+        ampI    =   (pTbl [(UInt8) pLlr [0]] * ampI) >> 15;
+        ampQ    =   (pTbl [(UInt8) pLlr [1]] * ampQ) >> 15;
+        pLlr    +=  mod;
+
+        pOut [n]    =   LTE_MOD_IQ_WORD ((ampI * uva + 0x800) >> 12, (ampQ * uva + 0x800) >> 12);
+    }
+
+    return;
+}
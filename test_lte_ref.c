@@ -0,0 +1,718 @@
+/**
+ *   @file  test_lte_ref.c
+ *
+ *   @brief
+ *      Software reference of the LTE transport channel bit processing done
+ *      by BCP (3GPP TS 36.212 sections 5.1.1 - 5.1.4 CRC attachment, code
+ *      block segmentation, turbo coding and rate matching, and TS 36.211
+ *      section 7.2 scrambling sequence), used to compute expected BCP outputs
+ *      on the DSP.
+ *
+ *      Bit processing works on one byte per bit, so the same rate matching
+ *      code serves hard bits (0/1) and soft bits (LLRs).
+ *
+ *      The DL chain model runs these steps, then scrambling and modulation,
+ *      as configured by the CRC, encoder, rate matching and modulator headers
+ *      of a packet, to produce the output BCP is expected to return for it.
+ *      It is run on a worker task, a thread on the host, so the expected
+ *      output is computed while BCP processes the packet.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+#ifndef _TMS320C6X
+#include <stdlib.h>
+#include <pthread.h>
+#endif
+
+/* Sub-block interleaver inter-column permutation, 36.212 table 5.1.4-1 */
+#pragma DATA_SECTION (lteRefColPerm, ".testData");
+static const UInt8 lteRefColPerm[32] = {
+    0, 16, 8, 24, 4, 20, 12, 28, 2, 18, 10, 26, 6, 22, 14, 30,
+    1, 17, 9, 25, 5, 21, 13, 29, 3, 19, 11, 27, 7, 23, 15, 31
+};
+
+/* Scrambling sequence offset Nc */
+#define     LTE_REF_GOLD_NC                 1600
+
+/* CRC generator polynomials, 36.212 section 5.1.1, without the D^24 term */
+#define     LTE_REF_CRC24A_POLY             0x864CFB
+#define     LTE_REF_CRC24B_POLY             0x800063
+#define     LTE_REF_CRC_LEN                 24
+
+/* Turbo encoder tail, 36.212 section 5.1.3.2.2 */
+#define     LTE_REF_TURBO_TAIL              4
+
+#ifdef _TMS320C6X
+#define LTE_REF_MALLOC(len)                 Bcp_osalMalloc ((len), FALSE)
+#define LTE_REF_FREE(ptr, len)              Bcp_osalFree ((ptr), (len), FALSE)
+#else
+#define LTE_REF_MALLOC(len)                 malloc (len)
+#define LTE_REF_FREE(ptr, len)              free (ptr)
+#endif
+
+/* DL chain model run on a worker, see lte_ref_dl_start () */
+struct _BcpTest_LteRefJob
+{
+    BcpTest_LteRefChainCfg  cfg;
+    const UInt8*        pPayload;
+    UInt32*             pOut;
+    UInt32              outLen;         /* Bytes */
+    Int32               status;
+    Bool                bDone;          /* Worker waited for */
+#ifdef _TMS320C6X
+    Semaphore_Handle    semDone;
+    Task_Handle         hWorker;
+#else
+    pthread_t           worker;
+#endif
+};
+
+/** ============================================================================
+ *   @n@b lte_ref_gold_seq
+ *
+ *   @b Description
+ *   @n Generates the length-31 Gold sequence c(n), n = 0 .. len - 1, of
+ *      36.211 section 7.2, packed LSB first into 32 bit words.
+ *
+ *      Both m-sequences are advanced 28 bits at a time: with x(n) .. x(n + 30)
+ *      held in a word, x(n + 31 + k) for k < 28 only depends on bits already
+ *      in the word.
+ *
+ *   @param[in]
+ *   @n cinit           Second m-sequence initial value.
+ *
+ *   @param[in]
+ *   @n len             Number of bits to generate.
+ *
+ *   @param[out]
+ *   @n pSeq            (len + 31) / 32 words of output.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_ref_gold_seq (UInt32 cinit, UInt32 len, UInt32* pSeq)
+{
+    UInt32              x1 = 1, x2 = cinit & 0x7FFFFFFF;
+    UInt32              c, numBits, skip = LTE_REF_GOLD_NC;
+    unsigned long long  acc = 0;
+    UInt32              accBits = 0;
+
+    while (len > 0)
+    {
+        c   =   (x1 ^ x2) & 0x0FFFFFFF;
+        x1  =   (x1 >> 28) | ((((x1 >> 3) ^ x1) & 0x0FFFFFFF) << 3);
+        x2  =   (x2 >> 28) | ((((x2 >> 3) ^ (x2 >> 2) ^ (x2 >> 1) ^ x2) & 0x0FFFFFFF) << 3);
+
+        numBits =   28;
+        if (skip > 0)
+        {
+            if (skip >= 28)
+            {
+                skip    -=  28;
+                continue;
+            }
+            c       >>= skip;
+            numBits -=  skip;
+            skip    =   0;
+        }
+        if (numBits > len)
+            numBits =   len;
+
+        acc     |=  (unsigned long long) c << accBits;
+        accBits +=  numBits;
+        len     -=  numBits;
+        if (accBits >= 32)
+        {
+            *pSeq ++    =   (UInt32) acc;
+            acc         >>= 32;
+            accBits     -=  32;
+        }
+    }
+
+    if (accBits > 0)
+        *pSeq   =   (UInt32) acc & ((1u << accBits) - 1);
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_rm_index
+ *
+ *   @b Description
+ *   @n Maps a circular buffer position to its encoder output, i.e., returns
+ *      the stream in bits 17:16 and the index in that stream in bits 15:0 of
+ *      the bit at circular buffer position k, or -1 for a dummy/filler bit.
+ * =============================================================================
+ */
+static Int32 lte_ref_rm_index
+(
+    UInt32              k,
+    UInt32              numRows,
+    UInt32              numDummy,
+    UInt32              numFiller
+)
+{
+    UInt32              Kpi = numRows * 32;
+    UInt32              stream, i, y;
+
+    if (k < Kpi)
+    {
+        stream  =   0;
+        i       =   k;
+    }
+    else
+    {
+        stream  =   1 + ((k - Kpi) & 1);
+        i       =   (k - Kpi) >> 1;
+    }
+
+    if (stream < 2)
+        y   =   (i % numRows) * 32 + lteRefColPerm [i / numRows];
+    else
+        y   =   (lteRefColPerm [i / numRows] + 32 * (i % numRows) + 1) % Kpi;
+
+    if (y < numDummy)
+        return -1;
+    y   -=  numDummy;
+    if (stream < 2 && y < numFiller)
+        return -1;
+
+    return (Int32) ((stream << 16) | y);
+}
+
+/* Bit selection of E bits from the circular buffer of Ncb bits, starting
+ * at k0.
+ */
+static Void lte_ref_bit_select
+(
+    const Int8*         pD0,
+    const Int8*         pD1,
+    const Int8*         pD2,
+    UInt32              D,
+    UInt32              numFiller,
+    UInt32              Ncb,
+    UInt32              k0,
+    UInt32              E,
+    Int8*               pOut
+)
+{
+    const Int8*         pStream[3];
+    UInt32              numRows = (D + 31) / 32;
+    UInt32              numDummy = numRows * 32 - D;
+    UInt32              k, e;
+    Int32               idx;
+
+    pStream [0] =   pD0;
+    pStream [1] =   pD1;
+    pStream [2] =   pD2;
+
+    for (e = 0, k = k0 % Ncb; e < E; k = (k + 1 == Ncb) ? 0 : k + 1)
+    {
+        if ((idx = lte_ref_rm_index (k, numRows, numDummy, numFiller)) < 0)
+            continue;
+
+        pOut [e ++] =   pStream [idx >> 16] [idx & 0xFFFF];
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_rate_match
+ *
+ *   @b Description
+ *   @n Rate matches one turbo coded block: sub-block interleaving, bit
+ *      collection into the circular buffer and bit selection of E bits
+ *      starting at k0 for the redundancy version.
+ *
+ *   @param[in]
+ *   @n pD0, pD1, pD2   Encoder output streams d(0), d(1), d(2), D bytes each.
+ *
+ *   @param[in]
+ *   @n D               Stream length, K + 4.
+ *
+ *   @param[in]
+ *   @n numFiller       Number of filler bits at the start of the block.
+ *
+ *   @param[in]
+ *   @n Ncb             Soft buffer size.
+ *
+ *   @param[in]
+ *   @n rvIdx           Redundancy version.
+ *
+ *   @param[in]
+ *   @n E               Number of bits to select.
+ *
+ *   @param[out]
+ *   @n pOut            E selected bits.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_ref_rate_match
+(
+    const Int8*         pD0,
+    const Int8*         pD1,
+    const Int8*         pD2,
+    UInt32              D,
+    UInt32              numFiller,
+    UInt32              Ncb,
+    UInt8               rvIdx,
+    UInt32              E,
+    Int8*               pOut
+)
+{
+    UInt32              numRows = (D + 31) / 32;
+
+    lte_ref_bit_select (pD0, pD1, pD2, D, numFiller, Ncb,
+                        numRows * (2 * ((Ncb + 8 * numRows - 1) / (8 * numRows)) * rvIdx + 2), E, pOut);
+
+    return;
+}
+
+/* CRC of a bit sequence, parity bit p0 in the most significant bit */
+static UInt32 lte_ref_crc (const Int8* pBits, UInt32 numBits, UInt32 poly)
+{
+    UInt32              crc = 0, fb, i;
+
+    for (i = 0; i < numBits; i ++)
+    {
+        fb  =   ((crc >> (LTE_REF_CRC_LEN - 1)) ^ (UInt32) pBits [i]) & 1;
+        crc =   (crc << 1) & ((1u << LTE_REF_CRC_LEN) - 1);
+        if (fb)
+            crc ^=  poly;
+    }
+
+    return crc;
+}
+
+/* Appends the CRC of a bit sequence to it */
+static Void lte_ref_crc_attach (Int8* pBits, UInt32 numBits, UInt32 poly)
+{
+    UInt32              crc = lte_ref_crc (pBits, numBits, poly);
+    UInt32              i;
+
+    for (i = 0; i < LTE_REF_CRC_LEN; i ++)
+        pBits [numBits + i] =   (Int8) ((crc >> (LTE_REF_CRC_LEN - 1 - i)) & 1);
+
+    return;
+}
+
+/* Constituent encoder step: returns the parity bit of input bit b and
+ * advances the state, s0 in bit 0.
+ */
+static UInt32 lte_ref_rsc_step (UInt32* pState, UInt32 b)
+{
+    UInt32              s = *pState;
+    UInt32              a = b ^ (s >> 1) ^ (s >> 2);
+
+    *pState =   ((s << 1) | (a & 1)) & 7;
+    return (a ^ s ^ (s >> 2)) & 1;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_turbo_encode
+ *
+ *   @b Description
+ *   @n Turbo encodes one code block, 36.212 section 5.1.3.2, QPP interleaver
+ *      included, with trellis termination of both constituent encoders.
+ *      Filler bits are encoded as 0.
+ * =============================================================================
+ */
+static Void lte_ref_turbo_encode
+(
+    const Int8*         pC,
+    UInt32              K,
+    UInt32              f1,
+    UInt32              f2,
+    Int8*               pD0,
+    Int8*               pD1,
+    Int8*               pD2
+)
+{
+    UInt32              s1 = 0, s2 = 0, pi = 0, g, i;
+    UInt32              x [2][3], z [2][3];
+
+    /* pi(i + 1) = pi(i) + g(i), g(i + 1) = g(i) + 2 f2 */
+    g   =   (f1 + f2) % K;
+    for (i = 0; i < K; i ++)
+    {
+        pD0 [i] =   pC [i];
+        pD1 [i] =   (Int8) lte_ref_rsc_step (&s1, (UInt32) pC [i]);
+        pD2 [i] =   (Int8) lte_ref_rsc_step (&s2, (UInt32) pC [pi]);
+        pi      =   (pi + g) % K;
+        g       =   (g + 2 * f2) % K;
+    }
+
+    /* Tail, input taken from the feedback to flush the registers */
+    for (i = 0; i < 3; i ++)
+    {
+        x [0][i]    =   ((s1 >> 1) ^ (s1 >> 2)) & 1;
+        z [0][i]    =   lte_ref_rsc_step (&s1, x [0][i]);
+        x [1][i]    =   ((s2 >> 1) ^ (s2 >> 2)) & 1;
+        z [1][i]    =   lte_ref_rsc_step (&s2, x [1][i]);
+    }
+    pD0 [K]     =   (Int8) x [0][0];
+    pD0 [K + 1] =   (Int8) z [0][1];
+    pD0 [K + 2] =   (Int8) x [1][0];
+    pD0 [K + 3] =   (Int8) z [1][1];
+    pD1 [K]     =   (Int8) z [0][0];
+    pD1 [K + 1] =   (Int8) x [0][2];
+    pD1 [K + 2] =   (Int8) z [1][0];
+    pD1 [K + 3] =   (Int8) x [1][2];
+    pD2 [K]     =   (Int8) x [0][1];
+    pD2 [K + 1] =   (Int8) z [0][2];
+    pD2 [K + 2] =   (Int8) x [1][1];
+    pD2 [K + 3] =   (Int8) z [1][2];
+
+    return;
+}
+
+/* Number of bits per symbol of the modulator configuration */
+static UInt32 lte_ref_mod_order (const Bcp_ModHdrCfg* pModCfg)
+{
+    if (pModCfg->mod_type_sel == Bcp_ModulationType_BPSK)
+        return 1;
+
+    return 2 * (UInt32) pModCfg->mod_type_sel;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_out_len
+ *
+ *   @b Description
+ *   @n Returns the length of the BCP output of a DL chain configuration: the
+ *      I/Q words of the hard modulator, or in compressed mode the packed
+ *      constellation indices.
+ *
+ *   @param[in]
+ *   @n pCfg            DL chain configuration.
+ *
+ *   @return        UInt32
+ *   @n Output length in bytes, 0 if the configuration is not supported.
+ * =============================================================================
+ */
+UInt32 lte_ref_dl_out_len (const BcpTest_LteRefChainCfg* pCfg)
+{
+    UInt32              G, Qm;
+
+    G   =   pCfg->lteRm.num_code_blocks_ce1 * pCfg->lteRm.block_size_e1 +
+            pCfg->lteRm.num_code_blocks_ce2 * pCfg->lteRm.block_size_e2;
+    Qm  =   lte_ref_mod_order (&pCfg->mod);
+    if (G == 0 || Qm > 8 || (Qm > 1 && (Qm & 1)) || G % Qm || pCfg->mod.sh_mod_sel > 1)
+        return 0;
+
+    /* sh_mod_sel 1: compressed mode */
+    if (pCfg->mod.sh_mod_sel == 1)
+        return lte_mod_packed_size (G / Qm, (UInt8) Qm);
+
+    return (G / Qm) * 4;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_chain
+ *
+ *   @b Description
+ *   @n Computes the BCP output of a DL packet: CRC attachment, code block
+ *      segmentation with per block CRC, turbo coding and rate matching of
+ *      each code block, then scrambling and modulation of the code blocks
+ *      concatenated. Each step takes its parameters from the module header
+ *      configuration of the packet.
+ *
+ *      The transport block is in the LTE bit order of BCP, first bit in the
+ *      LSB of the first byte. Without a CRC module header, the payload
+ *      carries the transport block CRC already.
+ *
+ *   @param[in]
+ *   @n pCfg            DL chain configuration.
+ *
+ *   @param[in]
+ *   @n pPayload        Transport block.
+ *
+ *   @param[out]
+ *   @n pOut            Output, @a lte_ref_dl_out_len () bytes rounded up
+ *                      to words.
+ *
+ *   @return        Int32
+ *   @n 0       -   Output computed.
+ *
+ *   @n -1      -   Configuration not supported, or out of memory.
+ * =============================================================================
+ */
+Int32 lte_ref_dl_chain (const BcpTest_LteRefChainCfg* pCfg, const UInt8* pPayload, UInt32* pOut)
+{
+    const Bcp_RmHdr_LteCfg* pRm = &pCfg->lteRm;
+    const Bcp_EncBlockCfg*  pBlk;
+    UInt32              Ncb [2], k0 [2], numRows, rvCol;
+    UInt32              numCodeBlks, crcLen, sumK, Kmax, numBits, tbBits, numFiller;
+    UInt32              G, Qm, memLen, numWords, bitOffset, eOffset, E, K, r, grp, i;
+    Int8*               pMem;
+    Int8*               pB;
+    Int8*               pBlkBits;
+    Int8*               pD;
+    Int8*               pE;
+    UInt32*             pPacked;
+
+    if (lte_ref_dl_out_len (pCfg) == 0 || pRm->channel_type != 0 || pCfg->enc.turbo_conv_sel != 1 ||
+        (pCfg->crc.local_hdr_len && (pCfg->crc.bit_order != 1 || pCfg->crc.va_blks != 1 ||
+         (pCfg->crc.va_crc != Bcp_CrcFormat_Crc24a && pCfg->crc.va_crc != Bcp_CrcFormat_Crc0))))
+        return -1;
+
+    /* Code blocks: blockCfg [0] and blockCfg [1] sizes, rate matched with
+     * the parameters of the same group of the RM header
+     */
+    numCodeBlks =   0;
+    sumK        =   0;
+    Kmax        =   0;
+    for (grp = 0; grp < 2; grp ++)
+    {
+        pBlk        =   &pCfg->enc.blockCfg [grp];
+        numRows     =   (pBlk->block_size + LTE_REF_TURBO_TAIL + 31) / 32;
+        rvCol       =   grp ? pRm->rv_start_column2 : pRm->rv_start_column1;
+        Ncb [grp]   =   numRows * 32 + 1 + 2 * numRows * (grp ? pRm->param_ncb2_column : pRm->param_ncb1_column) +
+                        (grp ? pRm->param_ncb2_row : pRm->param_ncb1_row);
+        k0 [grp]    =   numRows * (rvCol < 32 ? rvCol : (rvCol - 32) * 2 + 32);
+
+        numCodeBlks +=  pBlk->num_code_blks;
+        sumK        +=  pBlk->num_code_blks * pBlk->block_size;
+        if (pBlk->num_code_blks && pBlk->block_size > Kmax)
+            Kmax    =   pBlk->block_size;
+    }
+    crcLen      =   pCfg->enc.scr_crc_en ? LTE_REF_CRC_LEN : 0;
+    numFiller   =   pRm->num_filler_bits_f;
+    G           =   pRm->num_code_blocks_ce1 * pRm->block_size_e1 + pRm->num_code_blocks_ce2 * pRm->block_size_e2;
+    Qm          =   lte_ref_mod_order (&pCfg->mod);
+    if (numCodeBlks == 0 || numCodeBlks != pRm->num_code_blocks_ce1 + pRm->num_code_blocks_ce2 ||
+        sumK < numCodeBlks * crcLen + numFiller)
+        return -1;
+
+    /* Filler bits, transport block and its CRC */
+    numBits =   sumK - numCodeBlks * crcLen;
+    tbBits  =   numBits - numFiller;
+    if (pCfg->crc.local_hdr_len)
+    {
+        if (pCfg->crc.va_blk_len + (pCfg->crc.va_crc == Bcp_CrcFormat_Crc24a ? LTE_REF_CRC_LEN : 0) != tbBits)
+            return -1;
+        tbBits  =   pCfg->crc.va_blk_len;
+    }
+
+    numWords    =   (G + 31) / 32;
+    memLen      =   numBits + Kmax + 3 * (Kmax + LTE_REF_TURBO_TAIL) + G + numWords * 4;
+    if ((pMem = (Int8 *) LTE_REF_MALLOC (memLen)) == NULL)
+        return -1;
+    pPacked     =   (UInt32 *) pMem;
+    pB          =   pMem + numWords * 4;
+    pBlkBits    =   pB + numBits;
+    pD          =   pBlkBits + Kmax;
+    pE          =   pD + 3 * (Kmax + LTE_REF_TURBO_TAIL);
+
+    memset (pB, 0, numFiller);
+    for (i = 0; i < tbBits; i ++)
+        pB [numFiller + i]  =   (Int8) ((pPayload [i >> 3] >> (i & 7)) & 1);
+    if (pCfg->crc.local_hdr_len && pCfg->crc.va_crc == Bcp_CrcFormat_Crc24a)
+        lte_ref_crc_attach (pB + numFiller, tbBits, LTE_REF_CRC24A_POLY);
+
+    /* Code blocks, filler bits at the start of the first one */
+    bitOffset   =   0;
+    eOffset     =   0;
+    for (r = 0; r < numCodeBlks; r ++)
+    {
+        grp     =   (r < pCfg->enc.blockCfg [0].num_code_blks) ? 0 : 1;
+        pBlk    =   &pCfg->enc.blockCfg [grp];
+        K       =   pBlk->block_size;
+
+        memcpy (pBlkBits, pB + bitOffset, K - crcLen);
+        bitOffset   +=  K - crcLen;
+        if (crcLen)
+            lte_ref_crc_attach (pBlkBits, K - crcLen, LTE_REF_CRC24B_POLY);
+
+        lte_ref_turbo_encode (pBlkBits, K, pBlk->intvpar0, pBlk->intvpar1,
+                              pD, pD + K + LTE_REF_TURBO_TAIL, pD + 2 * (K + LTE_REF_TURBO_TAIL));
+
+        E   =   (r < pRm->num_code_blocks_ce1) ? pRm->block_size_e1 : pRm->block_size_e2;
+        lte_ref_bit_select (pD, pD + K + LTE_REF_TURBO_TAIL, pD + 2 * (K + LTE_REF_TURBO_TAIL), K + LTE_REF_TURBO_TAIL,
+                            r ? 0 : numFiller, Ncb [grp], k0 [grp], E, pE + eOffset);
+        eOffset     +=  E;
+    }
+
+    /* Scrambled bits packed from the LSB, which is the compressed mode output */
+    if (pCfg->mod.sh_mod_sel == 1)
+        pPacked =   pOut;
+    if (pCfg->mod.scr_en)
+        lte_ref_gold_seq (pCfg->mod.cinit_p2, G, pPacked);
+    else
+        memset (pPacked, 0, numWords * 4);
+    for (i = 0; i < G; i ++)
+        pPacked [i >> 5]    ^=  (UInt32) pE [i] << (i & 31);
+
+    if (pCfg->mod.sh_mod_sel == 0)
+        lte_mod_expand (pPacked, G / Qm, (UInt8) Qm, pCfg->mod.uva_val, pOut);
+
+    LTE_REF_FREE (pMem, memLen);
+    return 0;
+}
+
+static Void lte_ref_dl_run (BcpTest_LteRefJob* pJob)
+{
+    pJob->status    =   lte_ref_dl_chain (&pJob->cfg, pJob->pPayload, pJob->pOut);
+
+    return;
+}
+
+#ifdef _TMS320C6X
+static Void lte_ref_dl_worker_task (UArg arg0, UArg arg1)
+{
+    lte_ref_dl_run ((BcpTest_LteRefJob *) arg0);
+    Semaphore_post (((BcpTest_LteRefJob *) arg0)->semDone);
+}
+#else
+static void* lte_ref_dl_worker_thread (void* pArg)
+{
+    lte_ref_dl_run ((BcpTest_LteRefJob *) pArg);
+    return NULL;
+}
+#endif
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_start
+ *
+ *   @b Description
+ *   @n Starts computing the BCP output of a DL packet, see
+ *      @a lte_ref_dl_chain (), on a worker task at the priority of the
+ *      caller, a thread on the host. The worker runs while the caller waits
+ *      on BCP.
+ *
+ *   @param[in]
+ *   @n pCfg            DL chain configuration, copied.
+ *
+ *   @param[in]
+ *   @n pPayload        Transport block. Must remain valid until
+ *                      @a lte_ref_dl_wait () returns.
+ *
+ *   @return        BcpTest_LteRefJob*
+ *   @n Job, NULL if the configuration is not supported or out of memory.
+ * =============================================================================
+ */
+BcpTest_LteRefJob* lte_ref_dl_start (const BcpTest_LteRefChainCfg* pCfg, const UInt8* pPayload)
+{
+    BcpTest_LteRefJob*  pJob;
+    UInt32              outLen;
+#ifdef _TMS320C6X
+    Task_Params         workerTaskParams;
+#endif
+
+    if ((outLen = lte_ref_dl_out_len (pCfg)) == 0)
+        return NULL;
+
+    if ((pJob = (BcpTest_LteRefJob *) LTE_REF_MALLOC (sizeof (BcpTest_LteRefJob))) == NULL)
+        return NULL;
+    memset (pJob, 0, sizeof (BcpTest_LteRefJob));
+    if ((pJob->pOut = (UInt32 *) LTE_REF_MALLOC ((outLen + 3) & ~3)) == NULL)
+    {
+        LTE_REF_FREE (pJob, sizeof (BcpTest_LteRefJob));
+        return NULL;
+    }
+    pJob->cfg       =   *pCfg;
+    pJob->pPayload  =   pPayload;
+    pJob->outLen    =   outLen;
+    pJob->status    =   -1;
+
+#ifdef _TMS320C6X
+    if ((pJob->semDone = Semaphore_create (0, NULL, NULL)) == NULL)
+        goto error;
+
+    Task_Params_init (&workerTaskParams);
+    workerTaskParams.stackSize  =   4096;
+    workerTaskParams.priority   =   Task_getPri (Task_self ());
+    workerTaskParams.arg0       =   (UArg) pJob;
+    if ((pJob->hWorker = Task_create ((Task_FuncPtr) &lte_ref_dl_worker_task, &workerTaskParams, NULL)) == NULL)
+    {
+        Semaphore_delete (&pJob->semDone);
+        goto error;
+    }
+#else
+    if (pthread_create (&pJob->worker, NULL, lte_ref_dl_worker_thread, pJob) != 0)
+        goto error;
+#endif
+
+    return pJob;
+
+error:
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("Cannot start the DL reference model \n");
+#endif
+    LTE_REF_FREE (pJob->pOut, (outLen + 3) & ~3);
+    LTE_REF_FREE (pJob, sizeof (BcpTest_LteRefJob));
+    return NULL;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_wait
+ *
+ *   @b Description
+ *   @n Waits for the output of a job started by @a lte_ref_dl_start ().
+ *
+ *   @param[in]
+ *   @n pJob            Job.
+ *
+ *   @param[out]
+ *   @n pOutLen         Output length in bytes.
+ *
+ *   @return        const UInt32*
+ *   @n Output, valid until @a lte_ref_dl_release (), NULL if it could not
+ *      be computed.
+ * =============================================================================
+ */
+const UInt32* lte_ref_dl_wait (BcpTest_LteRefJob* pJob, UInt32* pOutLen)
+{
+    if (!pJob->bDone)
+    {
+#ifdef _TMS320C6X
+        Semaphore_pend (pJob->semDone, BIOS_WAIT_FOREVER);
+#else
+        pthread_join (pJob->worker, NULL);
+#endif
+        pJob->bDone =   TRUE;
+    }
+
+    *pOutLen    =   pJob->outLen;
+    return (pJob->status == 0) ? pJob->pOut : NULL;
+}
+
+/** ============================================================================
+ *   @n@b lte_ref_dl_release
+ *
+ *   @b Description
+ *   @n Frees a job started by @a lte_ref_dl_start (), once its worker is
+ *      done.
+ *
+ *   @param[in]
+ *   @n pJob            Job, or NULL.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_ref_dl_release (BcpTest_LteRefJob* pJob)
+{
+    UInt32              outLen;
+
+    if (pJob == NULL)
+        return;
+
+    lte_ref_dl_wait (pJob, &outLen);
+#ifdef _TMS320C6X
+    Task_delete (&pJob->hWorker);
+    Semaphore_delete (&pJob->semDone);
+#endif
+    LTE_REF_FREE (pJob->pOut, (outLen + 3) & ~3);
+    LTE_REF_FREE (pJob, sizeof (BcpTest_LteRefJob));
+
+    return;
+}
@@ -0,0 +1,406 @@
+/**
+ *   @file  test_lte_uci.c
+ *
+ *   @brief
+ *      Software reference of the short CQI block code, the (32, O) Reed-Muller
+ *      code of 3GPP TS 36.212 section 5.2.2.6.4, used for CQI of 11 bits or
+ *      less, i.e., when BCP passes the CQI soft bits through
+ *      (cqi_pass_through = 1) instead of decoding them.
+ *
+ *      Both the encoder and the decoder work on a batch of UEs sharing the
+ *      same number of CQI bits. CQI values are held LSB first, bit n of a
+ *      value is o(n), and a codeword is a 32 bit word whose bit i is b(i).
+ *
+ *      The basis sequences M(i, 1) .. M(i, 5) take all 32 values of a 5 bit
+ *      vector v(i) and M(i, 0) is all ones, so for a fixed M(i, 6) ..
+ *      M(i, 10) contribution the code is a first order Reed-Muller code and
+ *      the maximum likelihood decision over o(0) .. o(5) is the largest
+ *      magnitude output of a 32 point Walsh-Hadamard transform. The decoder
+ *      runs one transform per mask hypothesis, two UEs at a time in the two
+ *      16 bit halves of a word.
+ *
+ *      The number of coded symbols of each UCI type on PUSCH (36.212 section
+ *      5.2.2.6) is computed in integer arithmetic, with the beta offsets of
+ *      36.213 tables 8.6.3-1 to 8.6.3-3 held in units of 1/8, which all of
+ *      them are exact multiples of.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+#include "bcp_test_lte.h"
+
+/* Basis sequences of 36.212 table 5.2.2.6.4-1, bit n of entry i is M(i, n) */
+#pragma DATA_SECTION (lteUciRm32Basis, ".testData");
+static const UInt16 lteUciRm32Basis[32] = {
+    0x403, 0x607, 0x749, 0x50D, 0x48F, 0x5D3, 0x755, 0x599,
+    0x69B, 0x65D, 0x6E5, 0x567, 0x7A9, 0x6AB, 0x4B1, 0x6F3,
+    0x277, 0x139, 0x0FB, 0x061, 0x445, 0x60B, 0x591, 0x717,
+    0x3DF, 0x4E3, 0x32D, 0x3AF, 0x175, 0x1FD, 0x7FF, 0x001
+};
+
+/* Codewords of o(0) .. o(5) and of o(6) .. o(10) */
+#pragma DATA_SECTION (lteUciCwLo, ".testData");
+static UInt32       lteUciCwLo[64];
+#pragma DATA_SECTION (lteUciCwHi, ".testData");
+static UInt32       lteUciCwHi[32];
+#pragma DATA_SECTION (lteUciCwBuilt, ".testData");
+static UInt8        lteUciCwBuilt = 0;
+
+/* Beta offsets times 8, indexed by I_offset */
+#pragma DATA_SECTION (lteUciBetaAck8, ".testData");
+static const UInt16 lteUciBetaAck8[16] = {
+    16, 20, 25, 32, 40, 50, 64, 80, 101, 127, 160, 248, 400, 640, 1008, 0
+};
+#pragma DATA_SECTION (lteUciBetaRi8, ".testData");
+static const UInt16 lteUciBetaRi8[16] = {
+    10, 13, 16, 20, 25, 32, 40, 50, 64, 80, 101, 127, 160, 0, 0, 0
+};
+#pragma DATA_SECTION (lteUciBetaCqi8, ".testData");
+static const UInt16 lteUciBetaCqi8[16] = {
+    0, 0, 9, 10, 11, 13, 14, 16, 18, 20, 23, 25, 28, 32, 40, 50
+};
+
+/* Number of bits of the largest Q' below its cap, 110 PRBs x 14 symbols */
+#define     LTE_UCI_RES_BITS                15
+
+/* Combined soft bit saturation, leaves room for the 5 bit transform gain */
+#define     LTE_UCI_SOFT_MAX                1023
+
+/* Packed 16 bit arithmetic on a UE pair, UE a in the lower half */
+#ifdef _TMS320C6X
+#define     LTE_UCI_ADD2(x, y)              _add2 (x, y)
+#define     LTE_UCI_SUB2(x, y)              _sub2 (x, y)
+#else
+#define     LTE_UCI_ADD2(x, y)              ((((x) + (y)) & 0xFFFF) | (((x) & 0xFFFF0000) + ((y) & 0xFFFF0000)))
+#define     LTE_UCI_SUB2(x, y)              ((((x) - (y)) & 0xFFFF) | (((x) & 0xFFFF0000) - ((y) & 0xFFFF0000)))
+#endif
+#define     LTE_UCI_PACK2(a, b)             (((UInt32)(UInt16)(b) << 16) | (UInt16)(a))
+
+/** ============================================================================
+ *   @n@b lte_uci_codeword
+ *
+ *   @b Description
+ *   @n Returns the codeword of o, b(i) being the parity of o & M(i, .).
+ * =============================================================================
+ */
+static UInt32 lte_uci_codeword (UInt32 o)
+{
+    UInt32              i, b, cw = 0;
+
+    for (i = 0; i < 32; i ++)
+    {
+        b   =   lteUciRm32Basis [i] & o;
+        b   ^=  b >> 8;
+        b   ^=  b >> 4;
+        b   ^=  b >> 2;
+        b   ^=  b >> 1;
+        cw  |=  (b & 1) << i;
+    }
+
+    return cw;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_build_codewords
+ *
+ *   @b Description
+ *   @n Fills the partial codeword tables, so that the codeword of o is
+ *      lteUciCwLo[o & 0x3F] ^ lteUciCwHi[o >> 6].
+ * =============================================================================
+ */
+static Void lte_uci_build_codewords (Void)
+{
+    UInt32              o;
+
+    for (o = 0; o < 64; o ++)
+        lteUciCwLo [o]  =   lte_uci_codeword (o);
+    for (o = 0; o < 32; o ++)
+        lteUciCwHi [o]  =   lte_uci_codeword (o << 6);
+    lteUciCwBuilt   =   1;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_rm32_encode
+ *
+ *   @b Description
+ *   @n Encodes the CQI of a batch of UEs with the (32, O) block code. The
+ *      Q_CQI coded bits sent on PUSCH are b(i mod 32).
+ *
+ *   @param[in]
+ *   @n pCqi            CQI value of each UE, O bits LSB first.
+ *
+ *   @param[in]
+ *   @n numUe           Number of UEs.
+ *
+ *   @param[out]
+ *   @n pCode           Codeword of each UE.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_uci_rm32_encode
+(
+    const UInt16*       restrict pCqi,
+    UInt32              numUe,
+    UInt32*             restrict pCode
+)
+{
+    UInt32              n, o;
+
+    if (!lteUciCwBuilt)
+        lte_uci_build_codewords ();
+
+    for (n = 0; n < numUe; n ++)
+    {
+        o           =   pCqi [n];
+        pCode [n]   =   lteUciCwLo [o & 0x3F] ^ lteUciCwHi [(o >> 6) & 0x1F];
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_combine
+ *
+ *   @b Description
+ *   @n Folds the numLlr repeated soft bits of one UE onto the 32 codeword
+ *      positions, saturated to +/- LTE_UCI_SOFT_MAX.
+ * =============================================================================
+ */
+static Void lte_uci_combine
+(
+    const Int8*         pLlr,
+    UInt32              numLlr,
+    Int16*              pSoft
+)
+{
+    Int32               acc [32];
+    UInt32              i;
+
+    for (i = 0; i < 32; i ++)
+        acc [i] =   0;
+    for (i = 0; i < numLlr; i ++)
+        acc [i & 31]    +=  pLlr [i];
+
+    for (i = 0; i < 32; i ++)
+    {
+        if (acc [i] > LTE_UCI_SOFT_MAX)
+            acc [i] =   LTE_UCI_SOFT_MAX;
+        else if (acc [i] < -LTE_UCI_SOFT_MAX)
+            acc [i] =   -LTE_UCI_SOFT_MAX;
+        pSoft [i]   =   (Int16) acc [i];
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_rm32_decode
+ *
+ *   @b Description
+ *   @n Maximum likelihood decoding of the (32, O) block code for a batch of
+ *      UEs.
+ *
+ *      Soft bits are combined onto the 32 codeword positions and placed at
+ *      v(i). For every value h of o(6) .. o(10) the positions covered by the
+ *      h codeword are negated, a 32 point Walsh-Hadamard transform gives the
+ *      correlation with every o(1) .. o(5) codeword, and the sign of the
+ *      largest magnitude output gives o(0).
+ *
+ *   @param[in]
+ *   @n pLlr            numLlr soft bits of each UE, one UE after the other,
+ *                      positive for a 0 bit.
+ *
+ *   @param[in]
+ *   @n numLlr          Number of soft bits per UE, Q_CQI.
+ *
+ *   @param[in]
+ *   @n numUe           Number of UEs.
+ *
+ *   @param[in]
+ *   @n numBits         Number of CQI bits O, 1 to 11.
+ *
+ *   @param[out]
+ *   @n pCqi            Decoded CQI value of each UE.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_uci_rm32_decode
+(
+    const Int8*         restrict pLlr,
+    UInt32              numLlr,
+    UInt32              numUe,
+    UInt8               numBits,
+    UInt16*             restrict pCqi
+)
+{
+    Int16               softA [32], softB [32];
+    UInt32              x [32], y [32];
+    UInt32              numHyp, numCol, h, i, j, k, len, u, mask;
+    Int32               vA, vB, bestA, bestB;
+    UInt32              cqiA, cqiB;
+    UInt32              n;
+
+    if (!lteUciCwBuilt)
+        lte_uci_build_codewords ();
+
+    numHyp  =   (numBits > 6) ? (1u << (numBits - 6)) : 1;
+    numCol  =   (numBits > 6) ? 32 : (1u << (numBits - 1));
+
+    for (n = 0; n < numUe; n += 2)
+    {
+        lte_uci_combine (pLlr + n * numLlr, numLlr, softA);
+        if (n + 1 < numUe)
+            lte_uci_combine (pLlr + (n + 1) * numLlr, numLlr, softB);
+        else
+            memset (softB, 0, sizeof (softB));
+
+        for (i = 0; i < 32; i ++)
+            x [(lteUciRm32Basis [i] >> 1) & 0x1F]   =   LTE_UCI_PACK2 (softA [i], softB [i]);
+
+        bestA   =   -1;
+        bestB   =   -1;
+        cqiA    =   0;
+        cqiB    =   0;
+        for (h = 0; h < numHyp; h ++)
+        {
+            mask    =   lteUciCwHi [h];
+            for (i = 0; i < 32; i ++)
+            {
+                k       =   (lteUciRm32Basis [i] >> 1) & 0x1F;
+                y [k]   =   ((mask >> i) & 1) ? LTE_UCI_SUB2 (0, x [k]) : x [k];
+            }
+
+            for (len = 16; len >= 1; len >>= 1)
+            {
+                for (j = 0; j < 32; j += 2 * len)
+                {
+                    for (k = j; k < j + len; k ++)
+                    {
+                        u           =   y [k];
+                        y [k]       =   LTE_UCI_ADD2 (u, y [k + len]);
+                        y [k + len] =   LTE_UCI_SUB2 (u, y [k + len]);
+                    }
+                }
+            }
+
+            for (u = 0; u < numCol; u ++)
+            {
+                vA  =   (Int16) y [u];
+                vB  =   (Int16) (y [u] >> 16);
+                if (vA > bestA || -vA > bestA)
+                {
+                    bestA   =   (vA < 0) ? -vA : vA;
+                    cqiA    =   (h << 6) | (u << 1) | (vA < 0);
+                }
+                if (vB > bestB || -vB > bestB)
+                {
+                    bestB   =   (vB < 0) ? -vB : vB;
+                    cqiB    =   (h << 6) | (u << 1) | (vB < 0);
+                }
+            }
+        }
+
+        pCqi [n]    =   (UInt16) cqiA;
+        if (n + 1 < numUe)
+            pCqi [n + 1]    =   (UInt16) cqiB;
+    }
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_num_symb
+ *
+ *   @b Description
+ *   @n Returns min (ceil (numBits * numRe * beta8 / (8 * sumKr)), cap).
+ *
+ *      Below the cap the quotient has at most LTE_UCI_RES_BITS bits and is
+ *      found by a fixed length binary search on q * 8 * sumKr < numerator,
+ *      so there is neither a division nor a data dependent branch.
+ * =============================================================================
+ */
+static UInt32 lte_uci_num_symb
+(
+    UInt32              numBits,
+    UInt32              numRe,
+    UInt32              beta8,
+    UInt32              sumKr,
+    UInt32              cap
+)
+{
+    unsigned long long  num = (unsigned long long) (numBits * numRe) * beta8;
+    UInt32              den = sumKr << 3;
+    UInt32              q = 0, t;
+    Int32               b;
+
+    if (num >= (unsigned long long) cap * den)
+        return cap;
+
+    for (b = LTE_UCI_RES_BITS - 1; b >= 0; b --)
+    {
+        t   =   q | (1u << b);
+        q   =   ((unsigned long long) t * den < num) ? t : q;
+    }
+
+    return (num == 0) ? 0 : q + 1;
+}
+
+/** ============================================================================
+ *   @n@b lte_uci_compute_res
+ *
+ *   @b Description
+ *   @n Computes the number of coded symbols Q'ACK, Q'RI and Q'CQI of a batch
+ *      of PUSCH allocations, 36.212 section 5.2.2.6.
+ *
+ *      Q'ACK and Q'RI are capped to 4 M_sc and Q'CQI to the symbols left
+ *      after RI, M_sc N_symb - Q'RI.
+ *
+ *      The results are exact. The single precision float computation this
+ *      replaced, ceil (O M_sc N_symb beta / sumKr), agrees with them while
+ *      the float product O M_sc N_symb beta is below 2^23. Above that its
+ *      rounded quotient (from 2^24 its rounded product too) can make it one
+ *      short or one over, e.g., 63 ACK bits on 109 PRBs x 13 symbols with
+ *      beta 126 and sumKr 31752 give 4252 for an exact 4251. The test
+ *      configurations stay far below, see host/lte_uci_check.c.
+ *
+ *   @param[in/out]
+ *   @n pRes            UCI configuration of each allocation, the number of
+ *                      symbols of each UCI type is filled in.
+ *
+ *   @param[in]
+ *   @n numUe           Number of allocations.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void lte_uci_compute_res
+(
+    BcpTest_LteUciRes*  pRes,
+    UInt32              numUe
+)
+{
+    UInt32              n, numSc, numRe;
+
+    for (n = 0; n < numUe; n ++, pRes ++)
+    {
+        numSc   =   pRes->numPrb * 12;
+        numRe   =   numSc * pRes->numSymb;
+
+        pRes->numAckSubcs   =   lte_uci_num_symb (pRes->numAckBits, numRe, lteUciBetaAck8 [pRes->ackIdx & 0xF],
+                                                  pRes->sumKr, 4 * numSc);
+        pRes->numRiSubcs    =   lte_uci_num_symb (pRes->numRiBits, numRe, lteUciBetaRi8 [pRes->riIdx & 0xF],
+                                                  pRes->sumKr, 4 * numSc);
+        pRes->numCqiSubcs   =   lte_uci_num_symb (pRes->numCqiBits, numRe, lteUciBetaCqi8 [pRes->cqiIdx & 0xF],
+                                                  pRes->sumKr, numRe - pRes->numRiSubcs);
+    }
+
+    return;
+}
@@ -67,6 +67,33 @@ static UInt8    numTrans;
 static UInt8    subfrmIdx;
 #pragma DATA_SECTION (soundFlag, ".testData");
 static UInt8    soundFlag;
+#pragma DATA_SECTION (numLayers, ".testData");
+static UInt8    numLayers;
+
+/* HARQ output LLRs accepted up to LTE_UL_HARQ_LLR_TOL off the reference, for
+ * references taken from fixed point models that round differently. 0 checks
+ * them exactly.
+ */
+#ifndef LTE_UL_HARQ_LLR_TOL
+#define     LTE_UL_HARQ_LLR_TOL             0
+#endif
+
+#ifdef LTE_UL_SIC
+/* PUSCH SIC re-encode configuration */
+#define     LTE_SIC_QFMT                    1       // Q format of the decoded soft bits
+#define     LTE_SIC_SYM_TOL                 4       // Soft symbol tolerance per I/Q component
+#define     LTE_SIC_SEED                    0x2545F491
+
+/* SIC cycle counts, BCP round trip vs. DSP reference */
+#pragma DATA_SECTION (sicNumPkts, ".testData");
+static UInt32   sicNumPkts;
+#pragma DATA_SECTION (sicNumSymb, ".testData");
+static UInt32   sicNumSymb;
+#pragma DATA_SECTION (sicBcpCycles, ".testData");
+static UInt32   sicBcpCycles;
+#pragma DATA_SECTION (sicRefCycles, ".testData");
+static UInt32   sicRefCycles;
+#endif
 
 #pragma DATA_SECTION (numPrbInPusch, ".testData");
 static UInt8 numPrbInPusch[45]={1, 2, 3, 4, 5, 6, 8, 9, 10,12,15,16, 18,20,24,25, 27,30,32,36, 40,45,48,50, 54,60,64,72, 75,80,
@@ -268,24 +295,66 @@ static const UInt16 TurboInterTable[189][3] = {
     {6144	, 263	 ,    480 } 
 };                           
 
-#pragma DATA_SECTION (BETAOFFSET_ACK_INDEX, ".testData");
-float BETAOFFSET_ACK_INDEX[16]={2.0f, 2.5f, 3.125f, 4.0f, 5.0f, 6.25f, 8.0f, 10.0f, 12.625f, 15.875f, 20.0f, 31.0f,  50.0f, 80.0f, 126.0f, 0.f};
-
-#pragma DATA_SECTION (BETAOFFSET_RI_INDEX, ".testData");
-float BETAOFFSET_RI_INDEX[16]={1.25f, 1.625f, 2.0f, 2.5f, 3.125f, 4.0f, 5.0f, 6.250f, 8.0f, 10.0f, 12.625f, 15.875f, 20.0f, 0.f,0.f,0.f};
-
-#pragma DATA_SECTION (BETAOFFSET_CQI_INDEX, ".testData");
-float BETAOFFSET_CQI_INDEX[16]=	{0.f, 0.f, 1.125f, 1.25f,
-		1.375f, 1.625f,1.75f,2.0f, 
-		2.25f, 2.5f, 2.875f, 3.125f,
-		3.5f,4.0f,5.0f, 6.25f};
-
 #pragma DATA_SECTION (harqInput, ".testData");
 static UInt32 harqInput [132];
 
 #pragma DATA_SECTION (harqOutput, ".testData");
 static UInt32 harqOutput [132];
 
+/* SSL input data, read once for all transmissions */
+#pragma DATA_SECTION (lteUlSslIn, ".testData");
+#pragma DATA_ALIGN (lteUlSslIn, 16)
+static UInt8 lteUlSslIn [TX_DATA_BUFFER_SIZE];
+
+/* HARQ input and SSL input data in use */
+#pragma DATA_SECTION (pLteUlHarqIn, ".testData");
+static const UInt32* pLteUlHarqIn = harqInput;
+#pragma DATA_SECTION (pLteUlSslIn, ".testData");
+static const UInt8* pLteUlSslIn = lteUlSslIn;
+
+#ifdef BCP_TEST_BIN_VECTORS
+/* With BCP_TEST_BIN_VECTORS defined the HARQ and SSL inputs are loaded once
+ * from their binary test vectors, converted by tools/vec_conv.c, and used 
+ * in place. The HARQ input vector is a byte stream without the address and
+ * length words of the text file (vec_conv -b -s 2), or words (vec_conv -s 2)
+ * for SIMULATOR_SUPPORT builds.
+ */
+#define LTE_UL_VEC_HARQ_IN                   "..\\..\\lte\\pusch_rdMemIn_0004.bvec"
+#define LTE_UL_VEC_SSL_IN                    "..\\..\\lte\\pusch_sslIn_0004.bvec"
+
+#pragma DATA_SECTION (lteUlHarqInVec, ".testData");
+static BcpTest_Vec lteUlHarqInVec;
+#pragma DATA_SECTION (lteUlSslInVec, ".testData");
+static BcpTest_Vec lteUlSslInVec;
+#endif
+
+/* One transmission per redundancy version at most */
+#define LTE_UL_MAX_NUM_TRANS                 4
+
+/* Test vectors parsed on the first packet and kept resident for the rest of
+ * the test, so that building a packet does no file I/O. The parameters are
+ * held in the test configuration variables above; the Rx SNR file is held
+ * here, one row per transmission.
+ */
+typedef struct _LteUlTestVecs
+{
+    Bool                bLoaded;
+    float               snrEven [LTE_UL_MAX_NUM_TRANS];
+    float               snrOdd [LTE_UL_MAX_NUM_TRANS];
+    UInt8               subfrmIdx [LTE_UL_MAX_NUM_TRANS];
+    UInt32              sslInLen;
+} LteUlTestVecs;
+
+#pragma DATA_SECTION (lteUlTestVecs, ".testData");
+static LteUlTestVecs lteUlTestVecs;
+
+/* Code blocks of the packet last built, for the test statistics */
+#pragma DATA_SECTION (lteUlNumCodeBlks, ".testData");
+static UInt32 lteUlNumCodeBlks;
+
+/* Bytes of the RD header, ahead of the LLRs of each output packet */
+#define LTE_UL_RD_HDR_BYTES           16
+
 /* Reference Output Data for the test */
 /* Output packet 1 payload - CQI bits */
 #define LTE_UL_OUTPUT_PKT_1_WRD_SIZE  5
@@ -506,6 +575,35 @@ static UInt32 lte_ul_output_mem[132] = {
 0x00000000};
 
 
+/* Test configuration parameters. The allocation is given as the range of
+ * PRBs allocated.
+ */
+#pragma DATA_SECTION (allocRange, ".testData");
+static BcpTest_ParamRange   allocRange;
+
+#pragma DATA_SECTION (lteUlParams, ".testData");
+static const BcpTest_ParamDesc lteUlParams[] = 
+{
+    {"numOFDM",             BcpTest_ParamType_UInt8,    &numSymbPerSumbfrm, 1,  14},
+    {"SoundEn",             BcpTest_ParamType_UInt8,    &soundFlag,         0,  1},
+    {"TBS",                 BcpTest_ParamType_UInt32,   &tbSize,            1,  391656},
+    {"RNTI",                BcpTest_ParamType_UInt16,   &rnti,              0,  0xFFFF},
+    {"CellId",              BcpTest_ParamType_UInt16,   &cellID,            0,  503},
+    {"Alloc",               BcpTest_ParamType_Range,    &allocRange,        0,  99},
+    {"ModSch",              BcpTest_ParamType_UInt8,    &modulation,        1,  8},
+    {"AckBits",             BcpTest_ParamType_UInt8,    &numAckBits,        0,  0xFF},
+    {"McsACKoff",           BcpTest_ParamType_UInt8,    &ackBeta,           0,  15},
+    {"RiBits",              BcpTest_ParamType_UInt8,    &numRiBits,         0,  0xFF},
+    {"McsRIoff",            BcpTest_ParamType_UInt8,    &riBeta,            0,  15},
+    {"CqiBits",             BcpTest_ParamType_UInt8,    &numCqiBits,        0,  0xFF},
+    {"McsCQIoff",           BcpTest_ParamType_UInt8,    &cqiBeta,           0,  15},
+    {"numTrans",            BcpTest_ParamType_UInt8,    &numTrans,          1,  LTE_UL_MAX_NUM_TRANS},
+    {"NumLayers",           BcpTest_ParamType_UInt8,    &numLayers,         1,  LTE_MAX_NUM_LAYERS}
+};
+
+#pragma DATA_SECTION (lteUlParamSchema, ".testData");
+static BcpTest_ParamSchema  lteUlParamSchema;
+
 /** ============================================================================
  *   @n@b read_test_config
  *
@@ -516,127 +614,27 @@ static UInt32 lte_ul_output_mem[132] = {
  *   @param[in]  
  *   @n fp              Test configuration file handle.
  * 
- *   @return        
- *   @n None.
+ *   @return        Int32
+ *   @n 0       -   Test configuration read.
+ *
+ *   @n -1      -   Malformed or out of range parameter.
  * =============================================================================
  */
-static Void read_test_config(FILE* fp)
+static Int32 read_test_config(FILE* fp)
 {
-	Char            lineBuf[300];
-	Char*           ptrBuf;
-	Int32           i, j;
-	
-    while (fgets (lineBuf, 300, fp) != NULL)
-	{
-        if ((ptrBuf = strstr(lineBuf, "="))!=NULL)
-		{
-			ptrBuf ++;
-           
-			if (strstr(lineBuf,"numOFDM")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numSymbPerSumbfrm = i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"SoundEn")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				soundFlag = i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"TBS")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				tbSize = i;
-				continue;
-			}
-		
-			if (strstr(lineBuf,"RNTI")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				rnti = (UInt8) i;
-				continue;
-
-			}
-
-			if (strstr(lineBuf,"CellId")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				cellID = (UInt8) i;
-				continue;
-
-			}
-
-			if (strstr(lineBuf,"Alloc")!=NULL)
-			{
-				sscanf(ptrBuf,"%d:%d", &i, &j);
-				numSubcarrier = (j - i + 1) * 12;
-				continue;
-
-			}
-
-			if (strstr(lineBuf,"ModSch")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				modulation = i;
-				continue;
-			}
-
-
-			if (strstr(lineBuf,"AckBits")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numAckBits = i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"McsACKoff")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				ackBeta = (UInt8) i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"RiBits")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numRiBits = (UInt16) i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"McsRIoff")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				riBeta = (UInt8) i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"CqiBits")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numCqiBits = (UInt8) i;
-				continue;
-			}
-
-			if (strstr(lineBuf,"McsCQIoff")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				cqiBeta = (UInt8) i;
-				continue;
-			}
+    if (lteUlParamSchema.numParams == 0 &&
+        param_schema_init (&lteUlParamSchema, lteUlParams, sizeof (lteUlParams) / sizeof (lteUlParams[0])) < 0)
+        return -1;
 
-			if (strstr(lineBuf,"numTrans")!=NULL)
-			{
-				sscanf(ptrBuf,"%d", &i);
-				numTrans = (UInt8) i;
-				continue;
-			}
-		}
-	}
+    /* No allocation unless one is given */
+    allocRange.first    =   0;
+    allocRange.last     =   -1;
+    if (param_parse_file (&lteUlParamSchema, fp) < 0)
+        return -1;
+    if (allocRange.last >= allocRange.first)
+        numSubcarrier   =   (UInt16) ((allocRange.last - allocRange.first + 1) * 12);
 
-    return;
+    return 0;
 }
 
 /** ============================================================================
@@ -767,42 +765,23 @@ Void compute_uciBits
 	UInt16*                 pNumCqiSubcs
 )
 {
-	UInt32          sumKr, temp1;
-	float           temp;
-	UInt16          cqiL;
-	
-	sumKr = pCodeBlkParams->codeBkSizeKm * pCodeBlkParams->numCodeBksKm + pCodeBlkParams->numCodeBksKp * pCodeBlkParams->codeBkSizeKp;
-					
-	temp = numAckBits * numPrb * 12 * numOFDMsym * BETAOFFSET_ACK_INDEX[ackIdx];
-	temp = (float) ceil(temp /(float) sumKr);
-	temp1= (UInt32) temp;
-							
-	if (temp1 < (UInt32)(4 * numPrb * 12))
-		* pNnumAckSubcs = temp1;
-	else
-		* pNnumAckSubcs = 4 * numPrb * 12;
-
-	temp = numRiBits * numPrb * 12 * numOFDMsym * BETAOFFSET_RI_INDEX[riIdx];
-	temp = (float) ceil(temp /(float) sumKr);
-	temp1= (UInt32) temp;
-	if (temp1 < (UInt32)(4 * numPrb * 12))
-		*pNumRiSubcs = temp1;
-	else
-		*pNumRiSubcs = 4 * numPrb * 12 ;
-	
-
-//	if (numCqiBits <= 11)
-		cqiL  = 0;  
-//	else cqiL = 8;
-
-	temp = (numCqiBits + cqiL) * numPrb * 12 * numOFDMsym * BETAOFFSET_CQI_INDEX[cqiIdx] ;
-	temp = (float) ceil(temp /(float) sumKr);
-	temp1= (UInt32) temp;
-
-	if (temp1 < (numPrb * 12  * numOFDMsym  - (*pNumRiSubcs)) )
-		* pNumCqiSubcs  = temp1;
-	else
-		* pNumCqiSubcs  = numPrb * 12 * numOFDMsym  - (*pNumRiSubcs);
+    BcpTest_LteUciRes       uciRes;
+
+    uciRes.sumKr        =   pCodeBlkParams->codeBkSizeKm * pCodeBlkParams->numCodeBksKm + pCodeBlkParams->numCodeBksKp * pCodeBlkParams->codeBkSizeKp;
+    uciRes.numPrb       =   numPrb;
+    uciRes.numSymb      =   numOFDMsym;
+    uciRes.numAckBits   =   numAckBits;
+    uciRes.ackIdx       =   ackIdx;
+    uciRes.numRiBits    =   numRiBits;
+    uciRes.riIdx        =   riIdx;
+    uciRes.numCqiBits   =   numCqiBits;
+    uciRes.cqiIdx       =   cqiIdx;
+
+    lte_uci_compute_res (&uciRes, 1);
+
+    *pNnumAckSubcs      =   uciRes.numAckSubcs;
+    *pNumRiSubcs        =   uciRes.numRiSubcs;
+    *pNumCqiSubcs       =   uciRes.numCqiSubcs;
 }
 
 /** ============================================================================
@@ -1128,7 +1107,7 @@ static Void prepare_lte_rdhdr_cfg
         pRdHdrCfg->enable_harq_input        =   0;
 
     pRdHdrCfg->enable_harq_output           =   1;
-    pRdHdrCfg->harq_input_address           =   convert_coreLocalToGlobalAddr ((UInt32)harqInput);
+    pRdHdrCfg->harq_input_address           =   convert_coreLocalToGlobalAddr ((UInt32)pLteUlHarqIn);
     pRdHdrCfg->harq_output_address          =   convert_coreLocalToGlobalAddr ((UInt32)harqOutput);
     pRdHdrCfg->init_cb_flowId               =   0;
     pRdHdrCfg->flowId_hi                    =   0;
@@ -1160,6 +1139,169 @@ static Void prepare_tmhdr_cfg (Bcp_TmHdrCfg* pTmHdrCfg)
     return;
 }
 
+/** ============================================================================
+ *   @n@b load_test_vecs
+ *
+ *   @b Description
+ *   @n Parses the test configuration, the Rx SNR of each transmission and the
+ *      HARQ and SSL inputs, and keeps them resident in @a lteUlTestVecs for
+ *      all packets of the test, until @a release_test_vecs () is called.
+ *
+ *   @return        Int32
+ *   @n 0       -   Test vectors loaded.
+ *
+ *   @n -1      -   Error reading the test vectors.
+ * =============================================================================
+ */
+static Int32 load_test_vecs (Void)
+{
+	FILE*                       pTestCfgFile;
+    Char                        lineBuf [256];
+	Char*                       ptrBuf;
+    UInt32                      temp, harq_address, num_words, readTemp;
+	UInt8                       index;
+
+    /* Get the test configuration from the file. */
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("Reading test configuration ... \n");
+#endif
+
+    if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_paramters_UV620.txt","r")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Failed to open test configuration file: ..\..\lte\pusch_paramters_UV620.txt\n");
+#endif
+        return -1;
+    }
+    numLayers = 1;
+    if (read_test_config(pTestCfgFile) < 0)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Invalid test configuration: ..\..\lte\pusch_paramters_UV620.txt\n");
+#endif
+        fclose (pTestCfgFile);
+        return -1;
+    }
+    fclose (pTestCfgFile);
+    soundFlag = 0;
+
+    /* Rx SNR of each transmission: the even slot SNR and subframe on one 
+     * line, the odd slot SNR on the next.
+     */
+    if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_paramters_UV620_RxSNR.txt","r")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Failed to open test configuration Rx SNR file: ..\..\lte\pusch_paramters_UV620_RxSNR.txt\n");
+#endif
+        return -1;
+    }
+    for (index = 0; index < numTrans; index ++)
+    {
+        if (fgets(lineBuf,256,pTestCfgFile) == NULL || 
+            (ptrBuf = strstr(lineBuf,"subframe:")) == NULL)
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Rx SNR missing for transmission %d \n", index);
+#endif
+            fclose (pTestCfgFile);
+            return -1;
+        }
+        sscanf(lineBuf,"%f", &lteUlTestVecs.snrEven [index]);
+        ptrBuf += 10;
+        sscanf(ptrBuf,"%d", &readTemp);
+        lteUlTestVecs.subfrmIdx [index] = (UInt8)readTemp;
+
+        if (fgets(lineBuf,256,pTestCfgFile) == NULL)
+        {
+            fclose (pTestCfgFile);
+            return -1;
+        }
+        sscanf(lineBuf,"%f", &lteUlTestVecs.snrOdd [index]);
+    }
+    fclose (pTestCfgFile);
+
+    /* Initialize the memory block from which RD will read HARQ Input Data,
+     * and read the SSL input data, the same for every transmission.
+     */
+#ifdef BCP_TEST_BIN_VECTORS
+    if (vec_load (LTE_UL_VEC_HARQ_IN, &lteUlHarqInVec) < 0 ||
+        vec_load (LTE_UL_VEC_SSL_IN, &lteUlSslInVec) < 0)
+    {
+        vec_release (&lteUlHarqInVec);
+        return -1;
+    }
+    pLteUlHarqIn            =   lteUlHarqInVec.pWords;
+    pLteUlSslIn             =   (const UInt8 *) lteUlSslInVec.pWords;
+    lteUlTestVecs.sslInLen  =   lteUlSslInVec.numWords * 4;
+#else
+    if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_rdMemIn_0004.dat","r")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Cannot open HARQ data input file: ..\..\lte\pusch_rdMemIn_0004.dat\n");
+#endif
+        return -1;
+    }
+    fscanf(pTestCfgFile, "0x%x\n", &harq_address);
+    fscanf(pTestCfgFile, "0x%x\n", &num_words);
+    harq_address	= convert_coreLocalToGlobalAddr ((UInt32)harqInput);
+    temp = 0;
+#ifndef SIMULATOR_SUPPORT
+    read_harq_data_from_file (pTestCfgFile, (UInt8*)(harq_address), &temp);
+#else
+    /* Simulator bug workaround: BCP TM module endian handling not correct. */
+    read_data_from_file (pTestCfgFile, (UInt8*)(harq_address), &temp);
+#endif
+    if (temp != num_words * 4)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Error initializing HARQ Input \n");
+#endif
+        fclose (pTestCfgFile);
+        return -1;
+    }
+    fclose (pTestCfgFile);
+
+    if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_sslIn_0004.dat","r")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Cannot open data input file: ..\..\lte\pusch_sslIn_0004.dat\n");
+#endif
+        return -1;
+    }
+    lteUlTestVecs.sslInLen  =   0;
+    read_data_from_file (pTestCfgFile, lteUlSslIn, &lteUlTestVecs.sslInLen);
+    fclose (pTestCfgFile);
+#endif
+
+    lteUlTestVecs.bLoaded   =   TRUE;
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b release_test_vecs
+ *
+ *   @b Description
+ *   @n Frees the test vectors loaded by @a load_test_vecs (). They are parsed
+ *      again on the next packet built.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+static Void release_test_vecs (Void)
+{
+#ifdef BCP_TEST_BIN_VECTORS
+    vec_release (&lteUlHarqInVec);
+    vec_release (&lteUlSslInVec);
+    pLteUlHarqIn            =   harqInput;
+    pLteUlSslIn             =   lteUlSslIn;
+#endif
+    lteUlTestVecs.bLoaded   =   FALSE;
+
+    return;
+}
+
 /** ============================================================================
  *   @n@b add_test_config_data
  *
@@ -1185,11 +1327,7 @@ static Void prepare_tmhdr_cfg (Bcp_TmHdrCfg* pTmHdrCfg)
  */
 static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 {
-	FILE*                       pTestCfgFile;
-	FILE*                       pTestSnrCfgFile;
-    Char                        lineBuf [256];
-	Char*                       ptrBuf;
-    UInt32                      dataBufferLen, tmpLen, temp, harq_address, num_words;
+    UInt32                      dataBufferLen, tmpLen;
     BcpTest_LteCBParams*        pCodeBlkParams;
     BcpTest_RateMatchParams*    pRmParams;
     UInt32                      lteChanType, cInit;
@@ -1199,12 +1337,16 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     Bcp_SslHdr_LteCfg           sslHdrCfg;
     Bcp_RdHdr_LteCfg            rdHdrCfg;
 	float                       noiseVar;
-	UInt32                      numChannelBits, readTemp;
+	UInt32                      numChannelBits, sslInLen;
 	UInt8                       numCqiPayload;
 	UInt8                       uciFlag, harqFlag,   cqiPassThroughFlag, index;
 	UInt16                      numCqiOutBits, cellIDTemp;
 	UInt8                       rvOrder[4]={0,2,1,3};
 
+    /* Parse the test vectors on the first packet only */
+    if (!lteUlTestVecs.bLoaded && load_test_vecs () < 0)
+        return -1;
+
     /* Allocate space for test configuration */
     if ((pCodeBlkParams = Bcp_osalMalloc (sizeof (BcpTest_LteCBParams), FALSE)) == NULL)
     {
@@ -1224,24 +1366,9 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     }
     memset (pRmParams, 0, sizeof (BcpTest_RateMatchParams));
     
-    /* Get the test configuration from the file. */
-#ifdef BCP_TEST_DEBUG
-    Bcp_osalLog ("Reading test configuration ... \n");
-#endif
-
-    if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_paramters_UV620.txt","r")) == NULL)
-    {
-#ifdef BCP_TEST_DEBUG
-        Bcp_osalLog ("Failed to open test configuration file: ..\..\lte\pusch_paramters_UV620.txt\n");
-#endif
-        return -1;
-    }
-    read_test_config(pTestCfgFile);
-    fclose (pTestCfgFile);
-
     /* Get the code block params */
-    soundFlag = 0;
     compute_cbparams_ref (tbSize, pCodeBlkParams);
+    lteUlNumCodeBlks    =   pCodeBlkParams->numCodeBks;
 
     if (numCqiBits)
         uciFlag = 1;
@@ -1249,35 +1376,19 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
         uciFlag = 0;
     cellIDTemp = cellID;
 
-    if ((pTestSnrCfgFile = fopen("..\\..\\lte\\pusch_paramters_UV620_RxSNR.txt","r")) == NULL)
-    {
-#ifdef BCP_TEST_DEBUG
-        Bcp_osalLog ("Failed to open test configuration Rx SNR file: ..\..\lte\pusch_paramters_UV620_RxSNR.txt\n");
-#endif
-        return -1;
-    }
-
     /* To begin with, lets test LTE PUSCH channel */
     radioStd    =   Bcp_RadioStd_LTE; 
     lteChanType =   LTE_PUSCH;
-    
+    sslInLen    =   lteUlTestVecs.sslInLen;
+
     /* Initialize our data buffer length running counter */
     dataBufferLen   =   0;
 
     for (index = 0; index < numTrans; index ++)
     {
-        fgets(lineBuf,256,pTestSnrCfgFile);
-        sscanf(lineBuf,"%f", &snrEven);
-        ptrBuf = strstr(lineBuf,"frame:");
-        ptrBuf += 7;
-        sscanf(ptrBuf,"%d", &readTemp);
-        ptrBuf = strstr(lineBuf,"subframe:");
-        ptrBuf += 10;
-        sscanf(ptrBuf,"%d", &readTemp);
-        subfrmIdx = (UInt8)readTemp;
-
-        fgets(lineBuf,256,pTestSnrCfgFile);
-        sscanf(lineBuf,"%f", &snrOdd);
+        snrEven     =   lteUlTestVecs.snrEven [index];
+        snrOdd      =   lteUlTestVecs.snrOdd [index];
+        subfrmIdx   =   lteUlTestVecs.subfrmIdx [index];
 
         if (index == 0)
             continue;                
@@ -1323,15 +1434,16 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
             cqiPassThroughFlag = 0;
         }
         
-        numChannelBits = numSubcarrier * numSymbPerSumbfrm * modulation;
-        numChannelBits -= (numRiSubcs * modulation);
-        numChannelBits -= (numCqiSubcs * modulation);
-        numCqiOutBits = numCqiSubcs *modulation;
+        /* Each RE carries modulation * numLayers bits in split mode */
+        numChannelBits = numSubcarrier * numSymbPerSumbfrm * modulation * numLayers;
+        numChannelBits -= (numRiSubcs * modulation * numLayers);
+        numChannelBits -= (numCqiSubcs * modulation * numLayers);
+        numCqiOutBits = numCqiSubcs * modulation * numLayers;
         rvIndex = rvOrder[index];
 
         compute_rmGamma_ref (numChannelBits,
                             modulation,
-                            1, 
+                            numLayers, 
                             pCodeBlkParams,
                             rvIndex,
                             0, 
@@ -1394,7 +1506,7 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
 				}
             }
 
-            prepare_sslhdr_cfg (&sslHdrCfg, radioStd, allocIdx, modulation, numSymbPerSumbfrm, 1, rms, 2, 
+            prepare_sslhdr_cfg (&sslHdrCfg, radioStd, allocIdx, modulation, numSymbPerSumbfrm, numLayers, rms, 2, 
                                 cInit, numRiSubcs, numAckSubcs, scale1, scale2);
         }
         if (Bcp_addLTE_SSLHeader (&sslHdrCfg, pDataBuffer, &tmpLen) < 0)
@@ -1421,34 +1533,6 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
         dataBufferLen	+=	tmpLen;
         tmpLen			=	0;
 
-        /* Also, initialize the memory block from which RD will read HARQ Input Data */
-        if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_rdMemIn_0004.dat","r")) == NULL)
-        {
-#ifdef BCP_TEST_DEBUG
-            Bcp_osalLog ("Cannot open HARQ data input file: ..\..\lte\pusch_rdMemIn_0004.dat\n");
-#endif
-            return -1;
-        }
-	    fscanf(pTestCfgFile, "0x%x\n", &harq_address);
-        fscanf(pTestCfgFile, "0x%x\n", &num_words);
-        harq_address	= convert_coreLocalToGlobalAddr ((UInt32)harqInput);
-        temp = 0;
-#ifndef SIMULATOR_SUPPORT
-        read_harq_data_from_file (pTestCfgFile, (UInt8*)(harq_address), &temp);
-#else
-        /* Simulator bug workaround: BCP TM module endian handling not correct. */
-        read_data_from_file (pTestCfgFile, (UInt8*)(harq_address), &temp);
-#endif
-        if (temp != num_words * 4)
-        {
-#ifdef BCP_TEST_DEBUG
-            Bcp_osalLog ("Error initializing HARQ Input \n");
-#endif
-            fclose (pTestCfgFile);
-            return -1;
-        }
-        fclose (pTestCfgFile);
-
         /* Header 4: Traffic Manager header */
         prepare_tmhdr_cfg (&tmHdrCfg);
         if (Bcp_addTMHeader (&tmHdrCfg, pDataBuffer, &tmpLen) < 0)
@@ -1469,18 +1553,10 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
         dataBufferLen	+=	0;
 
         /* Finally add the data to the packet in the same order as the headers */
-        if ((pTestCfgFile = fopen("..\\..\\lte\\pusch_sslIn_0004.dat","r")) == NULL)
-        {
-#ifdef BCP_TEST_DEBUG
-            Bcp_osalLog ("Cannot open data input file: ..\..\lte\pusch_sslIn_0004.dat\n");
-#endif
-            return -1;
-        }
-        read_data_from_file (pTestCfgFile, pDataBuffer, &dataBufferLen);
-        fclose (pTestCfgFile);
+        memcpy (pDataBuffer, pLteUlSslIn, sslInLen);
+        pDataBuffer     +=  sslInLen;
+        dataBufferLen   +=  sslInLen;
     }
-       
-    fclose (pTestSnrCfgFile);
 
     Bcp_osalFree (pRmParams, sizeof (BcpTest_RateMatchParams), FALSE);
     Bcp_osalFree (pCodeBlkParams, sizeof (BcpTest_LteCBParams), FALSE);
@@ -1489,12 +1565,731 @@ static Int32 add_test_config_data (Bcp_DrvHandle hBcp, UInt8*  pDataBuffer)
     return dataBufferLen;
 }
 
+#ifdef LTE_UL_SIC
 /** ============================================================================
- *   @n@b test_lte_ul
+ *   @n@b prepare_sic_enchdr_cfg
  *
  *   @b Description
- *   @n Sets up the parameters required and runs an LTE Uplink (UL) test case.
- *
+ *   @n Sets up the Encoder header for a PUSCH SIC packet. The turbo encoder
+ *      is only used to re-encode hard decoded bits (LTE_PUSCH_SIC_HARD).
+ * =============================================================================
+ */
+static Void prepare_sic_enchdr_cfg 
+(
+    Bcp_EncHdrCfg*              pEncHdrCfg, 
+    UInt32                      lteChanType, 
+    BcpTest_LteCBParams*        pCodeBlkParams
+)
+{
+    UInt32                      i;
+
+    pEncHdrCfg->local_hdr_len       =   3;    
+    if (lteChanType == LTE_PUSCH_SIC_HARD)
+        pEncHdrCfg->turbo_conv_sel  =   1;
+    else
+        pEncHdrCfg->turbo_conv_sel  =   0;
+    pEncHdrCfg->scr_crc_en          =   0;  //Dont add CRC
+    pEncHdrCfg->code_rate_flag      =   0;
+
+    if (pCodeBlkParams->numCodeBksKm == 0)
+    {
+        pEncHdrCfg->blockCfg[0].block_size      =   pCodeBlkParams->codeBkSizeKp;
+        pEncHdrCfg->blockCfg[0].num_code_blks   =   pCodeBlkParams->numCodeBksKp;
+        pEncHdrCfg->blockCfg[0].intvpar0        =   pCodeBlkParams->f1Kp;
+        pEncHdrCfg->blockCfg[0].intvpar1        =   pCodeBlkParams->f2Kp;
+
+        pEncHdrCfg->blockCfg[1].block_size      =   0;
+        pEncHdrCfg->blockCfg[1].num_code_blks   =   0;
+        pEncHdrCfg->blockCfg[1].intvpar0        =   0;
+        pEncHdrCfg->blockCfg[1].intvpar1        =   0;
+    }
+    else
+    {
+        pEncHdrCfg->blockCfg[0].block_size      =   pCodeBlkParams->codeBkSizeKm;
+        pEncHdrCfg->blockCfg[0].num_code_blks   =   pCodeBlkParams->numCodeBksKm;
+        pEncHdrCfg->blockCfg[0].intvpar0        =   pCodeBlkParams->f1Km;
+        pEncHdrCfg->blockCfg[0].intvpar1        =   pCodeBlkParams->f2Km;
+
+        pEncHdrCfg->blockCfg[1].block_size      =   pCodeBlkParams->codeBkSizeKp;
+        pEncHdrCfg->blockCfg[1].num_code_blks   =   pCodeBlkParams->numCodeBksKp;
+        pEncHdrCfg->blockCfg[1].intvpar0        =   pCodeBlkParams->f1Kp;
+        pEncHdrCfg->blockCfg[1].intvpar1        =   pCodeBlkParams->f2Kp;
+    }
+    pEncHdrCfg->blockCfg[2].block_size          =   0;
+    pEncHdrCfg->blockCfg[2].num_code_blks       =   0;
+    pEncHdrCfg->blockCfg[2].intvpar0            =   0;
+    pEncHdrCfg->blockCfg[2].intvpar1            =   0;
+
+    for (i = 0; i < 3; i ++)
+    {
+        pEncHdrCfg->blockCfg[i].intvpar2        =   0;
+        pEncHdrCfg->blockCfg[i].intvpar3        =   0;
+    }
+
+    return;        
+}
+
+/** ============================================================================
+ *   @n@b prepare_sic_rmhdr_cfg
+ *
+ *   @b Description
+ *   @n Sets up the LTE Rate matching header for a PUSCH SIC packet. 
+ * =============================================================================
+ */
+static Void prepare_sic_rmhdr_cfg 
+(
+    Bcp_RmHdr_LteCfg*           pLteRmHdrCfg, 
+    UInt32                      lteChanType,
+    BcpTest_LteCBParams*        pCodeBlkParams, 
+    BcpTest_RateMatchParams*    pRmParams
+)
+{
+    pLteRmHdrCfg->local_hdr_len             =   6;        
+    if (lteChanType == LTE_PUSCH_SIC)
+        pLteRmHdrCfg->channel_type          =   0;        
+    else
+        pLteRmHdrCfg->channel_type          =   1;        
+    pLteRmHdrCfg->input_bit_format          =   1;        
+    pLteRmHdrCfg->output_bit_format         =   1;
+    pLteRmHdrCfg->num_filler_bits_f         =   pCodeBlkParams->numFillerBits;        
+
+    if (pCodeBlkParams->numCodeBksKm == 0)
+    {
+        pLteRmHdrCfg->num_code_blocks_c1    =   pCodeBlkParams->numCodeBksKp;        
+        pLteRmHdrCfg->block_size_k1         =   pCodeBlkParams->codeBkSizeKp;        
+        pLteRmHdrCfg->num_code_blocks_c2    =   0;        
+        pLteRmHdrCfg->block_size_k2         =   0;        
+
+        pLteRmHdrCfg->rv_start_column1      =   pRmParams->rvKp;        
+        pLteRmHdrCfg->rv_start_column2      =   0;        
+        pLteRmHdrCfg->param_ncb1_column     =   pRmParams->NcbKpCol;        
+        pLteRmHdrCfg->param_ncb1_row        =   pRmParams->NcbKpRow;        
+        pLteRmHdrCfg->param_ncb2_column     =   0;        
+        pLteRmHdrCfg->param_ncb2_row        =   0;        
+    }
+    else
+    {
+        pLteRmHdrCfg->num_code_blocks_c1    =   pCodeBlkParams->numCodeBksKm;        
+        pLteRmHdrCfg->block_size_k1         =   pCodeBlkParams->codeBkSizeKm;        
+        pLteRmHdrCfg->num_code_blocks_c2    =   pCodeBlkParams->numCodeBksKp;        
+        pLteRmHdrCfg->block_size_k2         =   pCodeBlkParams->codeBkSizeKp;        
+
+        pLteRmHdrCfg->rv_start_column1      =   pRmParams->rvKm;        
+        pLteRmHdrCfg->rv_start_column2      =   pRmParams->rvKp;        
+        pLteRmHdrCfg->param_ncb1_column     =   pRmParams->NcbKmCol;        
+        pLteRmHdrCfg->param_ncb1_row        =   pRmParams->NcbKmRow;        
+        pLteRmHdrCfg->param_ncb2_column     =   pRmParams->NcbKpCol;        
+        pLteRmHdrCfg->param_ncb2_row        =   pRmParams->NcbKpRow;        
+    }
+    pLteRmHdrCfg->num_code_blocks_ce1       =   (pCodeBlkParams->numCodeBks - pRmParams->Gamma);        
+    pLteRmHdrCfg->block_size_e1             =   pRmParams->E0;        
+    pLteRmHdrCfg->num_code_blocks_ce2       =   pRmParams->Gamma;        
+    pLteRmHdrCfg->block_size_e2             =   pRmParams->E1;        
+
+    return;        
+}
+
+/** ============================================================================
+ *   @n@b prepare_sic_modhdr_cfg
+ *
+ *   @b Description
+ *   @n Sets up the Modulation engine header for a PUSCH SIC packet, i.e., a
+ *      soft modulator over the whole allocation (1 or 2 layers) with no UCI.
+ *
+ *   @param[out]  
+ *   @n pModHdrCfg      Modulation engine header configuration.
+ * 
+ *   @param[in]  
+ *   @n allocIdx        Index of the number of PRBs allocated in numPrbInPusch.
+ * 
+ *   @param[in]  
+ *   @n cinit           Scrambler second shift register initial value
+ * 
+ *   @return        
+ *   @n None
+ * =============================================================================
+ */
+static Void prepare_sic_modhdr_cfg 
+(
+    Bcp_ModHdrCfg*      pModHdrCfg,
+    UInt8               allocIdx, 
+    UInt32              cinit
+)
+{
+    pModHdrCfg->local_hdr_len   =   4;        
+    pModHdrCfg->sh_mod_sel      =   Bcp_ModulationMode_Soft;        
+    pModHdrCfg->jack_bit        =   0;        
+    if (modulation == 1)
+        pModHdrCfg->mod_type_sel=   Bcp_ModulationType_BPSK;
+    else
+        pModHdrCfg->mod_type_sel=   (Bcp_ModulationType)(modulation/2);
+    pModHdrCfg->uva_val         =   rms;          
+    pModHdrCfg->scr_en          =   1;        
+
+    pModHdrCfg->rmux_ln         =   allocIdx;        
+    pModHdrCfg->b_table_index   =   gind_row_index(12 * numPrbInPusch[allocIdx] * numLayers * modulation);        
+    pModHdrCfg->cmux_ln         =   (Bcp_CmuxLength) (numSymbPerSumbfrm-9);        
+    pModHdrCfg->q_format        =   (Bcp_QFormat) LTE_SIC_QFMT;        
+    pModHdrCfg->cqi_ln          =   0;        
+    pModHdrCfg->ri_ln           =   0;        
+    pModHdrCfg->ack_ln          =   0;        
+    pModHdrCfg->cinit_p2        =   cinit;        
+    if (numLayers == 1)
+        pModHdrCfg->split_mode_en   =   0;        
+    else
+        pModHdrCfg->split_mode_en   =   1;        
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b add_sic_config_data
+ *
+ *   @b Description
+ *   @n Builds a PUSCH SIC packet, i.e., Global, (CRC), Encoder, Rate matching,
+ *      Modulation and TM headers followed by the decoded bits: the transport
+ *      block for LTE_PUSCH_SIC_HARD, or the soft bits for LTE_PUSCH_SIC.
+ *
+ *   @return        Int32
+ *   @n >0      -   Number of bytes of data (payload + header configuration) added 
+ *                  to the data buffer.
+ *
+ *   @n -1      -   Error populating the data buffer.
+ * =============================================================================
+ */
+static Int32 add_sic_config_data 
+(
+    UInt8*                      pDataBuffer, 
+    UInt32                      lteChanType,
+    BcpTest_LteCBParams*        pCodeBlkParams,
+    BcpTest_RateMatchParams*    pRmParams,
+    UInt8                       allocIdx,
+    UInt32                      cInit,
+    UInt8*                      pPayload,
+    UInt32                      payloadLen
+)
+{
+    UInt8*                      pStartDataBuffer;
+    UInt32                      dataBufferLen, tmpLen;
+    Bcp_GlobalHdrCfg            bcpGlblHdrCfg;
+    Bcp_CrcHdrCfg               crcHdrCfg;
+    Bcp_EncHdrCfg               encHdrCfg;
+    Bcp_RmHdr_LteCfg            lteRmHdrCfg;
+    Bcp_ModHdrCfg               modHdrCfg;
+    Bcp_TmHdrCfg                tmHdrCfg;
+
+    /* Save the start pointer and leave room for the Global header */
+    pStartDataBuffer    =   pDataBuffer;
+    pDataBuffer 	    +=	8;
+    dataBufferLen	    =	8;
+    tmpLen			    =	0;
+
+    /* Hard decoded transport block needs its CRC back */
+    if (lteChanType == LTE_PUSCH_SIC_HARD)
+    {
+        prepare_crchdr_cfg (&crcHdrCfg, Bcp_RadioStd_LTE, tbSize, pCodeBlkParams->numFillerBits, 0, 0, 0, 0, 0, 0, 0, NULL);
+        if (Bcp_addCRCHeader (&crcHdrCfg, pDataBuffer, &tmpLen) < 0)
+        {
+#ifdef BCP_TEST_DEBUG            
+            Bcp_osalLog ("Failed to add CRC Header to packet \n");
+#endif
+            return -1;
+        }
+        pDataBuffer 	+=	tmpLen;
+        dataBufferLen	+=	tmpLen;
+        tmpLen			=	0;
+    }
+
+    prepare_sic_enchdr_cfg (&encHdrCfg, lteChanType, pCodeBlkParams);
+    if (Bcp_addEncoderHeader (&encHdrCfg, pDataBuffer, &tmpLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Failed to add Encoder Header to packet \n");            
+#endif
+        return -1;
+    }
+    pDataBuffer 	+=	tmpLen;
+    dataBufferLen	+=	tmpLen;
+    tmpLen			=	0;
+
+    prepare_sic_rmhdr_cfg (&lteRmHdrCfg, lteChanType, pCodeBlkParams, pRmParams);
+    if (Bcp_addLte_RMHeader (&lteRmHdrCfg, pDataBuffer, &tmpLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Failed to add lte rate modulation header to packet \n");            
+#endif
+        return -1;
+    }
+    pDataBuffer 	+=	tmpLen;
+    dataBufferLen	+=	tmpLen;
+    tmpLen			=	0;
+
+    prepare_sic_modhdr_cfg (&modHdrCfg, allocIdx, cInit);
+    if (Bcp_addModulatorHeader (&modHdrCfg, pDataBuffer, &tmpLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Failed to add Modulation header to packet \n");            
+#endif
+        return -1;
+    }
+    pDataBuffer 	+=	tmpLen;
+    dataBufferLen	+=	tmpLen;
+    tmpLen			=	0;
+
+    prepare_tmhdr_cfg (&tmHdrCfg);
+    if (Bcp_addTMHeader (&tmHdrCfg, pDataBuffer, &tmpLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG            
+        Bcp_osalLog ("Failed to add Traffic Manager header to packet \n");            
+#endif
+        return -1;
+    }
+    pDataBuffer 	+=	tmpLen;
+    dataBufferLen	+=	tmpLen;
+    tmpLen			=	0;
+
+    bcpGlblHdrCfg.pkt_type          =   Bcp_PacketType_Normal;
+    bcpGlblHdrCfg.flush             =   0;
+    bcpGlblHdrCfg.drop              =   0;
+    bcpGlblHdrCfg.halt              =   0;
+    bcpGlblHdrCfg.radio_standard    =   Bcp_RadioStd_LTE;
+    bcpGlblHdrCfg.hdr_end_ptr       =   ((dataBufferLen + 3) >> 2); // Num Words
+    bcpGlblHdrCfg.flow_id           =   RX_FLOW_ID;
+    bcpGlblHdrCfg.destn_tag         =   0xDEAD;
+    if (Bcp_addGlobalHeader (&bcpGlblHdrCfg, pStartDataBuffer, &tmpLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Failed to add Global Header to packet \n");
+#endif
+        return -1;
+    }
+
+	/* Add padding to align data on 128 bits */
+    tmpLen = (dataBufferLen % 16)? (16 - (dataBufferLen % 16)): 0;
+    pDataBuffer 	+=	tmpLen;
+    dataBufferLen	+=	tmpLen;
+
+    memcpy (pDataBuffer, pPayload, payloadLen);
+    dataBufferLen   +=  payloadLen;
+
+    return dataBufferLen;
+}
+
+/** ============================================================================
+ *   @n@b compute_sic_ref_output
+ *
+ *   @b Description
+ *   @n Computes on the DSP the soft symbols expected from a LTE_PUSCH_SIC
+ *      packet: rate matching of the soft bits, scrambling (LLR sign flip),
+ *      PUSCH channel interleaving and soft modulation.
+ *
+ *      With 2 layers, each interleaver entry holds the Qm LLRs of a symbol
+ *      of each layer, and the codeword symbols are mapped onto the layers
+ *      (split mode), layer 0 symbols first.
+ *
+ *   @param[in]  
+ *   @n pSoftBits       Soft bits, d(0), d(1) and d(2) of each code block in turn.
+ *
+ *   @param[out]  
+ *   @n pRefOut         numSubcarrier * numSymbPerSumbfrm * numLayers soft symbols.
+ *
+ *   @return        
+ *   @n 0 on success, -1 otherwise.
+ * =============================================================================
+ */
+static Int32 compute_sic_ref_output 
+(
+    Int8*                       pSoftBits,
+    BcpTest_LteCBParams*        pCodeBlkParams,
+    BcpTest_RateMatchParams*    pRmParams,
+    UInt32                      cInit,
+    UInt32*                     pRefOut
+)
+{
+    BcpTest_LteChIntlvProg*     pProg;
+    UInt32                      numLayerSymb, numSymb, G, D, E, Ncb, r, n;
+    UInt32*                     pSeq;
+    UInt32*                     pCwSym = NULL;
+    Int8*                       pE;
+    Int8*                       pIntlv;
+    Int32                       retVal = -1;
+
+    numLayerSymb    =   numSubcarrier * numSymbPerSumbfrm;
+    numSymb         =   numLayerSymb * numLayers;
+    G               =   numSymb * modulation;
+
+    if ((pProg = lte_chintlv_get_prog (numSubcarrier, numSymbPerSumbfrm, 0, 0)) == NULL)
+        return -1;
+
+    pE      =   Bcp_osalMalloc (G, FALSE);
+    pIntlv  =   Bcp_osalMalloc (G, FALSE);
+    pSeq    =   Bcp_osalMalloc (((G + 31) >> 5) * 4, FALSE);
+    if (pE == NULL || pIntlv == NULL || pSeq == NULL)
+        goto cleanup_and_return;
+    /* Codeword symbols, before layer mapping */
+    if (numLayers == 2 && (pCwSym = Bcp_osalMalloc (numSymb * 4, FALSE)) == NULL)
+        goto cleanup_and_return;
+
+    /* Rate matching, code block by code block */
+    for (r = 0, n = 0; r < pCodeBlkParams->numCodeBks; r ++)
+    {
+        if (r < pCodeBlkParams->numCodeBksKm)
+        {
+            D   =   pCodeBlkParams->codeBkSizeKm + 4;
+            Ncb =   pRmParams->NcbKm;
+        }
+        else
+        {
+            D   =   pCodeBlkParams->codeBkSizeKp + 4;
+            Ncb =   pRmParams->NcbKp;
+        }
+        E   =   (r < pCodeBlkParams->numCodeBks - pRmParams->Gamma) ? pRmParams->E0 : pRmParams->E1;
+
+        lte_ref_rate_match (pSoftBits, pSoftBits + D, pSoftBits + 2 * D, D, 
+                            (r == 0) ? pCodeBlkParams->numFillerBits : 0, 
+                            Ncb, rvIndex, E, pE + n);
+        pSoftBits   +=  3 * D;
+        n           +=  E;
+    }
+
+    /* Scrambling */
+    lte_ref_gold_seq (cInit, G, pSeq);
+    for (n = 0; n < G; n ++)
+    {
+        if ((pSeq [n >> 5] >> (n & 31)) & 1)
+            pE [n]  =   (pE [n] == -128) ? 127 : -pE [n];
+    }
+
+    lte_chintlv_interleave (pProg, (UInt8 *)pE, (UInt8 *)pIntlv, modulation * numLayers);
+    if (numLayers == 1)
+    {
+        lte_mod_soft_symbols (pIntlv, numSymb, modulation, LTE_SIC_QFMT, lte_mod_hard_uva (modulation, rms), pRefOut);
+    }
+    else
+    {
+        lte_mod_soft_symbols (pIntlv, numSymb, modulation, LTE_SIC_QFMT, lte_mod_hard_uva (modulation, rms), pCwSym);
+        lte_layer_map (pCwSym, NULL, numLayerSymb, pRefOut, pRefOut + numLayerSymb);
+    }
+    retVal  =   0;
+
+cleanup_and_return:
+    if (pCwSym)
+        Bcp_osalFree (pCwSym, numSymb * 4, FALSE);
+    if (pE)
+        Bcp_osalFree (pE, G, FALSE);
+    if (pIntlv)
+        Bcp_osalFree (pIntlv, G, FALSE);
+    if (pSeq)
+        Bcp_osalFree (pSeq, ((G + 31) >> 5) * 4, FALSE);
+
+    return retVal;
+}
+
+/** ============================================================================
+ *   @n@b validate_sic_rxdata
+ *
+ *   @b Description
+ *   @n Compares soft symbols received from BCP against the DSP reference,
+ *      allowing LTE_SIC_SYM_TOL on each of I and Q.
+ *
+ *   @return        
+ *   @n 0 if all symbols are within tolerance, -1 otherwise.
+ * =============================================================================
+ */
+static Int32 validate_sic_rxdata 
+(
+    UInt32*             pRefOut,
+    UInt32              refOutLen, 
+    UInt8*              pRxDataBuffer, 
+    UInt32              rxDataBufferLen, 
+    UInt32              dataOffset
+)
+{
+    UInt32*             pRxSym = (UInt32 *) pRxDataBuffer;
+    UInt32*             pRefSym = pRefOut + (dataOffset >> 2);
+    UInt32              i;
+    Int32               dI, dQ;
+
+    if (refOutLen < rxDataBufferLen + dataOffset)
+        return -1;
+
+    for (i = 0; i < (rxDataBufferLen >> 2); i ++)
+    {
+        dI  =   (Int16) (pRxSym [i] >> 16) - (Int16) (pRefSym [i] >> 16);
+        dQ  =   (Int16) pRxSym [i] - (Int16) pRefSym [i];
+        if (dI > LTE_SIC_SYM_TOL || dI < -LTE_SIC_SYM_TOL || dQ > LTE_SIC_SYM_TOL || dQ < -LTE_SIC_SYM_TOL)
+            return -1;
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b run_sic_packet
+ *
+ *   @b Description
+ *   @n Re-encodes the PUSCH transmission last configured by 
+ *      @a add_test_config_data () through BCP, as done for successive
+ *      interference cancellation, and checks the output.
+ *
+ *      Decoded bits are synthesized: a transport block for LTE_PUSCH_SIC_HARD,
+ *      and soft bits spanning the whole LLR range for LTE_PUSCH_SIC. Soft SIC
+ *      output is checked against @a compute_sic_ref_output (), for 1 or 2
+ *      layers. Hard SIC output is only length checked, so the test does not
+ *      send LTE_PUSCH_SIC_HARD packets until a reference models them.
+ *      Cycles spent in BCP and in the DSP reference are accumulated for the
+ *      throughput report.
+ *
+ *   @return        
+ *   @n Number of failures.
+ * =============================================================================
+ */
+static UInt32 run_sic_packet 
+(
+    Bcp_RxHandle        hRx, 
+    Bcp_TxHandle        hTx, 
+    Qmss_QueueHnd       hTxFDQ, 
+    UInt32              lteChanType
+)
+{
+    BcpTest_LteCBParams         codeBlkParams;
+    BcpTest_RateMatchParams     rmParams;
+    Cppi_Desc*                  pCppiDesc;
+    UInt8*                      pDataBuffer;
+    UInt8*                      pRxDataBuffer;
+    UInt8*                      pRxPsInfo;
+    UInt8*                      pPayload = NULL;
+    UInt32*                     pRefOut = NULL;
+    Bcp_DrvBufferHandle         hRxDrvBuffer;
+    Bcp_DrvBufferHandle         hVoid;
+    Bcp_DrvBufferHandle         hTmp;
+    UInt32                      dataBufferLen, rxDataBufferLen, rxPsInfoLen, rxDataTotalLen;
+    UInt32                      numSymb, payloadLen, refOutLen, cInit, seed, r, i, t0, testFail = 0;
+    UInt8                       rxFlowId, rxSrcId, allocIdx;
+    UInt16                      rxDestnTag;
+    Int32                       dataBufferLenUsed;
+    Int32                       bCheckOutput;
+
+    memset (&codeBlkParams, 0, sizeof (BcpTest_LteCBParams));
+    memset (&rmParams, 0, sizeof (BcpTest_RateMatchParams));
+    compute_cbparams_ref (tbSize, &codeBlkParams);
+
+    numSymb =   numSubcarrier * numSymbPerSumbfrm * numLayers;
+    compute_rmGamma_ref (numSymb * modulation,
+                         modulation,
+                         numLayers, 
+                         &codeBlkParams,
+                         rvIndex,
+                         0, 
+                         0,
+                         0,
+                         lteChanType,
+                         &rmParams);
+
+    for (allocIdx = 0; allocIdx < 25; allocIdx ++)
+    {
+        if (numPrbInPusch[allocIdx] == numSubcarrier/12)
+            break;
+    }
+    cInit = (rnti * (1<<14)) + ((ns / 2) * (1<<9)) + cellID;
+
+    /* Synthesize the decoded bits */
+    seed    =   LTE_SIC_SEED;
+    if (lteChanType == LTE_PUSCH_SIC_HARD)
+    {
+        payloadLen  =   (tbSize + 7) >> 3;
+    }
+    else
+    {
+        payloadLen  =   3 * (codeBlkParams.numCodeBksKm * (codeBlkParams.codeBkSizeKm + 4) + 
+                             codeBlkParams.numCodeBksKp * (codeBlkParams.codeBkSizeKp + 4));
+    }
+    if ((pPayload = Bcp_osalMalloc (payloadLen, FALSE)) == NULL)
+    {
+        testFail ++;
+        goto cleanup_and_return;
+    }
+    for (i = 0; i < payloadLen; i ++)
+    {
+        seed            =   seed * 1664525 + 1013904223;
+        pPayload [i]    =   (UInt8) (seed >> 24);
+    }
+
+    /* DSP reference of the soft SIC output. Hard SIC output is NOT checked
+     * against a reference, only its length is: there is no model here of
+     * the soft modulator fed with the turbo encoded hard bits.
+     */
+    bCheckOutput    =   (lteChanType == LTE_PUSCH_SIC);
+    refOutLen       =   numSymb * 4;
+    if (bCheckOutput)
+    {
+        if ((pRefOut = Bcp_osalMalloc (refOutLen, FALSE)) == NULL)
+        {
+            testFail ++;
+            goto cleanup_and_return;
+        }
+
+        t0  =   TSCL;
+        if (compute_sic_ref_output ((Int8 *)pPayload, &codeBlkParams, &rmParams, cInit, pRefOut) != 0)
+        {
+            testFail ++;
+            goto cleanup_and_return;
+        }
+        sicRefCycles    +=  TSCL - t0;
+    }
+
+    if ((pCppiDesc = (Cppi_Desc*) Qmss_queuePop (hTxFDQ)) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Out of Tx FDs! \n");
+#endif
+        testFail ++;
+        goto cleanup_and_return;
+    }
+    pCppiDesc = (Cppi_Desc *) (QMSS_DESC_PTR (pCppiDesc));    
+    Cppi_getData (Cppi_DescType_HOST, pCppiDesc, &pDataBuffer, &dataBufferLen);
+    memset (pDataBuffer, 0, dataBufferLen); 
+
+    /* Payload plus headers (well under 128 bytes) must fit the Tx buffer */
+    if (payloadLen + 128 > dataBufferLen || 
+        (dataBufferLenUsed = add_sic_config_data (pDataBuffer, lteChanType, &codeBlkParams, &rmParams, 
+                                                  allocIdx, cInit, pPayload, payloadLen)) <= 0)
+    {
+        Bcp_osalLog ("Error populating SIC packet \n");
+        testFail ++;
+        goto cleanup_and_return;
+    }
+    Cppi_setDataLen (Cppi_DescType_HOST, pCppiDesc, dataBufferLenUsed);
+    Cppi_setPacketLen (Cppi_DescType_HOST, pCppiDesc, dataBufferLenUsed);
+
+    t0  =   TSCL;
+    Bcp_send (hTx, (Bcp_DrvBufferHandle) pCppiDesc, BCP_TEST_SIZE_HOST_DESC, NULL);
+    while (Bcp_rxGetNumOutputEntries (hRx) == 0);
+    sicBcpCycles    +=  TSCL - t0;
+    sicNumSymb      +=  numSymb;
+    sicNumPkts      ++;
+
+    rxDataTotalLen  =   0;
+    Bcp_recv (hRx,
+              &hRxDrvBuffer,
+              &pRxDataBuffer,
+              &rxDataBufferLen,
+              &pRxPsInfo,
+              &rxPsInfoLen,
+              &rxFlowId,
+              &rxSrcId,
+              &rxDestnTag);            
+
+    if (bCheckOutput && validate_sic_rxdata (pRefOut, refOutLen, pRxDataBuffer, rxDataBufferLen, rxDataTotalLen) != 0)
+        testFail ++;                    
+    rxDataTotalLen  +=  rxDataBufferLen;
+
+    /* Check if there are any descriptors linked to this Rx desc */
+    while (hRxDrvBuffer)
+    {
+        hTmp = hRxDrvBuffer;
+
+        if ((hRxDrvBuffer = Cppi_getNextBD (Cppi_getDescType (hRxDrvBuffer), hRxDrvBuffer)))
+        {
+            Bcp_rxProcessDesc  (hRx,
+                                hRxDrvBuffer,
+                                &hVoid,
+                                &pRxDataBuffer,
+                                &rxDataBufferLen,
+                                &pRxPsInfo,
+                                &rxPsInfoLen,
+                                &rxFlowId,
+                                &rxSrcId,
+                                &rxDestnTag);            
+
+            if (bCheckOutput && validate_sic_rxdata (pRefOut, refOutLen, pRxDataBuffer, rxDataBufferLen, rxDataTotalLen) != 0)
+                testFail ++;                    
+            rxDataTotalLen  +=  rxDataBufferLen;
+        }
+
+        Bcp_rxFreeRecvBuffer (hRx, hTmp, BCP_TEST_SIZE_HOST_DESC);
+    }
+
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("[SIC %s]: Total Len: %d \n", (lteChanType == LTE_PUSCH_SIC) ? "soft" : "hard", rxDataTotalLen);
+#endif
+
+    if (rxDataTotalLen != refOutLen)
+        testFail ++;
+
+cleanup_and_return:
+    if (pPayload)
+        Bcp_osalFree (pPayload, payloadLen, FALSE);
+    if (pRefOut)
+        Bcp_osalFree (pRefOut, refOutLen, FALSE);
+
+    return testFail;
+}
+#endif
+
+/** ============================================================================
+ *   @n@b validate_ul_rxdata
+ *
+ *   @b Description
+ *   @n Validates a data buffer received from BCP as @a validate_rxdata ()
+ *      does, and counts it into the statistics of the transport block.
+ *
+ *      The output is the RD header followed by 8 bit LLRs. The hard decision
+ *      of each LLR, its sign bit, is counted as a bit checked, and as a bit
+ *      in error where it differs from that of the reference LLR. Any
+ *      difference, in the header or in an LLR, fails the block.
+ *
+ *   @return        Int32
+ *   @n 0       -   Data buffer matches the reference output.
+ *
+ *   @n -1      -   Validation failed.
+ * =============================================================================
+ */
+static Int32 validate_ul_rxdata
+(
+    UInt8*              pRefDataBuffer,
+    UInt32              refDataBufferLen,
+    UInt8*              pRxDataBuffer, 
+    UInt32              rxDataBufferLen, 
+    UInt32              dataOffset,
+    BcpTest_StatsBlock* pStatsBlock
+)
+{
+    BcpTest_RxDiff      diff;
+    UInt32              i, llrStart;
+
+    if (!pRxDataBuffer || (refDataBufferLen < rxDataBufferLen + dataOffset))
+    {
+        pStatsBlock->bBlockErr  =   TRUE;
+        return -1;
+    }
+
+    /* First LLR of the buffer, past the RD header */
+    llrStart    =   (dataOffset < LTE_UL_RD_HDR_BYTES) ? LTE_UL_RD_HDR_BYTES - dataOffset : 0;
+    if (llrStart < rxDataBufferLen)
+        pStatsBlock->numBits    +=  rxDataBufferLen - llrStart;
+
+    if (rxdata_diff (pRefDataBuffer + dataOffset, pRxDataBuffer, rxDataBufferLen, dataOffset, &diff) != 0)
+    {
+        rxdata_diff_log (&diff);
+        for (i = llrStart; i < rxDataBufferLen; i ++)
+        {
+            if ((pRefDataBuffer [dataOffset + i] ^ pRxDataBuffer [i]) & 0x80)
+                pStatsBlock->numBitErrs ++;
+        }
+        pStatsBlock->bBlockErr  =   TRUE;
+        return -1;
+    }
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b test_lte_ul
+ *
+ *   @b Description
+ *   @n Sets up the parameters required and runs an LTE Uplink (UL) test case.
+ *
  *   @param[in]  
  *   @n hBcp        BCP driver handle
  *
@@ -1525,7 +2320,8 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
     Bcp_DrvBufferHandle hRxDrvBuffer;
     Bcp_DrvBufferHandle hVoid;
     Bcp_DrvBufferHandle hTmp;
-    Int32               dataBufferLenUsed;
+    Int32               dataBufferLenUsed, statsCfgId;
+    BcpTest_StatsBlock  statsBlock;
 
     /* Setup Rx side:
      *  -   Open BCP Rx queue on which BCP results are to be received
@@ -1633,9 +2429,22 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
         Bcp_osalLog ("Tx FDQ %d successfully setup with %d descriptors\n", hTxFDQ, TX_NUM_DESC);
     }
 
+#ifdef LTE_UL_SIC
+    /* Start the time stamp counter used to time SIC packets */
+    TSCL            =   0;
+    sicNumPkts      =   0;
+    sicNumSymb      =   0;
+    sicBcpCycles    =   0;
+    sicRefCycles    =   0;
+#endif
+
+    statsCfgId  =   stats_cfg_id ("PUSCH UV620");
+
     /* Build and Send a packet with LTE UL parameters for BCP Processing */
     for (numTestPkts = 0; numTestPkts < BCP_TEST_NUM_PACKETS; numTestPkts ++)
     {
+        memset (&statsBlock, 0, sizeof (BcpTest_StatsBlock));
+
         if ((pCppiDesc = (Cppi_Desc*) Qmss_queuePop (hTxFDQ)) == NULL)
         {
 #ifdef BCP_TEST_DEBUG
@@ -1657,6 +2466,11 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
             goto cleanup_and_return;
         }
 
+#ifdef BCP_TEST_HDR_TRACE
+        /* Log the header chain built */
+        hdr_dasm_trace (pDataBuffer, dataBufferLenUsed);
+#endif
+
 #ifdef BCP_TEST_DEBUG
    	    Bcp_osalLog ("Sending a packet of len %d to BCP ...\n", dataBufferLenUsed);
 #endif
@@ -1695,20 +2509,22 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
 
             if (i == 0)
             {
-                if (validate_rxdata ((UInt8 *)lte_ul_output_packet_1, 
+                if (validate_ul_rxdata ((UInt8 *)lte_ul_output_packet_1, 
                                     LTE_UL_OUTPUT_PKT_1_WRD_SIZE*4, 
                                     pRxDataBuffer, 
                                     rxDataBufferLen, 
-                                    rxDataTotalLen) != 0)
+                                    rxDataTotalLen,
+                                    &statsBlock) != 0)
                     testFail ++;                    
             }
             else
             {
-                if (validate_rxdata ((UInt8 *)lte_ul_output_packet_2, 
+                if (validate_ul_rxdata ((UInt8 *)lte_ul_output_packet_2, 
                                     LTE_UL_OUTPUT_PKT_2_WRD_SIZE*4, 
                                     pRxDataBuffer, 
                                     rxDataBufferLen, 
-                                    rxDataTotalLen) != 0)
+                                    rxDataTotalLen,
+                                    &statsBlock) != 0)
                     testFail ++;                    
             }
 
@@ -1735,20 +2551,22 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
 
                     if (i == 0)
                     {
-                        if (validate_rxdata ((UInt8 *)lte_ul_output_packet_1, 
+                        if (validate_ul_rxdata ((UInt8 *)lte_ul_output_packet_1, 
                                             LTE_UL_OUTPUT_PKT_1_WRD_SIZE*4, 
                                             pRxDataBuffer, 
                                             rxDataBufferLen, 
-                                            rxDataTotalLen) != 0)
+                                            rxDataTotalLen,
+                                            &statsBlock) != 0)
                             testFail ++;                            
                     }
                     else
                     {
-                        if (validate_rxdata ((UInt8 *)lte_ul_output_packet_2, 
+                        if (validate_ul_rxdata ((UInt8 *)lte_ul_output_packet_2, 
                                             LTE_UL_OUTPUT_PKT_2_WRD_SIZE*4, 
                                             pRxDataBuffer, 
                                             rxDataBufferLen,
-                                            rxDataTotalLen) != 0)
+                                            rxDataTotalLen,
+                                            &statsBlock) != 0)
                             testFail ++;                           
                         
                     }
@@ -1765,20 +2583,49 @@ Void test_lte_ul (Bcp_DrvHandle hBcp, Qmss_QueueHnd hGlblFDQ)
 
             if ((i == 0 && rxDataTotalLen != LTE_UL_OUTPUT_PKT_1_WRD_SIZE * 4) || 
                 (i == 1 && rxDataTotalLen != LTE_UL_OUTPUT_PKT_2_WRD_SIZE * 4))
+            {
+                statsBlock.bBlockErr    =   TRUE;
                 testFail ++;
+            }
         }
     
         /* Compare HARQ output */
 #ifndef SIMULATOR_SUPPORT
-        if (validate_harqoutput (lte_ul_output_mem, 132 * 4, harqOutput, 132 * 4, 0) != 0)
+        if (validate_harqoutput_llr (lte_ul_output_mem, 132 * 4, harqOutput, 132 * 4, 0, LTE_UL_HARQ_LLR_TOL) != 0)
 #else
         /* Simulator bug workaround: BCP TM module endian handling not correct. */
         if (validate_rxdata ((UInt8 *)lte_ul_output_mem, 132 * 4, (UInt8 *)harqOutput, 132 * 4, 0) != 0)
 #endif
             testFail ++;
+
+#ifdef LTE_UL_SIC
+        /* Re-encode the transmission just decoded, as for interference cancellation */
+        testFail    +=  run_sic_packet (hRx, hTx, hTxFDQ, LTE_PUSCH_SIC);
+#endif
+
+        /* Count the transport block at the SNR of its last transmission,
+         * failed by its own outputs only: HARQ and SIC failures are counted
+         * by the test, not by the block. The outputs are soft, with no
+         * decoder in the loop, so code block CRC failures are not known here.
+         */
+        if (statsCfgId >= 0)
+        {
+            statsBlock.snrDb        =   10.0f * log10f ((snrEven + snrOdd) / 2.0f);
+            statsBlock.numTbBits    =   tbSize;
+            statsBlock.numCodeBlks  =   lteUlNumCodeBlks;
+            statsBlock.numTrans     =   numTrans;
+            stats_add_block ((UInt32) statsCfgId, &statsBlock);
+        }
     }
 
 cleanup_and_return:
+#ifdef LTE_UL_SIC
+    if (sicNumPkts > 0)
+    {
+        Bcp_osalLog ("LTE UL SIC: %d packets, %d symbols, BCP %d cycles, DSP soft symbol reference %d cycles\n", 
+                     sicNumPkts, sicNumSymb, sicBcpCycles, sicRefCycles);
+    }
+#endif
     if (testFail > 0)
     {
         Bcp_osalLog ("LTE UL Test:    FAILED\n");                
@@ -1790,6 +2637,9 @@ cleanup_and_return:
         totalNumTestsPass ++;
     }    
 
+    stats_flush ();
+    release_test_vecs ();
+
     if (hRx)
         Bcp_rxClose (hRx);
 
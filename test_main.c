@@ -111,6 +111,9 @@ const uint32_t DEVICE_ID4_8BIT     = 0x56;
 
 #define SYSINIT_CORE    0
 
+/* Error statistics of all cores, written by SYSINIT_CORE once the tests are done */
+#define BCP_TEST_STATS_FILE                 "..\\..\\bcp_test_stats.csv"
+
 /* Used to synchronize System Init on all cores */
 #pragma DATA_SECTION (bIsSysInitDone, ".bcp");
 static volatile UInt32                           bIsSysInitDone 	    = 0;
@@ -493,6 +496,7 @@ Void setup_run_bcpremote_task ()
     Qmss_QueueHnd           hGlblFDQ;
     Cppi_DescCfg            cppiDescCfg;
     UInt32                  numAllocated;
+    FILE*                   pStatsFile;
 
     /* Get the core number on which the test is being run */
     coreNum = CSL_chipReadReg (CSL_CHIP_DNUM);
@@ -720,6 +724,9 @@ Void setup_run_bcp_test ()
         printf ("Global FDQ %d successfully setup with %d descriptors\n", hGlblFDQ, numAllocated);
     }
 
+    /* Start the error statistics of this core afresh */
+    stats_init ();
+
     /* Run the Downlink/Uplink tests */
     Bcp_osalLog ("\n-------------- Rel99 DL Test Start ---------------\n");
     test_wcdma_rel99_dl (hBcp, hGlblFDQ);
@@ -761,6 +768,16 @@ Void setup_run_bcp_test ()
         Bcp_osalBeginMemAccess ((void *)&bIsSysInitDone, sizeof(UInt32));
     } while (bIsCoreTestDone < bIsSysInitDone);
 
+    /* Report the error statistics of all cores, once they are all done */
+    if (coreNum == SYSINIT_CORE)
+    {
+        if ((pStatsFile = fopen (BCP_TEST_STATS_FILE, "w")) == NULL)
+            Bcp_osalLog ("Cannot open %s, statistics are logged only \n", BCP_TEST_STATS_FILE);
+        stats_report (pStatsFile);
+        if (pStatsFile != NULL)
+            fclose (pStatsFile);
+    }
+
     /* Close the BCP driver and free up any resources allocated for this test. */
     Bcp_close (hBcp);
     
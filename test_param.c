@@ -0,0 +1,303 @@
+/**
+ *   @file  test_param.c
+ *
+ *   @brief
+ *      Test configuration parameter file parser.
+ *
+ *      A parameter file holds one "Key = value;" per line, with anything
+ *      after a '%' taken as a comment. The parameters a test reads are
+ *      described by a schema of key, type, destination and valid values.
+ *      Keys are matched exactly, through a hash table that is made
+ *      collision free for the keys of the schema when it is set up, so
+ *      that a line costs one hash of its key, computed while the key is
+ *      scanned, and one key compare. Keys not in the schema are skipped.
+ *
+ *      A value is a decimal integer, or a range of them "first:last",
+ *      as in "ns = 0:1", for parameters of type BcpTest_ParamType_Range.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Key hash, FNV-1a from a per schema seed */
+#define PARAM_HASH_STEP(hash, c)            (((hash) ^ (UInt8) (c)) * 0x01000193)
+#define PARAM_HASH_IDX(hash)                (((hash) ^ ((hash) >> 16)) & (BCP_TEST_PARAM_HASH_SIZE - 1))
+
+/* Seeds tried for a collision free hash table */
+#define PARAM_MAX_SEEDS                     1024
+
+#pragma DATA_SECTION (paramFileBuf, ".testData");
+static Char             paramFileBuf [BCP_TEST_PARAM_MAX_FILE_SIZE];
+
+static Bool param_is_key_char (Char c)
+{
+    return ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+            (c >= '0' && c <= '9') || c == '_');
+}
+
+static const Char* param_skip_blanks (const Char* p, const Char* pEnd)
+{
+    while (p < pEnd && (*p == ' ' || *p == '\t' || *p == '\r'))
+        p ++;
+
+    return p;
+}
+
+/* Reads a decimal integer. Returns NULL if there is none, or it does not
+ * fit in an Int32.
+ */
+static const Char* param_read_int (const Char* p, const Char* pEnd, Int32* pVal)
+{
+    UInt32              val = 0;
+    Bool                bNeg = FALSE;
+    const Char*         pDigits;
+
+    p   =   param_skip_blanks (p, pEnd);
+    if (p < pEnd && *p == '-')
+    {
+        bNeg    =   TRUE;
+        p ++;
+    }
+
+    for (pDigits = p; p < pEnd && *p >= '0' && *p <= '9'; p ++)
+    {
+        if (val > (0x7FFFFFFF - (UInt32) (*p - '0')) / 10)
+            return NULL;
+        val =   val * 10 + (UInt32) (*p - '0');
+    }
+    if (p == pDigits)
+        return NULL;
+
+    *pVal   =   bNeg ? -(Int32) val : (Int32) val;
+    return p;
+}
+
+/** ============================================================================
+ *   @n@b param_schema_init
+ *
+ *   @b Description
+ *   @n Sets up a parameter file schema. Looks for a hash seed that maps the
+ *      keys of the schema to distinct entries of the hash table.
+ *
+ *   @param[out]
+ *   @n pSchema     Schema to set up.
+ *
+ *   @param[in]
+ *   @n pParams     Parameters of the schema. Must remain valid while the
+ *                  schema is in use.
+ *
+ *   @param[in]
+ *   @n numParams   Number of parameters, at most BCP_TEST_PARAM_MAX_PARAMS.
+ *
+ *   @return        Int32
+ *   @n 0       -   Schema set up.
+ *
+ *   @n -1      -   Too many parameters, duplicate keys or invalid limits.
+ * =============================================================================
+ */
+Int32 param_schema_init
+(
+    BcpTest_ParamSchema*        pSchema,
+    const BcpTest_ParamDesc*    pParams,
+    UInt32                      numParams
+)
+{
+    const Char*         pKey;
+    UInt32              seed, hash, idx, i;
+
+    memset (pSchema, 0, sizeof (BcpTest_ParamSchema));
+    if (numParams > BCP_TEST_PARAM_MAX_PARAMS)
+        return -1;
+
+    for (i = 0; i < numParams; i ++)
+    {
+        if (pParams [i].minVal > pParams [i].maxVal ||
+            (pParams [i].type == BcpTest_ParamType_UInt8 && (pParams [i].minVal < 0 || pParams [i].maxVal > 0xFF)) ||
+            (pParams [i].type == BcpTest_ParamType_UInt16 && (pParams [i].minVal < 0 || pParams [i].maxVal > 0xFFFF)) ||
+            (pParams [i].type == BcpTest_ParamType_UInt32 && pParams [i].minVal < 0))
+        {
+#ifdef BCP_TEST_DEBUG
+            Bcp_osalLog ("Parameter %s: invalid limits \n", pParams [i].pKey);
+#endif
+            return -1;
+        }
+    }
+
+    for (seed = 1; seed <= PARAM_MAX_SEEDS; seed ++)
+    {
+        memset (pSchema->hashTbl, 0, sizeof (pSchema->hashTbl));
+
+        for (i = 0; i < numParams; i ++)
+        {
+            for (hash = seed, pKey = pParams [i].pKey; *pKey; pKey ++)
+                hash    =   PARAM_HASH_STEP (hash, *pKey);
+            idx =   PARAM_HASH_IDX (hash);
+            if (pSchema->hashTbl [idx])
+                break;
+            pSchema->hashTbl [idx]  =   (UInt8) (i + 1);
+        }
+
+        if (i == numParams)
+        {
+            pSchema->pParams    =   pParams;
+            pSchema->numParams  =   numParams;
+            pSchema->hashSeed   =   seed;
+            return 0;
+        }
+    }
+
+    /* Duplicate keys never hash apart */
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("No collision free hash for the parameter schema \n");
+#endif
+    memset (pSchema, 0, sizeof (BcpTest_ParamSchema));
+    return -1;
+}
+
+/** ============================================================================
+ *   @n@b param_parse
+ *
+ *   @b Description
+ *   @n Parses the text of a parameter file in one pass, and stores the value
+ *      of each parameter of the schema found in its destination. Parameters
+ *      missing from the text are left as they are.
+ *
+ *   @param[in]
+ *   @n pSchema     Schema set up by @a param_schema_init ().
+ *
+ *   @param[in]
+ *   @n pText       Text of the parameter file.
+ *
+ *   @param[in]
+ *   @n textLen     Length of the text.
+ *
+ *   @return        Int32
+ *   @n >=0     -   Number of parameter values stored.
+ *
+ *   @n -1      -   A parameter of the schema has a malformed or out of range
+ *                  value.
+ * =============================================================================
+ */
+Int32 param_parse (const BcpTest_ParamSchema* pSchema, const Char* pText, UInt32 textLen)
+{
+    const Char*                 p = pText;
+    const Char*                 pEnd = pText + textLen;
+    const Char*                 pKey;
+    const BcpTest_ParamDesc*    pDesc;
+    UInt32                      hash, keyLen, idx;
+    Int32                       first, last, numStored = 0;
+
+    while (p < pEnd)
+    {
+        /* Key, hashed as it is scanned */
+        p       =   param_skip_blanks (p, pEnd);
+        pKey    =   p;
+        for (hash = pSchema->hashSeed; p < pEnd && param_is_key_char (*p); p ++)
+            hash    =   PARAM_HASH_STEP (hash, *p);
+        keyLen  =   p - pKey;
+        p       =   param_skip_blanks (p, pEnd);
+
+        pDesc   =   NULL;
+        if (keyLen && p < pEnd && *p == '=' && (idx = pSchema->hashTbl [PARAM_HASH_IDX (hash)]) != 0)
+        {
+            pDesc   =   &pSchema->pParams [idx - 1];
+            if (strncmp (pDesc->pKey, pKey, keyLen) != 0 || pDesc->pKey [keyLen] != '\0')
+                pDesc   =   NULL;
+        }
+
+        if (pDesc != NULL)
+        {
+            /* Value, or range of values */
+            if ((p = param_read_int (p + 1, pEnd, &first)) == NULL)
+                goto malformed;
+            last    =   first;
+            p       =   param_skip_blanks (p, pEnd);
+            if (p < pEnd && *p == ':')
+            {
+                if (pDesc->type != BcpTest_ParamType_Range ||
+                    (p = param_read_int (p + 1, pEnd, &last)) == NULL || last < first)
+                    goto malformed;
+                p   =   param_skip_blanks (p, pEnd);
+            }
+            if (p < pEnd && *p == ';')
+                p   =   param_skip_blanks (p + 1, pEnd);
+            if (p < pEnd && *p != '\n' && *p != '%')
+                goto malformed;
+
+            if (first < pDesc->minVal || last > pDesc->maxVal)
+            {
+#ifdef BCP_TEST_DEBUG
+                Bcp_osalLog ("Parameter %s: %d:%d out of range %d:%d \n", pDesc->pKey, first, last,
+                             pDesc->minVal, pDesc->maxVal);
+#endif
+                return -1;
+            }
+
+            switch (pDesc->type)
+            {
+                case BcpTest_ParamType_UInt8:
+                    *(UInt8 *) pDesc->pDest     =   (UInt8) first;
+                    break;
+                case BcpTest_ParamType_UInt16:
+                    *(UInt16 *) pDesc->pDest    =   (UInt16) first;
+                    break;
+                case BcpTest_ParamType_UInt32:
+                    *(UInt32 *) pDesc->pDest    =   (UInt32) first;
+                    break;
+                case BcpTest_ParamType_Range:
+                    ((BcpTest_ParamRange *) pDesc->pDest)->first    =   first;
+                    ((BcpTest_ParamRange *) pDesc->pDest)->last     =   last;
+                    break;
+            }
+            numStored ++;
+        }
+
+        /* On to the next line */
+        while (p < pEnd && *p ++ != '\n')
+            ;
+    }
+
+    return numStored;
+
+malformed:
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("Parameter %s: malformed value \n", pDesc->pKey);
+#endif
+    return -1;
+}
+
+/** ============================================================================
+ *   @n@b param_parse_file
+ *
+ *   @b Description
+ *   @n Reads a parameter file with a single block read and parses it, see
+ *      @a param_parse ().
+ *
+ *   @param[in]
+ *   @n pSchema     Schema set up by @a param_schema_init ().
+ *
+ *   @param[in]
+ *   @n fp          Parameter file handle.
+ *
+ *   @return        Int32
+ *   @n >=0     -   Number of parameter values stored.
+ *
+ *   @n -1      -   File too large, or a value malformed or out of range.
+ * =============================================================================
+ */
+Int32 param_parse_file (const BcpTest_ParamSchema* pSchema, FILE* fp)
+{
+    size_t              textLen;
+
+    textLen =   fread (paramFileBuf, 1, sizeof (paramFileBuf), fp);
+    if (textLen == sizeof (paramFileBuf) && fgetc (fp) != EOF)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Parameter file larger than %d bytes \n", BCP_TEST_PARAM_MAX_FILE_SIZE);
+#endif
+        return -1;
+    }
+
+    return param_parse (pSchema, paramFileBuf, (UInt32) textLen);
+}
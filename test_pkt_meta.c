@@ -0,0 +1,194 @@
+/**
+ *   @file  test_pkt_meta.c
+ *
+ *   @brief
+ *      Per packet metadata carried through BCP in the PS words.
+ *
+ *      BCP passes the protocol specific (PS) words that follow the header
+ *      chain of a packet through to the PS info of its output descriptor.
+ *      The test puts a tag in there along with the UE id, HARQ process,
+ *      TTI and submit time of the packet, so that results can be matched to
+ *      their requests in whichever order they come back, rather than by
+ *      arrival order with only one packet in flight.
+ *
+ *      The tag is the index of the packet in a table of packets in flight,
+ *      with a generation count in the upper bits, so that the lookup on Rx
+ *      is a table index and a stale or corrupt tag is caught.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* Tag layout: table index in the low bits, generation count above */
+#define PKT_META_TAG_IDX_MASK               (BCP_TEST_PKT_META_MAX_INFLIGHT - 1)
+#define PKT_META_TAG_GEN_SHIFT              16
+
+/* Packets in flight */
+typedef struct _PktMetaSlot
+{
+    BcpTest_PktMeta     meta;
+    UInt32              tag;            /* 0 when free */
+    UInt32              nextFree;
+} PktMetaSlot;
+
+#pragma DATA_SECTION (pktMetaTbl, ".testData");
+static PktMetaSlot      pktMetaTbl[BCP_TEST_PKT_META_MAX_INFLIGHT];
+#pragma DATA_SECTION (pktMetaFreeHead, ".testData");
+static UInt32           pktMetaFreeHead = 0;
+#pragma DATA_SECTION (pktMetaGen, ".testData");
+static UInt32           pktMetaGen = 0;
+#pragma DATA_SECTION (pktMetaNumInFlight, ".testData");
+static UInt32           pktMetaNumInFlight = 0;
+
+/** ============================================================================
+ *   @n@b pkt_meta_init
+ *
+ *   @b Description
+ *   @n Frees all entries of the table of packets in flight.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void pkt_meta_init (Void)
+{
+    UInt32              i;
+
+    for (i = 0; i < BCP_TEST_PKT_META_MAX_INFLIGHT; i ++)
+    {
+        pktMetaTbl [i].tag      =   0;
+        pktMetaTbl [i].nextFree =   i + 1;
+    }
+    pktMetaFreeHead     =   0;
+    pktMetaNumInFlight  =   0;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b pkt_meta_submit
+ *
+ *   @b Description
+ *   @n Enters a packet in the table of packets in flight and sets up the
+ *      PS words that carry its metadata through BCP. The submit time is
+ *      stamped here.
+ *
+ *   @param[in]
+ *   @n pMeta       Metadata of the packet.
+ *
+ *   @param[out]
+ *   @n pPsWords    BCP_TEST_PKT_META_PS_WORDS words to add after the header
+ *                  chain of the packet.
+ *
+ *   @return        Int32
+ *   @n >0      -   Tag of the packet.
+ *
+ *   @n -1      -   Too many packets in flight.
+ * =============================================================================
+ */
+Int32 pkt_meta_submit (const BcpTest_PktMeta* pMeta, UInt32* pPsWords)
+{
+    PktMetaSlot*        pSlot;
+    UInt32              idx;
+
+    if (pktMetaFreeHead >= BCP_TEST_PKT_META_MAX_INFLIGHT)
+        return -1;
+
+    idx             =   pktMetaFreeHead;
+    pSlot           =   &pktMetaTbl [idx];
+    pktMetaFreeHead =   pSlot->nextFree;
+    pktMetaNumInFlight ++;
+
+    /* Skip generation 0 so that a tag is never 0 */
+    pktMetaGen  =   (pktMetaGen + 1) & 0x7FFF;
+    if (pktMetaGen == 0)
+        pktMetaGen  =   1;
+
+    pSlot->meta             =   *pMeta;
+    pSlot->meta.submitTime  =   TSCL;
+    pSlot->tag              =   (pktMetaGen << PKT_META_TAG_GEN_SHIFT) | idx;
+
+    pPsWords [0]    =   pSlot->tag;
+    pPsWords [1]    =   pSlot->meta.ueId | ((UInt32) pSlot->meta.harqProcId << 16);
+    pPsWords [2]    =   pSlot->meta.tti;
+    pPsWords [3]    =   pSlot->meta.submitTime;
+
+    return (Int32) pSlot->tag;
+}
+
+/** ============================================================================
+ *   @n@b pkt_meta_lookup
+ *
+ *   @b Description
+ *   @n Maps the PS info of a BCP output packet back to the metadata of the
+ *      packet it was built from.
+ *
+ *   @param[in]
+ *   @n pPsInfo     PS info returned by Bcp_recv ().
+ *
+ *   @param[in]
+ *   @n psInfoLen   PS info length in bytes.
+ *
+ *   @return        BcpTest_PktMeta*
+ *   @n Metadata of the packet, NULL if the PS info carries no tag of a packet
+ *      in flight.
+ * =============================================================================
+ */
+BcpTest_PktMeta* pkt_meta_lookup (const UInt8* pPsInfo, UInt32 psInfoLen)
+{
+    PktMetaSlot*        pSlot;
+    UInt32              tag;
+
+    if (pPsInfo == NULL || psInfoLen < BCP_TEST_PKT_META_PS_WORDS * 4)
+        return NULL;
+
+    tag     =   *(const UInt32 *) pPsInfo;
+    pSlot   =   &pktMetaTbl [tag & PKT_META_TAG_IDX_MASK];
+    if (tag == 0 || pSlot->tag != tag)
+        return NULL;
+
+    return &pSlot->meta;
+}
+
+/** ============================================================================
+ *   @n@b pkt_meta_release
+ *
+ *   @b Description
+ *   @n Removes a packet returned by @a pkt_meta_lookup () from the table of
+ *      packets in flight.
+ *
+ *   @param[in]
+ *   @n pMeta       Metadata of the packet.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void pkt_meta_release (BcpTest_PktMeta* pMeta)
+{
+    PktMetaSlot*        pSlot = (PktMetaSlot *) pMeta;
+    UInt32              idx = pSlot - pktMetaTbl;
+
+    if (idx >= BCP_TEST_PKT_META_MAX_INFLIGHT || pSlot->tag == 0)
+        return;
+
+    pSlot->tag          =   0;
+    pSlot->nextFree     =   pktMetaFreeHead;
+    pktMetaFreeHead     =   idx;
+    pktMetaNumInFlight --;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b pkt_meta_num_inflight
+ *
+ *   @b Description
+ *   @n Returns the number of packets submitted and not yet released.
+ * =============================================================================
+ */
+UInt32 pkt_meta_num_inflight (Void)
+{
+    return pktMetaNumInFlight;
+}
@@ -0,0 +1,299 @@
+/**
+ *   @file  test_stats.c
+ *
+ *   @brief
+ *      Error statistics of the tests, per configuration and SNR bin.
+ *
+ *      A test reports each transport block it checks with its SNR: the hard
+ *      decision bits checked and in error, whether the block failed, its
+ *      size, its code blocks and code block CRC failures, and the
+ *      transmissions combined for it. The counters are kept per core, each
+ *      core in its own table of shared memory, so no lock is taken while
+ *      counting. The tables of all cores are merged when reported, once the
+ *      tests are done, into BER, BLER and throughput against SNR tables
+ *      written as CSV.
+ *
+ *      Configurations are matched by name across cores, so each core may
+ *      register its configurations in any order.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+/* 'STAT' */
+#define STATS_MAGIC                         0x53544154u
+
+/* L2 cache line, that the table of each core is aligned to */
+#define STATS_LINE_SIZE                     128
+
+/* Counters of the configurations of a core */
+typedef struct _StatsTbl
+{
+    UInt32              magic;          /* STATS_MAGIC once set up by stats_init () */
+    UInt32              numCfgs;
+    Char                cfgName [BCP_TEST_STATS_MAX_CFGS][BCP_TEST_STATS_CFG_NAME_LEN];
+    BcpTest_StatsBin    bins [BCP_TEST_STATS_MAX_CFGS][BCP_TEST_STATS_NUM_BINS];
+} StatsTbl;
+
+/* Table padded to whole cache lines, so that cores never share a line */
+typedef union _StatsTblLines
+{
+    StatsTbl            tbl;
+    UInt8               lines [(sizeof (StatsTbl) + STATS_LINE_SIZE - 1) / STATS_LINE_SIZE * STATS_LINE_SIZE];
+} StatsTblLines;
+
+#pragma DATA_SECTION (statsTbl, ".bcp");
+#pragma DATA_ALIGN (statsTbl, STATS_LINE_SIZE)
+static StatsTblLines    statsTbl [BCP_TEST_STATS_MAX_CORES];
+
+/* Tables of all cores merged by stats_report () */
+#pragma DATA_SECTION (statsMerged, ".testData");
+static StatsTbl         statsMerged;
+
+static StatsTbl* stats_core_tbl (Void)
+{
+#ifdef _TMS320C6X
+    return &statsTbl [CSL_chipReadReg (CSL_CHIP_DNUM) % BCP_TEST_STATS_MAX_CORES].tbl;
+#else
+    return &statsTbl [0].tbl;
+#endif
+}
+
+static UInt32 stats_snr_bin (float snrDb)
+{
+    float               pos = (snrDb - BCP_TEST_STATS_MIN_SNR_DB) / BCP_TEST_STATS_BIN_DB;
+
+    /* Also takes NaN to the first bin */
+    if (!(pos > 0.0f))
+        return 0;
+    if (pos >= (float) BCP_TEST_STATS_NUM_BINS)
+        return BCP_TEST_STATS_NUM_BINS - 1;
+
+    return (UInt32) pos;
+}
+
+/* Index of a configuration in a table, added if new. Returns -1 if the
+ * table is full.
+ */
+static Int32 stats_find_cfg (StatsTbl* pTbl, const char* pName)
+{
+    UInt32              i;
+
+    for (i = 0; i < pTbl->numCfgs; i ++)
+    {
+        if (strncmp (pTbl->cfgName [i], pName, BCP_TEST_STATS_CFG_NAME_LEN - 1) == 0)
+            return (Int32) i;
+    }
+    if (pTbl->numCfgs == BCP_TEST_STATS_MAX_CFGS)
+        return -1;
+
+    strncpy (pTbl->cfgName [i], pName, BCP_TEST_STATS_CFG_NAME_LEN - 1);
+    pTbl->cfgName [i][BCP_TEST_STATS_CFG_NAME_LEN - 1] =   '\0';
+    memset (pTbl->bins [i], 0, sizeof (pTbl->bins [i]));
+    pTbl->numCfgs ++;
+
+    return (Int32) i;
+}
+
+/** ============================================================================
+ *   @n@b stats_init
+ *
+ *   @b Description
+ *   @n Clears the statistics of this core. Called by each core before its
+ *      tests run.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void stats_init (Void)
+{
+    StatsTbl*           pTbl = stats_core_tbl ();
+
+    memset (pTbl, 0, sizeof (StatsTbl));
+    pTbl->magic =   STATS_MAGIC;
+    stats_flush ();
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b stats_cfg_id
+ *
+ *   @b Description
+ *   @n Returns the id of a configuration on this core, adding it if new.
+ *
+ *   @param[in]
+ *   @n pName       Configuration name, at most BCP_TEST_STATS_CFG_NAME_LEN - 1
+ *                  characters are kept.
+ *
+ *   @return        Int32
+ *   @n >=0     -   Configuration id.
+ *
+ *   @n -1      -   BCP_TEST_STATS_MAX_CFGS configurations in use already.
+ * =============================================================================
+ */
+Int32 stats_cfg_id (const char* pName)
+{
+    return stats_find_cfg (stats_core_tbl (), pName);
+}
+
+/** ============================================================================
+ *   @n@b stats_add_block
+ *
+ *   @b Description
+ *   @n Counts the result of a transport block in the SNR bin of its
+ *      configuration. The counters are written back to shared memory by
+ *      @a stats_flush ().
+ *
+ *   @param[in]
+ *   @n cfgId       Configuration id from @a stats_cfg_id ().
+ *
+ *   @param[in]
+ *   @n pBlock      Result of the block.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void stats_add_block (UInt32 cfgId, const BcpTest_StatsBlock* pBlock)
+{
+    StatsTbl*           pTbl = stats_core_tbl ();
+    BcpTest_StatsBin*   pBin;
+
+    if (cfgId >= pTbl->numCfgs)
+        return;
+
+    pBin    =   &pTbl->bins [cfgId][stats_snr_bin (pBlock->snrDb)];
+    pBin->numBlocks ++;
+    pBin->numCodeBlks   +=  pBlock->numCodeBlks;
+    pBin->numCbCrcFails +=  pBlock->numCbCrcFails;
+    pBin->numTrans      +=  pBlock->numTrans;
+    if (pBlock->numTrans > 1)
+        pBin->numRetrans    +=  pBlock->numTrans - 1;
+    pBin->numBits       +=  pBlock->numBits;
+    pBin->numBitErrs    +=  pBlock->numBitErrs;
+    if (pBlock->bBlockErr || pBlock->numBitErrs || pBlock->numCbCrcFails)
+        pBin->numBlockErrs ++;
+    else
+        pBin->numGoodBits   +=  pBlock->numTbBits;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b stats_flush
+ *
+ *   @b Description
+ *   @n Writes the statistics of this core back to shared memory, for
+ *      @a stats_report () on another core. Called by each test once done.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void stats_flush (Void)
+{
+    Bcp_osalEndMemAccess ((Void *) stats_core_tbl (), sizeof (StatsTblLines));
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b stats_report
+ *
+ *   @b Description
+ *   @n Merges the statistics of all cores, and logs the BLER and BER of each
+ *      configuration and SNR bin counted. Called on one core once all cores
+ *      are done with their tests.
+ *
+ *      With a file given, the merged counters are also written to it as CSV,
+ *      one row per configuration and SNR bin, along with the BER of the hard
+ *      decisions, the BLER and the throughput in bits per transmission, i.e.,
+ *      the transport block bits of the blocks without error over the
+ *      transmissions made.
+ *
+ *   @param[in]
+ *   @n fp          CSV file, or NULL.
+ *
+ *   @return        Int32
+ *   @n Number of configuration and SNR bins reported.
+ * =============================================================================
+ */
+Int32 stats_report (FILE* fp)
+{
+    StatsTbl*           pTbl;
+    BcpTest_StatsBin*   pIn;
+    BcpTest_StatsBin*   pOut;
+    UInt32              core, cfg, bin;
+    Int32               cfgIdx, numRows = 0, snrTenths, snrAbs;
+    float               snrDb;
+
+    memset (&statsMerged, 0, sizeof (StatsTbl));
+    for (core = 0; core < BCP_TEST_STATS_MAX_CORES; core ++)
+    {
+        pTbl    =   &statsTbl [core].tbl;
+        Bcp_osalBeginMemAccess ((Void *) pTbl, sizeof (StatsTblLines));
+        if (pTbl->magic != STATS_MAGIC || pTbl->numCfgs > BCP_TEST_STATS_MAX_CFGS)
+            continue;
+
+        for (cfg = 0; cfg < pTbl->numCfgs; cfg ++)
+        {
+            if ((cfgIdx = stats_find_cfg (&statsMerged, pTbl->cfgName [cfg])) < 0)
+                continue;
+
+            for (bin = 0; bin < BCP_TEST_STATS_NUM_BINS; bin ++)
+            {
+                pIn     =   &pTbl->bins [cfg][bin];
+                pOut    =   &statsMerged.bins [cfgIdx][bin];
+                pOut->numBlocks     +=  pIn->numBlocks;
+                pOut->numBlockErrs  +=  pIn->numBlockErrs;
+                pOut->numCodeBlks   +=  pIn->numCodeBlks;
+                pOut->numCbCrcFails +=  pIn->numCbCrcFails;
+                pOut->numTrans      +=  pIn->numTrans;
+                pOut->numRetrans    +=  pIn->numRetrans;
+                pOut->numBits       +=  pIn->numBits;
+                pOut->numBitErrs    +=  pIn->numBitErrs;
+                pOut->numGoodBits   +=  pIn->numGoodBits;
+            }
+        }
+    }
+
+    if (fp != NULL)
+        fprintf (fp, "cfg,snr_db,blocks,block_errs,bler,bits,bit_errs,ber,code_blocks,cb_crc_fails,"
+                     "transmissions,retransmissions,throughput_bits_per_tx\n");
+
+    for (cfg = 0; cfg < statsMerged.numCfgs; cfg ++)
+    {
+        for (bin = 0; bin < BCP_TEST_STATS_NUM_BINS; bin ++)
+        {
+            pOut    =   &statsMerged.bins [cfg][bin];
+            if (pOut->numBlocks == 0)
+                continue;
+            numRows ++;
+
+            /* Lower edge of the bin */
+            snrDb       =   BCP_TEST_STATS_MIN_SNR_DB + bin * BCP_TEST_STATS_BIN_DB;
+            snrTenths   =   (Int32) (snrDb * 10.0f + ((snrDb < 0.0f) ? -0.5f : 0.5f));
+            snrAbs      =   (snrTenths < 0) ? -snrTenths : snrTenths;
+            Bcp_osalLog ("Stats %s, SNR %s%d.%d dB: %d/%d blocks in error, %d/%d bits in error, %d/%d code block CRC failures, %d retransmissions \n",
+                         statsMerged.cfgName [cfg], (snrTenths < 0) ? "-" : "", snrAbs / 10, snrAbs % 10,
+                         pOut->numBlockErrs, pOut->numBlocks, (UInt32) pOut->numBitErrs, (UInt32) pOut->numBits,
+                         pOut->numCbCrcFails, pOut->numCodeBlks, pOut->numRetrans);
+
+            if (fp != NULL)
+            {
+                fprintf (fp, "%s,%.1f,%u,%u,%.6e,%llu,%llu,%.6e,%u,%u,%u,%u,%.1f\n",
+                         statsMerged.cfgName [cfg], snrDb, pOut->numBlocks, pOut->numBlockErrs,
+                         (double) pOut->numBlockErrs / pOut->numBlocks,
+                         (unsigned long long) pOut->numBits, (unsigned long long) pOut->numBitErrs,
+                         pOut->numBits ? (double) pOut->numBitErrs / pOut->numBits : 0.0,
+                         pOut->numCodeBlks, pOut->numCbCrcFails, pOut->numTrans, pOut->numRetrans,
+                         pOut->numTrans ? (double) pOut->numGoodBits / pOut->numTrans : 0.0);
+            }
+        }
+    }
+
+    return numRows;
+}
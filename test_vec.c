@@ -0,0 +1,722 @@
+/**
+ *   @file  test_vec.c
+ *
+ *   @brief
+ *      Binary test vector loader.
+ *
+ *      Loads a test vector file written by tools/vec_conv.c, see
+ *      bcp_test_vec.h for the format. On the DSP the file is read with a
+ *      single block read into a 64 byte aligned buffer; on the host it is
+ *      mapped. Either way the words are handed out in place instead of
+ *      being parsed and copied, and a file written on a target of the
+ *      other endianness is byte swapped in place.
+ *
+ *      Vectors too large to be loaded whole are streamed instead, a record
+ *      at a time, by a reader that keeps a ring of record buffers filled
+ *      ahead of the consumer.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include "bcp_test.h"
+
+#ifndef _TMS320C6X
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <time.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/** ============================================================================
+ *   @n@b vec_map_file
+ *
+ *   @b Description
+ *   @n Brings a whole file into memory, 64 byte aligned and writable.
+ * =============================================================================
+ */
+static Int32 vec_map_file (const char* pFileName, BcpTest_Vec* pVec, UInt8** ppFile, UInt32* pFileLen)
+{
+#ifdef _TMS320C6X
+    FILE*               fp;
+    long                fileLen;
+
+    if ((fp = fopen (pFileName, "rb")) == NULL)
+        return -1;
+    if (fseek (fp, 0, SEEK_END) != 0 || (fileLen = ftell (fp)) <= 0)
+    {
+        fclose (fp);
+        return -1;
+    }
+    rewind (fp);
+
+    pVec->memLen    =   (UInt32) fileLen + BCP_TEST_VEC_ALIGN;
+    if ((pVec->pMem = Bcp_osalMalloc (pVec->memLen, FALSE)) == NULL)
+    {
+        fclose (fp);
+        return -1;
+    }
+    *ppFile     =   (UInt8 *) (((UInt32) pVec->pMem + BCP_TEST_VEC_ALIGN - 1) & ~(BCP_TEST_VEC_ALIGN - 1));
+    *pFileLen   =   (UInt32) fileLen;
+
+    /* One block read of the whole file */
+    if (fread (*ppFile, 1, fileLen, fp) != (size_t) fileLen)
+    {
+        fclose (fp);
+        Bcp_osalFree (pVec->pMem, pVec->memLen, FALSE);
+        pVec->pMem  =   NULL;
+        return -1;
+    }
+    fclose (fp);
+#else
+    struct stat         fileStat;
+    Int32               fd;
+
+    if ((fd = open (pFileName, O_RDONLY)) < 0)
+        return -1;
+    if (fstat (fd, &fileStat) != 0 || fileStat.st_size <= 0)
+    {
+        close (fd);
+        return -1;
+    }
+
+    /* Private mapping, so that the words can be swapped in place */
+    pVec->memLen    =   (UInt32) fileStat.st_size;
+    pVec->pMem      =   mmap (NULL, pVec->memLen, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close (fd);
+    if (pVec->pMem == MAP_FAILED)
+    {
+        pVec->pMem  =   NULL;
+        return -1;
+    }
+    *ppFile     =   (UInt8 *) pVec->pMem;
+    *pFileLen   =   pVec->memLen;
+#endif
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b vec_check_hdr
+ *
+ *   @b Description
+ *   @n Checks the header of a test vector file of fileLen bytes, and brings
+ *      it to the byte order of the target. Sets *pbSwap if the words of the
+ *      vector need swapping too.
+ * =============================================================================
+ */
+static Int32 vec_check_hdr (BcpTest_VecHdr* pHdr, UInt64 fileLen, Bool* pbSwap)
+{
+    if (fileLen < sizeof (BcpTest_VecHdr))
+        return -1;
+
+    /* Header in the byte order of the target */
+    if (pHdr->endianTag == BCP_TEST_VEC_ENDIAN_TAG)
+        *pbSwap =   FALSE;
+    else if (pHdr->endianTag == BCP_TEST_VEC_SWAP32 (BCP_TEST_VEC_ENDIAN_TAG))
+        *pbSwap =   TRUE;
+    else
+        return -1;
+    if (*pbSwap)
+    {
+        pHdr->magic         =   BCP_TEST_VEC_SWAP32 (pHdr->magic);
+        pHdr->endianTag     =   BCP_TEST_VEC_ENDIAN_TAG;
+        pHdr->version       =   (UInt16) ((pHdr->version >> 8) | (pHdr->version << 8));
+        pHdr->format        =   (UInt16) ((pHdr->format >> 8) | (pHdr->format << 8));
+        pHdr->numWords      =   BCP_TEST_VEC_SWAP32 (pHdr->numWords);
+        pHdr->dataOffset    =   BCP_TEST_VEC_SWAP32 (pHdr->dataOffset);
+        pHdr->checksum      =   BCP_TEST_VEC_SWAP32 (pHdr->checksum);
+    }
+    if (pHdr->magic != BCP_TEST_VEC_MAGIC || pHdr->version != BCP_TEST_VEC_VERSION ||
+        pHdr->dataOffset < sizeof (BcpTest_VecHdr) || (pHdr->dataOffset & (BCP_TEST_VEC_ALIGN - 1)) ||
+        pHdr->dataOffset > fileLen || pHdr->numWords > (fileLen - pHdr->dataOffset) / 4)
+        return -1;
+
+    return 0;
+}
+
+/** ============================================================================
+ *   @n@b vec_open_file
+ *
+ *   @b Description
+ *   @n Opens a test vector file and reads its header, brought to the byte
+ *      order of the target, see @a vec_check_hdr (). The file is left at the
+ *      first word of the vector.
+ * =============================================================================
+ */
+static FILE* vec_open_file (const char* pFileName, BcpTest_VecHdr* pHdr, Bool* pbSwap)
+{
+    FILE*               fp;
+    UInt64              fileLen;
+#ifndef _TMS320C6X
+    struct stat         fileStat;
+#endif
+
+    if ((fp = fopen (pFileName, "rb")) == NULL)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Cannot open test vector file: %s \n", pFileName);
+#endif
+        return NULL;
+    }
+#ifdef _TMS320C6X
+    if (fseek (fp, 0, SEEK_END) != 0 || ftell (fp) <= 0)
+    {
+        fclose (fp);
+        return NULL;
+    }
+    fileLen =   (UInt64) ftell (fp);
+    rewind (fp);
+#else
+    if (fstat (fileno (fp), &fileStat) != 0)
+    {
+        fclose (fp);
+        return NULL;
+    }
+    fileLen =   (UInt64) fileStat.st_size;
+#endif
+
+    if (fread (pHdr, 1, sizeof (BcpTest_VecHdr), fp) != sizeof (BcpTest_VecHdr) ||
+        vec_check_hdr (pHdr, fileLen, pbSwap) < 0 || fseek (fp, (long) pHdr->dataOffset, SEEK_SET) != 0)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Not a test vector file: %s \n", pFileName);
+#endif
+        fclose (fp);
+        return NULL;
+    }
+
+    return fp;
+}
+
+/** ============================================================================
+ *   @n@b vec_release
+ *
+ *   @b Description
+ *   @n Frees a test vector loaded by @a vec_load (). Pointers into the vector
+ *      are no longer valid afterwards.
+ *
+ *   @param[in]
+ *   @n pVec        Test vector.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void vec_release (BcpTest_Vec* pVec)
+{
+    if (pVec->pMem == NULL)
+        return;
+
+#ifdef _TMS320C6X
+    Bcp_osalFree (pVec->pMem, pVec->memLen, FALSE);
+#else
+    munmap (pVec->pMem, pVec->memLen);
+#endif
+    pVec->pMem      =   NULL;
+    pVec->pHdr      =   NULL;
+    pVec->pWords    =   NULL;
+    pVec->numWords  =   0;
+
+    return;
+}
+
+/** ============================================================================
+ *   @n@b vec_load
+ *
+ *   @b Description
+ *   @n Loads a binary test vector file. The header and checksum are checked,
+ *      and on success the words of the vector are returned in place in
+ *      pVec->pWords, 64 byte aligned, until @a vec_release () is called.
+ *
+ *   @param[in]
+ *   @n pFileName   Test vector file.
+ *
+ *   @param[out]
+ *   @n pVec        Test vector loaded.
+ *
+ *   @return        Int32
+ *   @n 0       -   Test vector loaded.
+ *
+ *   @n -1      -   File missing, malformed or corrupt.
+ * =============================================================================
+ */
+Int32 vec_load (const char* pFileName, BcpTest_Vec* pVec)
+{
+    BcpTest_VecHdr*     pHdr;
+    UInt32*             pWords;
+    UInt8*              pFile;
+    UInt32              fileLen, cksum, word, i;
+    Bool                bSwap;
+
+    memset (pVec, 0, sizeof (BcpTest_Vec));
+    if (vec_map_file (pFileName, pVec, &pFile, &fileLen) < 0)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Cannot load test vector file: %s \n", pFileName);
+#endif
+        return -1;
+    }
+
+    pHdr    =   (BcpTest_VecHdr *) pFile;
+    if (vec_check_hdr (pHdr, fileLen, &bSwap) < 0)
+        goto malformed;
+
+    /* Check the words as written, and bring them to the target byte order */
+    pWords  =   (UInt32 *) (pFile + pHdr->dataOffset);
+    cksum   =   0;
+    if (!bSwap)
+    {
+        for (i = 0; i < pHdr->numWords; i ++)
+            cksum   =   BCP_TEST_VEC_CKSUM_STEP (cksum, pWords [i]);
+    }
+    else
+    {
+        for (i = 0; i < pHdr->numWords; i ++)
+        {
+            word    =   BCP_TEST_VEC_SWAP32 (pWords [i]);
+            cksum   =   BCP_TEST_VEC_CKSUM_STEP (cksum, word);
+            if (pHdr->format != BCP_TEST_VEC_FMT_BYTES)
+                pWords [i]  =   word;
+        }
+    }
+    if (cksum != pHdr->checksum)
+    {
+#ifdef BCP_TEST_DEBUG
+        Bcp_osalLog ("Test vector %s: checksum 0x%08x, expected 0x%08x \n", pFileName, cksum, pHdr->checksum);
+#endif
+        vec_release (pVec);
+        return -1;
+    }
+
+    pVec->pHdr      =   pHdr;
+    pVec->pWords    =   pWords;
+    pVec->numWords  =   pHdr->numWords;
+
+    return 0;
+
+malformed:
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("Not a test vector file: %s \n", pFileName);
+#endif
+    vec_release (pVec);
+    return -1;
+}
+
+/** ============================================================================
+ *   @n@b vec_read_words
+ *
+ *   @b Description
+ *   @n Reads a range of words of a test vector file, without loading the
+ *      rest of it. The words are brought to the target byte order as by
+ *      @a vec_load (); as the range is read alone the file checksum is not
+ *      checked.
+ *
+ *   @param[in]
+ *   @n pFileName   Test vector file.
+ *
+ *   @param[in]
+ *   @n firstWord   First word to read.
+ *
+ *   @param[in]
+ *   @n numWords    Number of words to read.
+ *
+ *   @param[out]
+ *   @n pWords      Words read.
+ *
+ *   @return        Int32
+ *   @n 0       -   Words read.
+ *
+ *   @n -1      -   File missing or malformed, or the range past its end.
+ * =============================================================================
+ */
+Int32 vec_read_words (const char* pFileName, UInt32 firstWord, UInt32 numWords, UInt32* pWords)
+{
+    BcpTest_VecHdr      hdr;
+    FILE*               fp;
+    Bool                bSwap;
+    Int32               retVal = -1;
+    UInt32              i;
+
+    if ((fp = vec_open_file (pFileName, &hdr, &bSwap)) == NULL)
+        return -1;
+
+    if (firstWord <= hdr.numWords && numWords <= hdr.numWords - firstWord &&
+        fseek (fp, (long) (hdr.dataOffset + firstWord * 4), SEEK_SET) == 0 &&
+        fread (pWords, 4, numWords, fp) == numWords)
+    {
+        if (bSwap && hdr.format != BCP_TEST_VEC_FMT_BYTES)
+        {
+            for (i = 0; i < numWords; i ++)
+                pWords [i]  =   BCP_TEST_VEC_SWAP32 (pWords [i]);
+        }
+        retVal  =   0;
+    }
+
+    fclose (fp);
+    return retVal;
+}
+
+/* Vector stream: a reader task (a thread on the host) fills a ring of
+ * record buffers ahead of the consumer. semFree counts the buffers the reader
+ * may fill, semFull the buffers filled. A record of 0 words marks the end of
+ * the vector.
+ */
+struct _BcpTest_VecStream
+{
+    FILE*               fp;
+    UInt32              recordWords;
+    UInt32              bufStride;      /* Words, a multiple of 64 bytes */
+    UInt32              numBufs;
+    UInt32*             pBufs;
+    Void*               pMem;
+    UInt32              memLen;
+    UInt32              recordLen [BCP_TEST_VEC_STREAM_MAX_BUFS];
+    UInt32              head;           /* Next buffer consumed */
+    UInt32              tail;           /* Next buffer filled */
+    UInt32              numWordsLeft;   /* Words not read yet */
+    UInt32              cksum;
+    UInt32              expCksum;
+    UInt16              format;
+    Bool                bSwap;
+    Bool                bEnd;           /* End of the vector consumed */
+    volatile Bool       bStop;
+    volatile Int32      status;
+    BcpTest_VecStreamStats  stats;
+#ifdef _TMS320C6X
+    Semaphore_Handle    semFree;
+    Semaphore_Handle    semFull;
+    Semaphore_Handle    semDone;
+    Task_Handle         hReader;
+#else
+    sem_t               semFree;
+    sem_t               semFull;
+    pthread_t           reader;
+#endif
+};
+
+#ifdef _TMS320C6X
+#define VEC_STREAM_PEND(sem)                Semaphore_pend ((sem), BIOS_WAIT_FOREVER)
+#define VEC_STREAM_TRY_PEND(sem)            Semaphore_pend ((sem), BIOS_NO_WAIT)
+#define VEC_STREAM_POST(sem)                Semaphore_post (sem)
+#define VEC_STREAM_MALLOC(len)              Bcp_osalMalloc ((len), FALSE)
+#define VEC_STREAM_FREE(ptr, len)           Bcp_osalFree ((ptr), (len), FALSE)
+#else
+#define VEC_STREAM_PEND(sem)                while (sem_wait (&(sem)) != 0)
+#define VEC_STREAM_TRY_PEND(sem)            (sem_trywait (&(sem)) == 0)
+#define VEC_STREAM_POST(sem)                sem_post (&(sem))
+#define VEC_STREAM_MALLOC(len)              malloc (len)
+#define VEC_STREAM_FREE(ptr, len)           free (ptr)
+#endif
+
+/* Time stamp for the stall time: TSCL cycles on the DSP, ns on the host */
+static UInt32 vec_stream_timestamp (Void)
+{
+#ifdef _TMS320C6X
+    return TSCL;
+#else
+    struct timespec     now;
+
+    clock_gettime (CLOCK_MONOTONIC, &now);
+    return (UInt32) ((UInt64) now.tv_sec * 1000000000u + (UInt64) now.tv_nsec);
+#endif
+}
+
+/* Reads the vector into the ring, one record per buffer, until the end of
+ * the vector, an error, or the stream is closed.
+ */
+static Void vec_stream_read (BcpTest_VecStream* pStream)
+{
+    UInt32*             pBuf;
+    UInt32              numWords, word, i;
+
+    while (pStream->numWordsLeft)
+    {
+        VEC_STREAM_PEND (pStream->semFree);
+        if (pStream->bStop)
+            return;
+
+        pBuf        =   pStream->pBufs + pStream->tail * pStream->bufStride;
+        numWords    =   pStream->numWordsLeft < pStream->recordWords ? pStream->numWordsLeft : pStream->recordWords;
+        if (fread (pBuf, 4, numWords, pStream->fp) != numWords)
+        {
+            pStream->status =   -1;
+            break;
+        }
+
+        /* Check the words as written, and bring them to the target byte order */
+        for (i = 0; i < numWords; i ++)
+        {
+            word                =   pStream->bSwap ? BCP_TEST_VEC_SWAP32 (pBuf [i]) : pBuf [i];
+            pStream->cksum      =   BCP_TEST_VEC_CKSUM_STEP (pStream->cksum, word);
+            if (pStream->bSwap && pStream->format != BCP_TEST_VEC_FMT_BYTES)
+                pBuf [i]        =   word;
+        }
+
+        pStream->recordLen [pStream->tail]  =   numWords;
+        pStream->tail                       =   (pStream->tail + 1) % pStream->numBufs;
+        pStream->numWordsLeft               -=  numWords;
+        VEC_STREAM_POST (pStream->semFull);
+    }
+    if (pStream->status == 0 && pStream->cksum != pStream->expCksum)
+        pStream->status =   -1;
+    if (pStream->status == 0)
+        pStream->status =   1;
+
+    /* End of the vector */
+    VEC_STREAM_PEND (pStream->semFree);
+    if (pStream->bStop)
+        return;
+    pStream->recordLen [pStream->tail]  =   0;
+    VEC_STREAM_POST (pStream->semFull);
+
+    return;
+}
+
+#ifdef _TMS320C6X
+static Void vec_stream_reader_task (UArg arg0, UArg arg1)
+{
+    BcpTest_VecStream*  pStream = (BcpTest_VecStream *) arg0;
+
+    vec_stream_read (pStream);
+    Semaphore_post (pStream->semDone);
+}
+#else
+static void* vec_stream_reader_thread (void* pArg)
+{
+    vec_stream_read ((BcpTest_VecStream *) pArg);
+    return NULL;
+}
+#endif
+
+/** ============================================================================
+ *   @n@b vec_stream_close
+ *
+ *   @b Description
+ *   @n Stops the reader of a vector stream opened by @a vec_stream_open ()
+ *      and frees the stream. Records returned by @a vec_stream_get () are
+ *      no longer valid afterwards.
+ *
+ *   @param[in]
+ *   @n pStream     Vector stream.
+ *
+ *   @param[out]
+ *   @n pStats      Statistics of the stream, or NULL.
+ *
+ *   @return        Int32
+ *   @n 0       -   No error, whether or not the whole vector was read.
+ *
+ *   @n -1      -   Read error, or checksum mismatch of the vector.
+ * =============================================================================
+ */
+Int32 vec_stream_close (BcpTest_VecStream* pStream, BcpTest_VecStreamStats* pStats)
+{
+    Int32               retVal;
+
+    /* Wake up the reader if it waits on a free buffer, and wait for it */
+    pStream->bStop  =   TRUE;
+    VEC_STREAM_POST (pStream->semFree);
+#ifdef _TMS320C6X
+    Semaphore_pend (pStream->semDone, BIOS_WAIT_FOREVER);
+    Task_delete (&pStream->hReader);
+    Semaphore_delete (&pStream->semFree);
+    Semaphore_delete (&pStream->semFull);
+    Semaphore_delete (&pStream->semDone);
+#else
+    pthread_join (pStream->reader, NULL);
+    sem_destroy (&pStream->semFree);
+    sem_destroy (&pStream->semFull);
+#endif
+
+    retVal  =   (pStream->status < 0) ? -1 : 0;
+    if (pStats != NULL)
+        *pStats =   pStream->stats;
+
+    fclose (pStream->fp);
+    VEC_STREAM_FREE (pStream->pMem, pStream->memLen);
+
+    return retVal;
+}
+
+/** ============================================================================
+ *   @n@b vec_stream_open
+ *
+ *   @b Description
+ *   @n Opens a binary test vector file too large to be loaded whole, to be
+ *      read a record of recordWords words at a time. A reader task, running
+ *      at the priority of the calling task, reads up to numBufs records ahead
+ *      into a ring of buffers while the caller consumes the records with
+ *      @a vec_stream_get () and @a vec_stream_put (). On the host the reader
+ *      is a thread.
+ *
+ *   @param[in]
+ *   @n pFileName   Test vector file.
+ *
+ *   @param[in]
+ *   @n recordWords Words per record. The last record of the vector may be
+ *                  shorter.
+ *
+ *   @param[in]
+ *   @n numBufs     Number of record buffers, 2 to BCP_TEST_VEC_STREAM_MAX_BUFS.
+ *
+ *   @return        BcpTest_VecStream*
+ *   @n Vector stream, NULL if the file is missing or malformed or out of
+ *      memory.
+ * =============================================================================
+ */
+BcpTest_VecStream* vec_stream_open (const char* pFileName, UInt32 recordWords, UInt32 numBufs)
+{
+    BcpTest_VecStream*  pStream;
+    BcpTest_VecHdr      hdr;
+    FILE*               fp;
+    UInt32              bufStride, memLen;
+    Void*               pMem;
+    Bool                bSwap;
+#ifdef _TMS320C6X
+    Task_Params         readerTaskParams;
+#endif
+
+    if (recordWords == 0 || numBufs < 2 || numBufs > BCP_TEST_VEC_STREAM_MAX_BUFS)
+        return NULL;
+
+    if ((fp = vec_open_file (pFileName, &hdr, &bSwap)) == NULL)
+        return NULL;
+
+    /* Stream, then the record buffers 64 byte aligned */
+    bufStride   =   ((recordWords * 4 + BCP_TEST_VEC_ALIGN - 1) & ~(BCP_TEST_VEC_ALIGN - 1)) / 4;
+    memLen      =   sizeof (BcpTest_VecStream) + BCP_TEST_VEC_ALIGN + numBufs * bufStride * 4;
+    if ((pMem = VEC_STREAM_MALLOC (memLen)) == NULL)
+    {
+        fclose (fp);
+        return NULL;
+    }
+    pStream     =   (BcpTest_VecStream *) pMem;
+    memset (pStream, 0, sizeof (BcpTest_VecStream));
+    pStream->pMem           =   pMem;
+    pStream->memLen         =   memLen;
+    pStream->pBufs          =   (UInt32 *) (((uintptr_t) (pStream + 1) + BCP_TEST_VEC_ALIGN - 1) & ~(uintptr_t) (BCP_TEST_VEC_ALIGN - 1));
+    pStream->fp             =   fp;
+    pStream->recordWords    =   recordWords;
+    pStream->bufStride      =   bufStride;
+    pStream->numBufs        =   numBufs;
+    pStream->numWordsLeft   =   hdr.numWords;
+    pStream->expCksum       =   hdr.checksum;
+    pStream->format         =   hdr.format;
+    pStream->bSwap          =   bSwap;
+
+#ifdef _TMS320C6X
+    pStream->semFree  =   Semaphore_create (numBufs, NULL, NULL);
+    pStream->semFull  =   Semaphore_create (0, NULL, NULL);
+    pStream->semDone  =   Semaphore_create (0, NULL, NULL);
+    if (pStream->semFree == NULL || pStream->semFull == NULL || pStream->semDone == NULL)
+        goto error;
+
+    Task_Params_init (&readerTaskParams);
+    readerTaskParams.stackSize  =   4096;
+    readerTaskParams.priority   =   Task_getPri (Task_self ());
+    readerTaskParams.arg0       =   (UArg) pStream;
+    if ((pStream->hReader = Task_create ((Task_FuncPtr) &vec_stream_reader_task, &readerTaskParams, NULL)) == NULL)
+        goto error;
+#else
+    sem_init (&pStream->semFree, 0, numBufs);
+    sem_init (&pStream->semFull, 0, 0);
+    if (pthread_create (&pStream->reader, NULL, vec_stream_reader_thread, pStream) != 0)
+    {
+        sem_destroy (&pStream->semFree);
+        sem_destroy (&pStream->semFull);
+        goto error;
+    }
+#endif
+
+    return pStream;
+
+error:
+#ifdef BCP_TEST_DEBUG
+    Bcp_osalLog ("Cannot start the reader of test vector file: %s \n", pFileName);
+#endif
+#ifdef _TMS320C6X
+    if (pStream->semFree)
+        Semaphore_delete (&pStream->semFree);
+    if (pStream->semFull)
+        Semaphore_delete (&pStream->semFull);
+    if (pStream->semDone)
+        Semaphore_delete (&pStream->semDone);
+#endif
+    fclose (fp);
+    VEC_STREAM_FREE (pMem, memLen);
+    return NULL;
+}
+
+/** ============================================================================
+ *   @n@b vec_stream_get
+ *
+ *   @b Description
+ *   @n Returns the next record of a vector stream, in the byte order of the
+ *      target, waiting for it to be read if it is not yet. The time waited
+ *      is counted in the statistics of the stream. The record remains valid
+ *      until it is handed back with @a vec_stream_put (). Several records
+ *      may be held at once, up to the number of buffers of the stream.
+ *
+ *   @param[in]
+ *   @n pStream     Vector stream.
+ *
+ *   @param[out]
+ *   @n pNumWords   Words in the record.
+ *
+ *   @return        const UInt32*
+ *   @n Record, NULL at the end of the vector or on a read error. A checksum
+ *      mismatch is reported by @a vec_stream_close ().
+ * =============================================================================
+ */
+const UInt32* vec_stream_get (BcpTest_VecStream* pStream, UInt32* pNumWords)
+{
+    const UInt32*       pRecord;
+    UInt32              startTime;
+
+    if (pStream->bEnd)
+        return NULL;
+
+    if (!VEC_STREAM_TRY_PEND (pStream->semFull))
+    {
+        /* Storage did not keep up */
+        startTime   =   vec_stream_timestamp ();
+        VEC_STREAM_PEND (pStream->semFull);
+        pStream->stats.stallTime    +=  (UInt32) (vec_stream_timestamp () - startTime);
+        pStream->stats.numStalls ++;
+    }
+
+    if ((*pNumWords = pStream->recordLen [pStream->head]) == 0)
+    {
+        pStream->bEnd   =   TRUE;
+        return NULL;
+    }
+    pRecord         =   pStream->pBufs + pStream->head * pStream->bufStride;
+    pStream->head   =   (pStream->head + 1) % pStream->numBufs;
+    pStream->stats.numRecords ++;
+
+    return pRecord;
+}
+
+/** ============================================================================
+ *   @n@b vec_stream_put
+ *
+ *   @b Description
+ *   @n Hands the oldest record held back to the reader of the stream, to be
+ *      filled again.
+ *
+ *   @param[in]
+ *   @n pStream     Vector stream.
+ *
+ *   @return
+ *   @n None.
+ * =============================================================================
+ */
+Void vec_stream_put (BcpTest_VecStream* pStream)
+{
+    VEC_STREAM_POST (pStream->semFree);
+
+    return;
+}
@@ -0,0 +1,222 @@
+/**
+ *   @file  golden_pack.c
+ *
+ *   @brief
+ *      Host tool compressing a golden output to the dictionary coded form
+ *      checked by golden_validate (), see test_golden.c.
+ *
+ *      The input is any text holding the golden output words as "0x" hex
+ *      numbers, such as a text vector or the initializer of a C array of
+ *      the words. The distinct words of the output make up the dictionary
+ *      of the golden, and each word is stored as its 1, 2, 4 or 8 bit index
+ *      in the dictionary. Modulator output, made of a handful of distinct
+ *      I/Q words, packs down 4 to 16 times. Outputs of more than 256
+ *      distinct words are stored as they are.
+ *
+ *      Usage: golden_pack [-d] name file [vecFile]
+ *
+ *          -d      Write the digest of the output instead, a 64 bit hash
+ *                  of each BCP_TEST_DIGEST_CHUNK_BYTES of it, checked by
+ *                  digest_check_data (). vecFile is the test vector file
+ *                  of the output, as converted by tools/vec_conv.c, that
+ *                  a chunk not matching is read back from.
+ *
+ *      The C definitions of the golden, named name, are written to stdout.
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "../bcp_test_vec.h"
+
+#define GOLDEN_PACK_MAX_DICT                256
+
+/* Reads all the "0x" hex numbers of a text. Returns the number of words,
+ * -1 on error.
+ */
+static long read_words (FILE* fpIn, uint32_t** ppWords)
+{
+    uint32_t*       pWords = NULL;
+    long            numWords = 0, maxWords = 0;
+    int             c, prev = 0;
+    char            digits [16];
+    int             numDigits;
+
+    while ((c = fgetc (fpIn)) != EOF)
+    {
+        if (!(prev == '0' && c == 'x'))
+        {
+            prev    =   c;
+            continue;
+        }
+
+        for (numDigits = 0; (c = fgetc (fpIn)) != EOF && strchr ("0123456789abcdefABCDEF", c) != NULL; )
+        {
+            if (numDigits == 8)
+                return -1;
+            digits [numDigits ++]   =   (char) c;
+        }
+        digits [numDigits]  =   '\0';
+        prev    =   c;
+        if (numDigits == 0)
+            continue;
+
+        if (numWords == maxWords)
+        {
+            maxWords    =   maxWords ? 2 * maxWords : 4096;
+            if ((pWords = (uint32_t *) realloc (pWords, maxWords * 4)) == NULL)
+                return -1;
+        }
+        pWords [numWords ++]    =   (uint32_t) strtoul (digits, NULL, 16);
+    }
+
+    *ppWords    =   pWords;
+    return numWords;
+}
+
+static void print_words (const char* pName, const char* pSuffix, const uint32_t* pWords, long numWords)
+{
+    long            i;
+
+    printf ("#pragma DATA_SECTION (%s%s, \".testData\");\n", pName, pSuffix);
+    printf ("static const UInt32 %s%s[%ld] = {", pName, pSuffix, numWords);
+    for (i = 0; i < numWords; i ++)
+        printf ("%s0x%08x%s", (i % 4) ? " " : "\n  ", pWords [i], (i + 1 < numWords) ? "," : "};\n\n");
+}
+
+/* Writes the digest of the output, see bcp_test_vec.h */
+static int print_digest (const char* pName, const uint32_t* pWords, long numWords, const char* pVecFile)
+{
+    uint32_t*       pHashes;
+    uint32_t        hashLo, hashHi;
+    long            chunkWords = BCP_TEST_DIGEST_CHUNK_BYTES / 4;
+    long            numChunks = (numWords + chunkWords - 1) / chunkWords;
+    long            c, i;
+
+    if ((pHashes = (uint32_t *) malloc (numChunks * 8)) == NULL)
+        return 1;
+    for (c = 0; c < numChunks; c ++)
+    {
+        hashLo  =   BCP_TEST_DIGEST_SEED_LO;
+        hashHi  =   BCP_TEST_DIGEST_SEED_HI;
+        for (i = c * chunkWords; i < numWords && i < (c + 1) * chunkWords; i ++)
+        {
+            hashLo  =   BCP_TEST_DIGEST_STEP_LO (hashLo, pWords [i]);
+            hashHi  =   BCP_TEST_DIGEST_STEP_HI (hashHi, pWords [i]);
+        }
+        pHashes [2 * c]     =   hashLo;
+        pHashes [2 * c + 1] =   hashHi;
+    }
+
+    print_words (pName, "_hashes", pHashes, numChunks * 2);
+    printf ("static const BcpTest_Digest %s = {%ld, %ld, %s_hashes, ", pName, numWords * 4, numChunks, pName);
+    if (pVecFile == NULL)
+        printf ("NULL};\n");
+    else
+    {
+        /* As a C string */
+        putchar ('"');
+        for (; *pVecFile; pVecFile ++)
+        {
+            if (*pVecFile == '\\' || *pVecFile == '"')
+                putchar ('\\');
+            putchar (*pVecFile);
+        }
+        printf ("\"};\n");
+    }
+
+    free (pHashes);
+    return 0;
+}
+
+int main (int argc, char* argv [])
+{
+    FILE*           fpIn;
+    uint32_t*       pWords;
+    uint32_t        dict [GOLDEN_PACK_MAX_DICT];
+    uint32_t*       pIdx;
+    long            numWords, numIdxWords, i;
+    int             numDict = 0, idxBits, d, bDigest = 0;
+
+    if (argc > 1 && strcmp (argv [1], "-d") == 0)
+    {
+        bDigest =   1;
+        argc --;
+        argv ++;
+    }
+    if (argc != 3 && !(bDigest && argc == 4))
+    {
+        fprintf (stderr, "Usage: golden_pack [-d] name file [vecFile]\n");
+        return 1;
+    }
+    if ((fpIn = fopen (argv [2], "r")) == NULL)
+    {
+        fprintf (stderr, "%s: cannot open\n", argv [2]);
+        return 1;
+    }
+    numWords    =   read_words (fpIn, &pWords);
+    fclose (fpIn);
+    if (numWords <= 0)
+    {
+        fprintf (stderr, "%s: no golden output words\n", argv [2]);
+        return 1;
+    }
+
+    if (bDigest)
+    {
+        printf ("/* Golden output digest %s: %ld words, generated by tools/golden_pack.c */\n", argv [1], numWords);
+        return print_digest (argv [1], pWords, numWords, (argc == 4) ? argv [3] : NULL);
+    }
+
+    /* Dictionary of the distinct words, in order of first use */
+    for (i = 0; i < numWords && numDict <= GOLDEN_PACK_MAX_DICT; i ++)
+    {
+        for (d = 0; d < numDict && dict [d] != pWords [i]; d ++)
+            ;
+        if (d == numDict)
+        {
+            if (numDict == GOLDEN_PACK_MAX_DICT)
+            {
+                numDict ++;
+                break;
+            }
+            dict [numDict ++]   =   pWords [i];
+        }
+    }
+
+    printf ("/* Golden output %s: %ld words, generated by tools/golden_pack.c */\n", argv [1], numWords);
+    if (numDict > GOLDEN_PACK_MAX_DICT)
+    {
+        /* Stored as is */
+        print_words (argv [1], "_words", pWords, numWords);
+        printf ("static const BcpTest_Golden %s = {%ld, 32, 0, NULL, %s_words};\n", argv [1], numWords, argv [1]);
+        return 0;
+    }
+
+    for (idxBits = 1; (1 << idxBits) < numDict; idxBits *= 2)
+        ;
+
+    /* Indices packed from the LSB of each word */
+    numIdxWords =   (numWords * idxBits + 31) / 32;
+    if ((pIdx = (uint32_t *) calloc (numIdxWords, 4)) == NULL)
+        return 1;
+    for (i = 0; i < numWords; i ++)
+    {
+        for (d = 0; dict [d] != pWords [i]; d ++)
+            ;
+        pIdx [(i * idxBits) >> 5]   |=  (uint32_t) d << ((i * idxBits) & 31);
+    }
+
+    print_words (argv [1], "_dict", dict, numDict);
+    print_words (argv [1], "_idx", pIdx, numIdxWords);
+    printf ("static const BcpTest_Golden %s = {%ld, %d, %d, %s_dict, %s_idx};\n",
+            argv [1], numWords, idxBits, numDict, argv [1], argv [1]);
+
+    free (pIdx);
+    free (pWords);
+    return 0;
+}
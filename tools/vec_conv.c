@@ -0,0 +1,374 @@
+/**
+ *   @file  vec_conv.c
+ *
+ *   @brief
+ *      Host tool converting the text test vectors to the binary container
+ *      loaded by vec_load (), see bcp_test_vec.h.
+ *
+ *      Each input holds one hex word per line ("0x253b1447"), the first
+ *      token of the line. Parameter files of "name = value;" lines are not
+ *      vectors and are skipped, as is the Rx SNR file, whose lines also
+ *      carry the subframe the test reads.
+ *
+ *      An input is mapped and decoded in one pass. Lines of exactly one
+ *      full word, the bulk of any vector, are checked and converted 16
+ *      characters at a time with SSE2 where the host has it; any other
+ *      line goes through the scalar decoder.
+ *
+ *      Usage: vec_conv [-b] [-s numSkip] [-e big | little] file ...
+ *
+ *          -b      Words are byte streams, as HARQ data: stored in memory
+ *                  order, never byte swapped on load.
+ *          -s      Skip the first numSkip values, e.g. the address and
+ *                  length words of the HARQ input files.
+ *          -e      Endianness of the target, the host's by default.
+ *
+ *      Each file is written next to its input, its extension replaced
+ *      by .bvec. To convert the LTE vectors:
+ *
+ *          vec_conv lte/pdsch_inforBits_0002.dat lte/pdsch_modOut_0002.dat lte/pusch_sslIn_0004.dat
+ *          vec_conv -b -s 2 lte/pusch_rdMemIn_0004.dat
+ *
+ *  \par
+ *  ============================================================================
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "../bcp_test_vec.h"
+
+#define VEC_CONV_MAX_LINE                   512
+
+/* Target endianness */
+static int      bTargetBigEndian;
+
+static int host_is_big_endian (void)
+{
+    const uint32_t  word = 1;
+
+    return *(const uint8_t *) &word == 0;
+}
+
+/* Appends a word to the output in the byte order of the target */
+static void put_word (FILE* fpOut, uint32_t word, int bBigEndian)
+{
+    uint8_t         bytes [4];
+
+    if (bBigEndian)
+    {
+        bytes [0] = (uint8_t) (word >> 24);
+        bytes [1] = (uint8_t) (word >> 16);
+        bytes [2] = (uint8_t) (word >> 8);
+        bytes [3] = (uint8_t) word;
+    }
+    else
+    {
+        bytes [0] = (uint8_t) word;
+        bytes [1] = (uint8_t) (word >> 8);
+        bytes [2] = (uint8_t) (word >> 16);
+        bytes [3] = (uint8_t) (word >> 24);
+    }
+    fwrite (bytes, 1, 4, fpOut);
+}
+
+static void put_half (FILE* fpOut, uint16_t half, int bBigEndian)
+{
+    uint8_t         bytes [2];
+
+    bytes [bBigEndian ? 0 : 1] = (uint8_t) (half >> 8);
+    bytes [bBigEndian ? 1 : 0] = (uint8_t) half;
+    fwrite (bytes, 1, 2, fpOut);
+}
+
+/* Value of a hex digit, -1 if the character is not one */
+static int hex_nibble (char c)
+{
+    if (c >= '0' && c <= '9')
+        return c - '0';
+    c   |=  0x20;
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+    return -1;
+}
+
+#ifdef __SSE2__
+/* Decodes a line of exactly "0x", 8 hex digits and '\n' from the 16
+ * characters at pLine. Returns 0 if the line is of any other form.
+ */
+static int decode_word_line_sse2 (const char* pLine, uint32_t* pWord)
+{
+    const __m128i   line = _mm_loadu_si128 ((const __m128i *) pLine);
+    const __m128i   frame = _mm_setr_epi8 ('0', 'x', 0, 0, 0, 0, 0, 0, 0, 0, '\n', 0, 0, 0, 0, 0);
+    __m128i         lower, isDigit, isAlpha, nibbles, bytes;
+    int             frameMask, hexMask;
+    uint32_t        word;
+
+    /* ASCII only: characters from 0x80 compare negative and fail both */
+    lower   =   _mm_or_si128 (line, _mm_set1_epi8 (0x20));
+    isDigit =   _mm_and_si128 (_mm_cmpgt_epi8 (line, _mm_set1_epi8 ('0' - 1)),
+                               _mm_cmplt_epi8 (line, _mm_set1_epi8 ('9' + 1)));
+    isAlpha =   _mm_and_si128 (_mm_cmpgt_epi8 (lower, _mm_set1_epi8 ('a' - 1)),
+                               _mm_cmplt_epi8 (lower, _mm_set1_epi8 ('f' + 1)));
+
+    frameMask   =   _mm_movemask_epi8 (_mm_cmpeq_epi8 (line, frame)) & 0x403;
+    hexMask     =   _mm_movemask_epi8 (_mm_or_si128 (isDigit, isAlpha)) & 0x3fc;
+    if ((frameMask | hexMask) != 0x7ff)
+        return 0;
+
+    nibbles =   _mm_or_si128 (_mm_and_si128 (isDigit, _mm_sub_epi8 (line, _mm_set1_epi8 ('0'))),
+                              _mm_andnot_si128 (isDigit, _mm_sub_epi8 (lower, _mm_set1_epi8 ('a' - 10))));
+
+    /* Digit pairs to bytes: 16 bit lane i holds digits 2i and 2i + 1 */
+    bytes   =   _mm_or_si128 (_mm_and_si128 (_mm_slli_epi16 (nibbles, 4), _mm_set1_epi16 (0xf0)),
+                              _mm_srli_epi16 (nibbles, 8));
+    bytes   =   _mm_packus_epi16 (bytes, bytes);
+
+    /* Lanes 1 to 4 hold the bytes of the word, most significant first */
+    word    =   (uint32_t) _mm_cvtsi128_si32 (_mm_srli_si128 (bytes, 1));
+    *pWord  =   BCP_TEST_VEC_SWAP32 (word);
+
+    return 1;
+}
+#endif
+
+/* Decodes the values of a text vector in one pass over its text. pWords
+ * must hold (textLen + 1) / 4 words, the most a text of that length holds.
+ * Returns the number of values, -1 if the text is not a vector.
+ */
+static long decode_values (const char* pText, size_t textLen, uint32_t* pWords)
+{
+    const char*     p = pText;
+    const char*     pEnd = pText + textLen;
+    uint32_t        word;
+    long            numWords = 0;
+    int             nibble, numDigits;
+
+    while (p < pEnd)
+    {
+#ifdef __SSE2__
+        if (pEnd - p >= 16 && decode_word_line_sse2 (p, &word))
+        {
+            pWords [numWords ++]    =   word;
+            p   +=  11;
+            continue;
+        }
+#endif
+
+        for (; p < pEnd && (*p == ' ' || *p == '\t' || *p == '\r'); p ++)
+            ;
+        if (p == pEnd)
+            break;
+        if (*p == '\n')
+        {
+            p ++;
+            continue;       /* Blank line */
+        }
+
+        if (pEnd - p < 3 || p [0] != '0' || p [1] != 'x')
+            return -1;
+        p   +=  2;
+        word        =   0;
+        numDigits   =   0;
+        for (; p < pEnd && (nibble = hex_nibble (*p)) >= 0; p ++, numDigits ++)
+            word    =   (word << 4) | (uint32_t) nibble;
+        if (numDigits == 0 || numDigits > 8 ||
+            (p < pEnd && *p != '\n' && *p != '\r' && *p != ' ' && *p != '\t'))
+            return -1;
+
+        /* Only the first token of the line is read */
+        while (p < pEnd && *p ++ != '\n')
+            ;
+        pWords [numWords ++]    =   word;
+    }
+
+    return numWords;
+}
+
+/* Reads the values of a text vector. Returns the number of values, -1 if
+ * the file is not a vector, -2 if it cannot be read.
+ */
+static long read_values (const char* pInName, long numSkip, uint32_t** ppWords)
+{
+    struct stat     fileStat;
+    void*           pText;
+    uint32_t*       pWords;
+    long            numWords;
+    int             fd;
+
+    if ((fd = open (pInName, O_RDONLY)) < 0 || fstat (fd, &fileStat) != 0)
+    {
+        fprintf (stderr, "%s: cannot open\n", pInName);
+        if (fd >= 0)
+            close (fd);
+        return -2;
+    }
+
+    if ((pWords = (uint32_t *) malloc (((size_t) fileStat.st_size + 1) / 4 * 4 + 4)) == NULL)
+    {
+        close (fd);
+        return -2;
+    }
+    numWords    =   0;
+    if (fileStat.st_size > 0)
+    {
+        pText   =   mmap (NULL, (size_t) fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (pText == MAP_FAILED)
+        {
+            close (fd);
+            free (pWords);
+            return -2;
+        }
+        numWords    =   decode_values ((const char *) pText, (size_t) fileStat.st_size, pWords);
+        munmap (pText, (size_t) fileStat.st_size);
+    }
+    close (fd);
+
+    if (numWords < 0)
+    {
+        free (pWords);
+        return -1;
+    }
+
+    numSkip     =   numSkip < numWords ? numSkip : numWords;
+    numWords    -=  numSkip;
+    memmove (pWords, pWords + numSkip, (size_t) numWords * 4);
+
+    *ppWords    =   pWords;
+    return numWords;
+}
+
+/* Writes one binary test vector. The words are brought to the byte order
+ * of the file in place.
+ */
+static int write_vec (FILE* fpOut, const char* pName, int format, uint32_t* pWords, long numWords)
+{
+    uint32_t        cksum = 0, word;
+    char            name [BCP_TEST_VEC_NAME_LEN];
+    long            i;
+    int             bSwap;
+
+    /* Checksum of the words as the target reads them. A byte stream is
+     * stored in little endian word order, as read_harq_data_from_file ()
+     * lays it out.
+     */
+    for (i = 0; i < numWords; i ++)
+    {
+        word    =   pWords [i];
+        if (format == BCP_TEST_VEC_FMT_BYTES && bTargetBigEndian)
+            word    =   BCP_TEST_VEC_SWAP32 (word);
+        cksum   =   BCP_TEST_VEC_CKSUM_STEP (cksum, word);
+    }
+
+    memset (name, 0, sizeof (name));
+    strncpy (name, pName, sizeof (name) - 1);
+
+    put_word (fpOut, BCP_TEST_VEC_MAGIC, bTargetBigEndian);
+    put_word (fpOut, BCP_TEST_VEC_ENDIAN_TAG, bTargetBigEndian);
+    put_half (fpOut, BCP_TEST_VEC_VERSION, bTargetBigEndian);
+    put_half (fpOut, (uint16_t) format, bTargetBigEndian);
+    put_word (fpOut, (uint32_t) numWords, bTargetBigEndian);
+    put_word (fpOut, BCP_TEST_VEC_ALIGN, bTargetBigEndian);
+    put_word (fpOut, cksum, bTargetBigEndian);
+    fwrite (name, 1, sizeof (name), fpOut);
+
+    /* Words in the byte order of the target, byte streams little endian,
+     * then written in one go.
+     */
+    if (format == BCP_TEST_VEC_FMT_BYTES)
+        bSwap   =   host_is_big_endian ();
+    else
+        bSwap   =   (bTargetBigEndian != host_is_big_endian ());
+    if (bSwap)
+    {
+        for (i = 0; i < numWords; i ++)
+            pWords [i]  =   BCP_TEST_VEC_SWAP32 (pWords [i]);
+    }
+    fwrite (pWords, 4, (size_t) numWords, fpOut);
+
+    return ferror (fpOut) ? -1 : 0;
+}
+
+static int convert_file (const char* pInName, int format, long numSkip)
+{
+    FILE*           fpOut;
+    char            outName [VEC_CONV_MAX_LINE];
+    const char*     pBase;
+    char*           pExt;
+    uint32_t*       pWords = NULL;
+    long            numWords;
+    int             retVal;
+
+    numWords    =   read_values (pInName, numSkip, &pWords);
+    if (numWords == -2)
+        return -1;
+    if (numWords < 0)
+    {
+        fprintf (stderr, "%s: not a vector file, skipped\n", pInName);
+        return 0;
+    }
+
+    if (strlen (pInName) + 6 > sizeof (outName))
+    {
+        free (pWords);
+        return -1;
+    }
+    strcpy (outName, pInName);
+    pBase   =   strrchr (outName, '/') ? strrchr (outName, '/') + 1 : outName;
+    if ((pExt = strrchr (pBase, '.')) != NULL)
+        *pExt   =   '\0';
+    strcat (outName, ".bvec");
+
+    if ((fpOut = fopen (outName, "wb")) == NULL)
+    {
+        fprintf (stderr, "%s: cannot create\n", outName);
+        free (pWords);
+        return -1;
+    }
+    pBase   =   strrchr (pInName, '/') ? strrchr (pInName, '/') + 1 : pInName;
+    retVal  =   write_vec (fpOut, pBase, format, pWords, numWords);
+    fclose (fpOut);
+    free (pWords);
+
+    printf ("%s: %ld words -> %s\n", pInName, numWords, outName);
+    return retVal;
+}
+
+int main (int argc, char* argv [])
+{
+    int             format = BCP_TEST_VEC_FMT_WORDS;
+    long            numSkip = 0;
+    int             i, numFail = 0;
+
+    bTargetBigEndian    =   host_is_big_endian ();
+
+    for (i = 1; i < argc && argv [i][0] == '-'; i ++)
+    {
+        if (strcmp (argv [i], "-b") == 0)
+            format  =   BCP_TEST_VEC_FMT_BYTES;
+        else if (strcmp (argv [i], "-s") == 0 && i + 1 < argc)
+            numSkip =   strtol (argv [++ i], NULL, 0);
+        else if (strcmp (argv [i], "-e") == 0 && i + 1 < argc)
+            bTargetBigEndian    =   (strcmp (argv [++ i], "big") == 0);
+        else
+            break;
+    }
+    if (i == argc)
+    {
+        fprintf (stderr, "Usage: vec_conv [-b] [-s numSkip] [-e big | little] file ...\n");
+        return 1;
+    }
+
+    for (; i < argc; i ++)
+        if (convert_file (argv [i], format, numSkip) < 0)
+            numFail ++;
+
+    return numFail ? 1 : 0;
+}